@@ -0,0 +1,72 @@
+/*
+ * AccessLog.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "ifs/HttpRequest.h"
+#include "ifs/HttpResponse.h"
+#include "File.h"
+#include <vector>
+
+namespace fibjs {
+
+// native access log of HttpHandler. the line template is compiled once, each
+// request is formatted into a buffer picked by the calling thread and the
+// buffers are written out in batches from the longsync pool.
+class AccessLog : public obj_base {
+public:
+    enum {
+        kShards = 8
+    };
+
+    class token {
+    public:
+        token(int32_t type, exlib::string text = "")
+            : m_type(type)
+            , m_text(text)
+        {
+        }
+
+    public:
+        int32_t m_type;
+        exlib::string m_text;
+    };
+
+    class shard {
+    public:
+        exlib::spinlock m_lock;
+        exlib::string m_buf;
+    };
+
+public:
+    AccessLog()
+        : m_json(false)
+    {
+    }
+
+public:
+    static result_t create(v8::Local<v8::Object> opts, obj_ptr<AccessLog>& retVal);
+
+public:
+    void log(HttpRequest_base* req, HttpResponse_base* rep, exlib::string& remote,
+        date_t& d, int64_t latency);
+
+private:
+    result_t compile(exlib::string format);
+    void flush();
+
+private:
+    std::vector<token> m_tokens;
+    bool m_json;
+    obj_ptr<File> m_file;
+
+    shard m_shards[kShards];
+    exlib::atomic m_dirty;
+    exlib::atomic m_working;
+};
+
+} /* namespace fibjs */
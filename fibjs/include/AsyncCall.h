@@ -1,12 +1,19 @@
 #pragma once
 
 #include <string>
+#include <chrono>
 #include <exlib/include/fiber.h>
 #include "utils.h"
 #include "Runtime.h"
 
 namespace fibjs {
 
+// javascript jobs queued on all isolates, reported by the metrics module
+extern exlib::atomic g_pendingJobs;
+
+// deadline of the current javascript fiber, in ms since the epoch, 0 for none
+double current_deadline();
+
 class AsyncEvent : public exlib::Task_base {
 private:
     enum kStateType {
@@ -36,6 +43,10 @@ public:
     void sync(Isolate* isolate)
     {
         isolate->Ref();
+        m_queued = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+        g_pendingJobs.inc();
         isolate->m_jobs.putTail(this);
         isolate->m_sem.post();
     }
@@ -66,6 +77,31 @@ public:
         return m_isolate;
     }
 
+    // deadline of the request this call works for, in ms since the epoch,
+    // 0 for none. state machines inherit it from the event that started them.
+    virtual double deadline()
+    {
+        return 0;
+    }
+
+    // tighten a timeout in ms, 0 for none, to the remaining time before the
+    // deadline. fails with CALL_E_TIMEOUT once the deadline has passed.
+    result_t clip_timeout(int32_t& timeout)
+    {
+        double d = deadline();
+        if (d <= 0)
+            return 0;
+
+        double left = d - (double)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        if (left < 1)
+            return CHECK_ERROR(CALL_E_TIMEOUT);
+
+        if (left < INT32_MAX && (timeout <= 0 || timeout > left))
+            timeout = (int32_t)left;
+
+        return 0;
+    }
+
     bool isAsync() const
     {
         return m_state == kStateAsync;
@@ -94,6 +130,7 @@ public:
 public:
     std::vector<Variant> m_ctx;
     obj_ptr<object_base> m_ctxo;
+    int64_t m_queued;
 
 protected:
     Isolate* m_isolate;
@@ -107,7 +144,13 @@ public:
     AsyncCall(void** a)
         : AsyncEvent(Isolate::current())
         , args(a)
+        , m_deadline(current_deadline())
+    {
+    }
+
+    virtual double deadline()
     {
+        return m_deadline;
     }
 
     virtual int32_t post(int32_t v)
@@ -157,6 +200,7 @@ protected:
     void** args;
 
 private:
+    double m_deadline;
     exlib::string m_error;
     int32_t m_v;
 };
@@ -308,6 +352,11 @@ public:
         return m_ac->isolate();
     }
 
+    virtual double deadline()
+    {
+        return m_ac ? m_ac->deadline() : 0;
+    }
+
 public:
     virtual void resume()
     {
@@ -474,6 +523,11 @@ public:
         return m_isolate;
     }
 
+    virtual double deadline()
+    {
+        return m_deadline;
+    }
+
     int32_t check_result(int32_t hr, const v8::FunctionCallbackInfo<v8::Value>& args);
 
 protected:
@@ -503,6 +557,7 @@ protected:
     v8::Global<v8::Function> m_cb;
 
 private:
+    double m_deadline;
     exlib::string m_error;
     int32_t m_v;
 };
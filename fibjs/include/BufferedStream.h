@@ -52,6 +52,9 @@ public:
     virtual result_t set_EOL(exlib::string newVal);
 
 public:
+    // wait until some data is buffered, CALL_RETURN_NULL at the end of stream
+    result_t fill(AsyncEvent* ac);
+
     void append(int32_t n)
     {
         if (n > 0) {
@@ -0,0 +1,110 @@
+/*
+ * Bundle.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "utils.h"
+#include "Buffer.h"
+#include "date.h"
+
+namespace fibjs {
+
+// a single file application bundle. entries are stored as they are, one
+// after another, followed by an open addressing index on the FNV-1a hash of
+// their names and a trailer at the very end, so that a bundle still works
+// after it is appended to the fibjs executable:
+//
+//   [data ...][slot * slots][names][trailer]
+//
+// the whole file is mapped read only, once per process, and mapped again
+// when it changes on disk. a mapping is never unmapped while a buffer points
+// into it. all numbers are little endian.
+class Bundle : public obj_base {
+public:
+    enum {
+        kEmpty = 0,
+        kFile = 1,
+        kCodeCache = 2
+    };
+
+    struct Slot {
+        uint64_t hash;
+        uint64_t offset;
+        uint64_t size;
+        uint32_t name_offset;
+        uint16_t name_length;
+        uint8_t kind;
+        uint8_t reserved;
+    };
+
+    struct Trailer {
+        char magic[8];
+        uint32_t version;
+        uint32_t slots;
+        uint64_t index_offset;
+        uint64_t size;
+    };
+
+    static const char magic[8];
+    static const uint32_t version = 1;
+
+public:
+    Bundle()
+        : m_map(NULL)
+        , m_map_size(0)
+        , m_base(NULL)
+        , m_size(0)
+        , m_data_size(0)
+        , m_slots(NULL)
+        , m_slot_count(0)
+    {
+    }
+
+    ~Bundle();
+
+public:
+    // the bundle that holds the virtual path "bundle$/member", and the member
+    static bool find(exlib::string fname, obj_ptr<Bundle>& bundle, exlib::string& member);
+    static obj_ptr<Bundle> open(exlib::string fname);
+    static bool is_bundle(exlib::string fname);
+    static void erase(exlib::string fname);
+
+    static uint64_t hash(const char* name, size_t len);
+
+public:
+    const Slot* lookup(exlib::string member, int32_t kind) const;
+
+    const char* data(const Slot* slot) const
+    {
+        return m_base + slot->offset;
+    }
+
+    // the entry without a copy, it keeps the mapping alive. the memory is
+    // read only, so it must be copied before script can get hold of it.
+    obj_ptr<Buffer> buffer(const Slot* slot);
+
+public:
+    date_t m_mtime;
+    date_t m_date;
+
+private:
+    bool map(exlib::string fname);
+
+private:
+    char* m_map;
+    size_t m_map_size;
+    const char* m_base;
+    uint64_t m_size;
+    uint64_t m_data_size;
+    const Slot* m_slots;
+    uint32_t m_slot_count;
+#ifdef _WIN32
+    HANDLE m_hMap;
+#endif
+};
+
+} /* namespace fibjs */
@@ -90,6 +90,7 @@ public:
         {
             {
                 JSFiber::EnterJsScope s;
+                s->m_deadline = deadline();
 
                 m_hr = js_run();
                 if (m_hr == CALL_E_EXCEPTION)
@@ -43,8 +43,8 @@ public:
     virtual result_t setAAD(Buffer_base* buffer, v8::Local<v8::Object> options, obj_ptr<Cipher_base>& retVal);
     virtual result_t setAAD(exlib::string buffer, v8::Local<v8::Object> options, obj_ptr<Cipher_base>& retVal);
     virtual result_t setAutoPadding(bool autoPadding, obj_ptr<Cipher_base>& retVal);
-    virtual result_t update(Buffer_base* data, exlib::string inputEncoding, exlib::string outputEncoding, v8::Local<v8::Value>& retVal);
-    virtual result_t update(exlib::string data, exlib::string inputEncoding, exlib::string outputEncoding, v8::Local<v8::Value>& retVal);
+    virtual result_t update(Buffer_base* data, exlib::string inputEncoding, exlib::string outputEncoding, Variant& retVal, AsyncEvent* ac);
+    virtual result_t update(exlib::string data, exlib::string inputEncoding, exlib::string outputEncoding, Variant& retVal, AsyncEvent* ac);
     virtual result_t final(exlib::string outputEncoding, v8::Local<v8::Value>& retVal);
 
 public:
@@ -61,8 +61,8 @@ private:
     result_t setAAD(const char* data, int data_len, v8::Local<v8::Object> options);
     result_t CommonInit(const EVP_CIPHER* cipher, const unsigned char* key, unsigned int key_len,
         const unsigned char* iv, unsigned int iv_len, v8::Local<v8::Object> options);
-    result_t update(const unsigned char* data, size_t len, exlib::string outputEncoding, v8::Local<v8::Value>& retVal);
-    result_t get_result(Buffer* out, exlib::string outputEncoding, v8::Local<v8::Value>& retVal, bool final);
+    result_t update(const unsigned char* data, size_t len, exlib::string outputEncoding, Variant& retVal);
+    result_t get_result(Buffer* out, exlib::string outputEncoding, Variant& retVal, bool final);
 
 private:
     CipherCtxPointer m_ctx;
@@ -72,6 +72,7 @@ private:
     char auth_tag_[EVP_GCM_TLS_TAG_LEN] = {};
     bool pending_auth_failed_ = false;
     int max_message_size_ = 0;
+    exlib::atomic m_busy;
 
     obj_ptr<StringDecoder_base> m_decoder;
 };
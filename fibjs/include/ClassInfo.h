@@ -210,6 +210,19 @@ public:
         return m_cd.name;
     }
 
+    // Attach gives a module a "promises" object for its static async methods
+    bool hasPromises()
+    {
+        for (int32_t i = 0; i < m_cd.mc; i++)
+            if (m_cd.cms[i].is_static && m_cd.cms[i].is_async)
+                return true;
+
+        if (m_cd.base)
+            return m_cd.base->hasPromises();
+
+        return false;
+    }
+
     void Attach(Isolate* isolate, v8::Local<v8::Object> o)
     {
         int32_t i;
@@ -0,0 +1,82 @@
+/*
+ * ConcurrencyLimiter.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "object.h"
+#include <deque>
+#include <vector>
+
+namespace fibjs {
+
+// admission control of HttpHandler. requests over the limit wait in a bounded
+// queue without holding a fiber, requests over the queue are rejected. with
+// adaptive on, the limit follows the latency gradient between maxConcurrency
+// and minConcurrency.
+class ConcurrencyLimiter : public obj_base {
+public:
+    ConcurrencyLimiter()
+        : m_max(0)
+        , m_min(1)
+        , m_maxQueue(0)
+        , m_queueTimeout(0)
+        , m_adaptive(false)
+        , m_timer(false)
+        , m_limit(0)
+        , m_inflight(0)
+        , m_longLatency(0)
+        , m_accepted(0)
+        , m_queued(0)
+        , m_shed(0)
+        , m_timeouts(0)
+    {
+    }
+
+public:
+    static result_t create(v8::Local<v8::Object> opts, obj_ptr<ConcurrencyLimiter>& retVal);
+
+public:
+    // return 0 when admitted, CALL_E_PENDDING when parked and CALL_RETURN_NULL
+    // when rejected. a parked request is resumed later with one of the other two.
+    result_t acquire(AsyncState* as);
+    void release(int64_t latency);
+    void expire();
+    void stats(Isolate* isolate, v8::Local<v8::Object>& retVal);
+
+private:
+    void update(int64_t latency);
+    void dispatch(int64_t now, std::vector<AsyncState*>& admitted, std::vector<AsyncState*>& expired);
+    int32_t arm(int64_t now);
+
+private:
+    class waiter {
+    public:
+        AsyncState* m_as;
+        int64_t m_time;
+    };
+
+private:
+    int32_t m_max;
+    int32_t m_min;
+    int32_t m_maxQueue;
+    int64_t m_queueTimeout;
+    bool m_adaptive;
+
+    exlib::spinlock m_lock;
+    bool m_timer;
+    double m_limit;
+    int32_t m_inflight;
+    double m_longLatency;
+    std::deque<waiter> m_waiters;
+
+    int64_t m_accepted;
+    int64_t m_queued;
+    int64_t m_shed;
+    int64_t m_timeouts;
+};
+
+} /* namespace fibjs */
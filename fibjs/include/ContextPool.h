@@ -0,0 +1,46 @@
+/*
+ * ContextPool.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "ifs/ContextPool.h"
+#include <list>
+
+namespace fibjs {
+
+// contexts made ahead of time for vm.runInContext. a context that comes
+// back is detached and thrown away, never handed out again, and the pool
+// makes its replacement in the background.
+class ContextPool : public ContextPool_base {
+public:
+    ContextPool(int32_t size)
+        : m_size(size)
+        , m_refilling(false)
+    {
+    }
+
+public:
+    // ContextPool_base
+    virtual result_t acquire(v8::Local<v8::Object> contextObject, v8::Local<v8::Object>& retVal);
+    virtual result_t release(v8::Local<v8::Object> contextObject);
+    virtual result_t get_size(int32_t& retVal);
+    virtual result_t get_available(int32_t& retVal);
+
+public:
+    void fill(int32_t count);
+
+private:
+    v8::Local<v8::Object> create();
+    void refill();
+
+private:
+    int32_t m_size;
+    bool m_refilling;
+    std::list<v8::Global<v8::Object>> m_globals;
+};
+
+}
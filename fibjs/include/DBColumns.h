@@ -0,0 +1,376 @@
+/*
+ * DBColumns.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "Buffer.h"
+#include "v8_api.h"
+#include <math.h>
+
+namespace fibjs {
+
+// column oriented result set. every column is filled straight into a growing
+// backing store, numeric columns become one typed array, text and blob
+// columns become an offsets array plus one data buffer, nulls are kept in a
+// validity bitmap, one bit per row, set when the value is present.
+class DBColumns : public NObject {
+public:
+    enum {
+        C_NULL = 0,
+        C_INTEGER,
+        C_FLOAT,
+        C_DATE,
+        C_TEXT,
+        C_BLOB
+    };
+
+    class store {
+    public:
+        store()
+            : m_length(0)
+            , m_capacity(0)
+        {
+        }
+
+    public:
+        uint8_t* data()
+        {
+            return m_store ? (uint8_t*)m_store->Data() : NULL;
+        }
+
+        void* grow(size_t n)
+        {
+            if (m_length + n > m_capacity) {
+                size_t cap = m_capacity ? m_capacity * 2 : 4096;
+                while (cap < m_length + n)
+                    cap *= 2;
+
+                std::shared_ptr<v8::BackingStore> s = NewBackingStore(cap);
+                if (m_length)
+                    memcpy(s->Data(), m_store->Data(), m_length);
+
+                m_store = s;
+                m_capacity = cap;
+            }
+
+            void* p = data() + m_length;
+            m_length += n;
+
+            return p;
+        }
+
+        // drop the spare capacity, the store is handed out to script as is
+        void fit()
+        {
+            if (m_store && m_capacity > m_length) {
+                std::shared_ptr<v8::BackingStore> s = NewBackingStore(m_length);
+                if (m_length)
+                    memcpy(s->Data(), m_store->Data(), m_length);
+
+                m_store = s;
+                m_capacity = m_length;
+            }
+        }
+
+        template <typename T>
+        void push(T v)
+        {
+            memcpy(grow(sizeof(T)), &v, sizeof(T));
+        }
+
+    public:
+        std::shared_ptr<v8::BackingStore> m_store;
+        size_t m_length;
+        size_t m_capacity;
+    };
+
+    class column {
+    public:
+        column()
+            : m_type(C_NULL)
+            , m_nullCount(0)
+            , m_double(false)
+        {
+        }
+
+    public:
+        exlib::string m_name;
+        int32_t m_type;
+        int64_t m_nullCount;
+        bool m_double;
+        store m_values;
+        store m_data;
+        store m_nulls;
+    };
+
+public:
+    DBColumns(int32_t sz, int64_t affected = 0, int64_t insertId = 0)
+        : m_columns(sz)
+        , m_rows(0)
+        , m_affected(affected)
+        , m_insertId(insertId)
+    {
+    }
+
+public:
+    void setField(int32_t i, const exlib::string& name, int32_t type)
+    {
+        m_columns[i].m_name = name;
+        setType(i, type);
+    }
+
+    int32_t type(int32_t i)
+    {
+        return m_columns[i].m_type;
+    }
+
+    // the rows before the first typed value of a column are all null, they
+    // are given the empty value of the new type.
+    void setType(int32_t i, int32_t type)
+    {
+        column& c = m_columns[i];
+        int64_t r;
+
+        c.m_type = type;
+        switch (type) {
+        case C_INTEGER:
+            for (r = 0; r < m_rows; r++)
+                c.m_values.push<int64_t>(0);
+            break;
+        case C_FLOAT:
+        case C_DATE:
+            for (r = 0; r < m_rows; r++)
+                c.m_values.push<double>(NAN);
+            break;
+        case C_TEXT:
+        case C_BLOB:
+            for (r = 0; r <= m_rows; r++)
+                c.m_values.push<int32_t>(0);
+            break;
+        }
+    }
+
+    // a float in an integer column turns the column to float
+    void toFloat(int32_t i)
+    {
+        toDouble(m_columns[i]);
+        m_columns[i].m_type = C_FLOAT;
+    }
+
+    // a text or blob in a numeric column turns the column to text or blob,
+    // the numbers seen so far are kept as their text
+    void toBytes(int32_t i, int32_t type)
+    {
+        column& c = m_columns[i];
+        store values;
+        uint8_t* nulls = c.m_nulls.data();
+
+        values.push<int32_t>(0);
+        for (int64_t r = 0; r < m_rows; r++) {
+            if (nulls[r >> 3] & (1 << (r & 7))) {
+                char buf[64];
+                int32_t n;
+
+                if (c.m_type == C_INTEGER)
+                    n = snprintf(buf, sizeof(buf), "%lld", (long long)((int64_t*)c.m_values.data())[r]);
+                else
+                    n = snprintf(buf, sizeof(buf), "%.16g", ((double*)c.m_values.data())[r]);
+
+                memcpy(c.m_data.grow(n), buf, n);
+            }
+
+            values.push<int32_t>((int32_t)c.m_data.m_length);
+        }
+
+        c.m_values = values;
+        c.m_type = type;
+    }
+
+    // integer columns are handed out as Float64Array unless a value does
+    // not fit in a double, then they stay a BigInt64Array. nulls are NaN in
+    // every Float64Array, and 0 in a BigInt64Array.
+    void finish()
+    {
+        for (int32_t i = 0; i < (int32_t)m_columns.size(); i++) {
+            column& c = m_columns[i];
+
+            if (c.m_type == C_INTEGER && !c.m_double) {
+                int64_t* p = (int64_t*)c.m_values.data();
+                int64_t r;
+
+                for (r = 0; r < m_rows; r++)
+                    if (p[r] > 9007199254740992ll || p[r] < -9007199254740992ll)
+                        break;
+
+                if (r == m_rows) {
+                    toDouble(c);
+                    c.m_double = true;
+                }
+            }
+
+            c.m_values.fit();
+            c.m_data.fit();
+            c.m_nulls.fit();
+        }
+    }
+
+    void beginRow()
+    {
+        if (!(m_rows & 7))
+            for (int32_t i = 0; i < (int32_t)m_columns.size(); i++)
+                m_columns[i].m_nulls.push<uint8_t>(0);
+    }
+
+    void endRow()
+    {
+        m_rows++;
+    }
+
+    void setNull(int32_t i)
+    {
+        column& c = m_columns[i];
+
+        c.m_nullCount++;
+        switch (c.m_type) {
+        case C_INTEGER:
+            c.m_values.push<int64_t>(0);
+            break;
+        case C_FLOAT:
+        case C_DATE:
+            c.m_values.push<double>(NAN);
+            break;
+        case C_TEXT:
+        case C_BLOB:
+            c.m_values.push<int32_t>((int32_t)c.m_data.m_length);
+            break;
+        }
+    }
+
+    void setInteger(int32_t i, int64_t v)
+    {
+        valid(i);
+        m_columns[i].m_values.push<int64_t>(v);
+    }
+
+    void setDouble(int32_t i, double v)
+    {
+        valid(i);
+        m_columns[i].m_values.push<double>(v);
+    }
+
+    result_t setBytes(int32_t i, const void* data, int32_t size)
+    {
+        column& c = m_columns[i];
+
+        if (c.m_data.m_length + size > INT32_MAX)
+            return CHECK_ERROR(Runtime::setError("db: column data is too large."));
+
+        valid(i);
+        if (size)
+            memcpy(c.m_data.grow(size), data, size);
+        c.m_values.push<int32_t>((int32_t)c.m_data.m_length);
+
+        return 0;
+    }
+
+public:
+    // object_base
+    virtual result_t valueOf(v8::Local<v8::Value>& retVal)
+    {
+        static const char* s_types[] = { "null", "integer", "float", "date", "text", "blob" };
+
+        Isolate* isolate = holder();
+        v8::Local<v8::Context> context = isolate->context();
+        v8::Local<v8::Object> obj = v8::Object::New(isolate->m_isolate);
+        v8::Local<v8::Array> cols = v8::Array::New(isolate->m_isolate, (int32_t)m_columns.size());
+
+        for (int32_t i = 0; i < (int32_t)m_columns.size(); i++) {
+            column& c = m_columns[i];
+            v8::Local<v8::Object> o = v8::Object::New(isolate->m_isolate);
+            v8::Local<v8::Value> values = v8::Null(isolate->m_isolate);
+            int32_t type = c.m_type;
+
+            o->Set(context, isolate->NewString("name"), isolate->NewString(c.m_name)).IsJust();
+
+            if (type != C_NULL) {
+                v8::Local<v8::ArrayBuffer> ab = c.m_values.m_store
+                    ? v8::ArrayBuffer::New(isolate->m_isolate, c.m_values.m_store)
+                    : v8::ArrayBuffer::New(isolate->m_isolate, 0);
+
+                switch (type) {
+                case C_INTEGER:
+                    if (c.m_double)
+                        values = v8::Float64Array::New(ab, 0, (size_t)m_rows);
+                    else
+                        values = v8::BigInt64Array::New(ab, 0, (size_t)m_rows);
+                    break;
+                case C_FLOAT:
+                case C_DATE:
+                    values = v8::Float64Array::New(ab, 0, (size_t)m_rows);
+                    break;
+                case C_TEXT:
+                case C_BLOB: {
+                    obj_ptr<Buffer> buf;
+
+                    if (c.m_data.m_length)
+                        buf = new Buffer(c.m_data.m_store, 0, c.m_data.m_length);
+                    else
+                        buf = new Buffer();
+
+                    o->Set(context, isolate->NewString("offsets"), v8::Int32Array::New(ab, 0, (size_t)m_rows + 1)).IsJust();
+                    values = buf->wrap();
+                    break;
+                }
+                }
+            }
+
+            o->Set(context, isolate->NewString("type"), isolate->NewString(s_types[type])).IsJust();
+            o->Set(context, isolate->NewString(type == C_TEXT || type == C_BLOB ? "data" : "values"), values).IsJust();
+
+            if (c.m_nullCount) {
+                obj_ptr<Buffer> nulls = new Buffer(c.m_nulls.m_store, 0, (size_t)(m_rows + 7) / 8);
+                o->Set(context, isolate->NewString("nulls"), nulls->wrap()).IsJust();
+            } else
+                o->Set(context, isolate->NewString("nulls"), v8::Null(isolate->m_isolate)).IsJust();
+
+            cols->Set(context, i, o).IsJust();
+        }
+
+        obj->Set(context, isolate->NewString("length"), v8::Number::New(isolate->m_isolate, (double)m_rows)).IsJust();
+        obj->Set(context, isolate->NewString("columns"), cols).IsJust();
+        obj->Set(context, isolate->NewString("affected"), v8::Number::New(isolate->m_isolate, (double)m_affected)).IsJust();
+        obj->Set(context, isolate->NewString("insertId"), v8::Number::New(isolate->m_isolate, (double)m_insertId)).IsJust();
+
+        retVal = obj;
+        return 0;
+    }
+
+private:
+    void valid(int32_t i)
+    {
+        m_columns[i].m_nulls.data()[m_rows >> 3] |= 1 << (m_rows & 7);
+    }
+
+    void toDouble(column& c)
+    {
+        int64_t* p = (int64_t*)c.m_values.data();
+        uint8_t* nulls = c.m_nulls.data();
+
+        for (int64_t r = 0; r < m_rows; r++) {
+            double d = !(nulls[r >> 3] & (1 << (r & 7))) ? NAN : (double)p[r];
+            memcpy(p + r, &d, sizeof(double));
+        }
+    }
+
+private:
+    std::vector<column> m_columns;
+    int64_t m_rows;
+    int64_t m_affected;
+    int64_t m_insertId;
+};
+
+} /* namespace fibjs */
@@ -20,18 +20,20 @@ public:
 
 public:
     // Digest_base
-    virtual result_t update(Buffer_base* data, obj_ptr<Digest_base>& retVal);
-    virtual result_t update(exlib::string data, exlib::string codec, obj_ptr<Digest_base>& retVal);
+    virtual result_t update(Buffer_base* data, obj_ptr<Digest_base>& retVal, AsyncEvent* ac);
+    virtual result_t update(exlib::string data, exlib::string codec, obj_ptr<Digest_base>& retVal, AsyncEvent* ac);
     virtual result_t digest(exlib::string codec, v8::Local<v8::Value>& retVal);
     virtual result_t get_size(int32_t& retVal);
 
 private:
+    result_t update(const unsigned char* data, size_t len);
     result_t digest(obj_ptr<Buffer>& retVal);
 
 private:
     EVPMDPointer m_ctx;
     int32_t m_iAlgo;
     bool m_bMac;
+    exlib::atomic m_busy;
 };
 
 } /* namespace fibjs */
@@ -56,6 +56,8 @@ public:
     virtual result_t get_stack(exlib::string& retVal);
     virtual result_t get_caller(obj_ptr<Fiber_base>& retVal);
     virtual result_t get_stack_usage(int32_t& retVal);
+    virtual result_t get_deadline(double& retVal);
+    virtual result_t set_deadline(double newVal);
 
 public:
     static void FiberProcRunJavascript(void* p);
@@ -139,6 +141,7 @@ public:
     void* m_c_entry_fp_ = NULL;
     void* m_handler_ = NULL;
     bool m_termed = false;
+    double m_deadline = 0;
 
 private:
     int64_t m_id;
@@ -10,6 +10,8 @@
 
 #ifndef _WIN32
 #include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <limits.h>
 #endif
 
 #define MAX_PATH_LENGTH 4096
@@ -30,6 +32,10 @@
 #define X_OK 1
 #endif
 
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
 namespace fibjs {
 
 class File : public File_base {
@@ -74,6 +80,7 @@ public:
 public:
     result_t open(exlib::string fname, exlib::string flags);
     result_t close();
+    result_t Read(int32_t bytes, obj_ptr<Buffer_base>& retVal);
     result_t Write(const char* p, int32_t sz);
 
     result_t Write(exlib::string data)
@@ -137,6 +144,86 @@ inline result_t file_open(exlib::string fname, exlib::string flags, int32_t mode
     return 0;
 }
 
+inline result_t file_read(int32_t fd, void* data, int32_t length, int32_t& retVal)
+{
+    char* p = (char*)data;
+    int32_t sz = length;
+
+    while (sz) {
+        int32_t n = (int32_t)::_read(fd, p, sz > STREAM_BUFF_SIZE ? STREAM_BUFF_SIZE : sz);
+        if (n < 0)
+            return CHECK_ERROR(LastError());
+        if (n == 0)
+            break;
+
+        sz -= n;
+        p += n;
+    }
+
+    retVal = length - sz;
+    return 0;
+}
+
+inline result_t file_readv(int32_t fd, std::vector<obj_ptr<Buffer>>& bufs, int32_t& retVal)
+{
+    int64_t total = 0;
+
+#ifdef _WIN32
+    for (size_t i = 0; i < bufs.size(); i++) {
+        int32_t len = (int32_t)bufs[i]->length();
+        int32_t n;
+
+        result_t hr = file_read(fd, bufs[i]->data(), len, n);
+        if (hr < 0)
+            return hr;
+
+        total += n;
+        if (n < len)
+            break;
+    }
+#else
+    std::vector<struct iovec> iov(bufs.size());
+    for (size_t i = 0; i < bufs.size(); i++) {
+        iov[i].iov_base = bufs[i]->data();
+        iov[i].iov_len = bufs[i]->length();
+    }
+
+    size_t pos = 0;
+    while (pos < iov.size()) {
+        if (iov[pos].iov_len == 0) {
+            pos++;
+            continue;
+        }
+
+        size_t cnt = iov.size() - pos;
+        if (cnt > IOV_MAX)
+            cnt = IOV_MAX;
+
+        ssize_t n = ::readv(fd, &iov[pos], (int32_t)cnt);
+        if (n < 0)
+            return CHECK_ERROR(LastError());
+        if (n == 0)
+            break;
+
+        total += n;
+
+        while (n > 0 && pos < iov.size()) {
+            if ((size_t)n >= iov[pos].iov_len) {
+                n -= iov[pos].iov_len;
+                pos++;
+            } else {
+                iov[pos].iov_base = (char*)iov[pos].iov_base + n;
+                iov[pos].iov_len -= n;
+                n = 0;
+            }
+        }
+    }
+#endif
+
+    retVal = (int32_t)total;
+    return 0;
+}
+
 class FileHandle : public FileHandle_base {
 public:
     FileHandle(int32_t fd)
@@ -150,6 +237,7 @@ public:
     virtual result_t chmod(int32_t mode, AsyncEvent* ac);
     virtual result_t stat(obj_ptr<Stat_base>& retVal, AsyncEvent* ac);
     virtual result_t read(Buffer_base* buffer, int32_t offset, int32_t length, int32_t position, int32_t& retVal, AsyncEvent* ac);
+    virtual result_t readv(v8::Local<v8::Array> buffers, int32_t position, int32_t& retVal, AsyncEvent* ac);
     virtual result_t write(Buffer_base* buffer, int32_t offset, int32_t length, int32_t position, int32_t& retVal, AsyncEvent* ac);
     virtual result_t write(exlib::string string, int32_t position, exlib::string encoding, int32_t& retVal, AsyncEvent* ac);
     virtual result_t close(AsyncEvent* ac);
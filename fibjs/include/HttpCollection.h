@@ -9,6 +9,7 @@
 
 #include "ifs/HttpCollection.h"
 #include "QuickArray.h"
+#include "http_parser.h"
 
 namespace fibjs {
 
@@ -51,24 +52,60 @@ public:
 
     result_t add(exlib::string& name, exlib::string value)
     {
-        if (m_map.size() < m_count + 1)
-            m_map.resize(m_count + 1);
+        item& _item = append(http_name_hash(name.c_str(), (int32_t)name.length()));
 
-        m_map[m_count] = pair(name, value);
-        m_count++;
+        _item.m_name = name;
+        _item.m_value = value;
 
         return 0;
     }
 
+    // add a header whose name and value are slices of raw()
+    void add_view(int32_t name, int32_t szName, int32_t value, int32_t szValue)
+    {
+        item& _item = append(http_name_hash(m_raw.c_str() + name, szName));
+
+        _item.m_view = true;
+        _item.m_name_off = name;
+        _item.m_name_len = szName;
+        _item.m_value_off = value;
+        _item.m_value_len = szValue;
+    }
+
+    const exlib::string& raw() const
+    {
+        return m_raw;
+    }
+
+    // buffer the received header block is read into, existing slices are
+    // materialized first so that it can be replaced safely
+    exlib::string& reset_raw()
+    {
+        size_t i;
+
+        for (i = 0; i < m_count; i++) {
+            item& _item = m_map[i];
+            if (_item.m_view) {
+                _item.m_name = name(_item);
+                _item.m_value = value(_item);
+                _item.m_view = false;
+            }
+        }
+
+        m_raw.clear();
+        return m_raw;
+    }
+
     result_t first(exlib::string name, exlib::string& retVal)
     {
+        key _key(name);
         size_t i;
 
         for (i = 0; i < m_count; i++) {
-            pair& _pair = m_map[i];
+            item& _item = m_map[i];
 
-            if (!qstricmp(_pair.first.c_str(), name.c_str())) {
-                retVal = _pair.second;
+            if (match(_item, _key)) {
+                retVal = value(_item);
                 return 0;
             }
         }
@@ -79,13 +116,14 @@ public:
     result_t all(exlib::string name, obj_ptr<NArray>& retVal)
     {
         obj_ptr<NArray> list = new NArray();
+        key _key(name);
         size_t i;
 
         for (i = 0; i < m_count; i++) {
-            pair& _pair = m_map[i];
+            item& _item = m_map[i];
 
-            if (!qstricmp(_pair.first.c_str(), name.c_str()))
-                list->append(_pair.second);
+            if (match(_item, _key))
+                list->append(value(_item));
         }
 
         retVal = list;
@@ -100,8 +138,8 @@ public:
         map->enable_multi_value();
 
         for (i = 0; i < m_count; i++) {
-            pair& _pair = m_map[i];
-            map->add(_pair.first, _pair.second);
+            item& _item = m_map[i];
+            map->add(name(_item), value(_item));
         }
 
         retVal = map;
@@ -115,9 +153,95 @@ public:
     result_t parseCookie(exlib::string& str);
 
 private:
-    typedef std::pair<exlib::string, exlib::string> pair;
-    std::vector<pair> m_map;
+    // an entry either owns its strings or is a slice of m_raw, slices are
+    // only turned into strings when they are read. m_hash is the case
+    // insensitive hash of the name and is compared before the names.
+    class item {
+    public:
+        item()
+            : m_hash(0)
+            , m_view(false)
+        {
+        }
+
+    public:
+        exlib::string m_name;
+        exlib::string m_value;
+        int32_t m_name_off;
+        int32_t m_name_len;
+        int32_t m_value_off;
+        int32_t m_value_len;
+        uint32_t m_hash;
+        bool m_view;
+    };
+
+    class key {
+    public:
+        key(exlib::string& name)
+            : m_name(name.c_str())
+            , m_len((int32_t)name.length())
+            , m_hash(http_name_hash(m_name, m_len))
+        {
+        }
+
+    public:
+        const char* m_name;
+        int32_t m_len;
+        uint32_t m_hash;
+    };
+
+    item& append(uint32_t hash)
+    {
+        if (m_map.size() < m_count + 1)
+            m_map.resize(m_count + 1);
+
+        item& _item = m_map[m_count++];
+        _item.m_hash = hash;
+        _item.m_view = false;
+
+        return _item;
+    }
+
+    const char* name_ptr(const item& _item) const
+    {
+        return _item.m_view ? m_raw.c_str() + _item.m_name_off : _item.m_name.c_str();
+    }
+
+    int32_t name_len(const item& _item) const
+    {
+        return _item.m_view ? _item.m_name_len : (int32_t)_item.m_name.length();
+    }
+
+    const char* value_ptr(const item& _item) const
+    {
+        return _item.m_view ? m_raw.c_str() + _item.m_value_off : _item.m_value.c_str();
+    }
+
+    int32_t value_len(const item& _item) const
+    {
+        return _item.m_view ? _item.m_value_len : (int32_t)_item.m_value.length();
+    }
+
+    exlib::string name(const item& _item) const
+    {
+        return _item.m_view ? exlib::string(name_ptr(_item), _item.m_name_len) : _item.m_name;
+    }
+
+    exlib::string value(const item& _item) const
+    {
+        return _item.m_view ? exlib::string(value_ptr(_item), _item.m_value_len) : _item.m_value;
+    }
+
+    bool match(const item& _item, const key& _key) const
+    {
+        return _item.m_hash == _key.m_hash && name_len(_item) == _key.m_len
+            && (_key.m_len == 0 || !qstricmp(name_ptr(_item), _key.m_name, _key.m_len));
+    }
+
+private:
+    std::vector<item> m_map;
     size_t m_count;
+    exlib::string m_raw;
 };
 
 } /* namespace fibjs */
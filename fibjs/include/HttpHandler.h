@@ -8,6 +8,8 @@
 #pragma once
 
 #include "ifs/HttpHandler.h"
+#include "AccessLog.h"
+#include "ConcurrencyLimiter.h"
 
 namespace fibjs {
 
@@ -25,6 +27,10 @@ public:
 public:
     // HttpHandler_base
     virtual result_t enableCrossOrigin(exlib::string allowHeaders);
+    virtual result_t enableAccessLog(v8::Local<v8::Object> opts);
+    virtual result_t disableAccessLog();
+    virtual result_t limitConcurrency(v8::Local<v8::Object> opts);
+    virtual result_t get_loadStats(v8::Local<v8::Object>& retVal);
     virtual result_t get_maxHeadersCount(int32_t& retVal);
     virtual result_t set_maxHeadersCount(int32_t newVal);
     virtual result_t get_maxHeaderSize(int32_t& retVal);
@@ -35,11 +41,26 @@ public:
     virtual result_t set_enableEncoding(bool newVal);
     virtual result_t get_serverName(exlib::string& retVal);
     virtual result_t set_serverName(exlib::string newVal);
+    virtual result_t get_headerTimeout(int32_t& retVal);
+    virtual result_t set_headerTimeout(int32_t newVal);
+    virtual result_t get_bodyTimeout(int32_t& retVal);
+    virtual result_t set_bodyTimeout(int32_t newVal);
+    virtual result_t get_idleTimeout(int32_t& retVal);
+    virtual result_t set_idleTimeout(int32_t newVal);
+    virtual result_t get_handlerTimeout(int32_t& retVal);
+    virtual result_t set_handlerTimeout(int32_t newVal);
     virtual result_t get_handler(obj_ptr<Handler_base>& retVal);
     virtual result_t set_handler(Handler_base* newVal);
 
+private:
+    obj_ptr<AccessLog> accessLog();
+    void setAccessLog(AccessLog* log);
+
 private:
     obj_ptr<Handler_base> m_hdlr;
+    obj_ptr<AccessLog> m_accessLog;
+    exlib::spinlock m_accessLogLock;
+    obj_ptr<ConcurrencyLimiter> m_limiter;
 
     bool m_crossDomain;
     exlib::string m_allowHeaders;
@@ -48,6 +69,10 @@ private:
     int32_t m_maxBodySize;
     bool m_enableEncoding;
     exlib::string m_serverName;
+    int32_t m_headerTimeout;
+    int32_t m_bodyTimeout;
+    int32_t m_idleTimeout;
+    int32_t m_handlerTimeout;
 };
 
 } /* namespace fibjs */
@@ -21,6 +21,7 @@ public:
         , m_maxHeadersCount(128)
         , m_maxHeaderSize(8192)
         , m_maxBodySize(64)
+        , m_headPos(0)
     {
         m_headers = new HttpCollection();
         clear();
@@ -70,6 +71,11 @@ public:
         AsyncEvent* ac);
     result_t readFrom(Stream_base* stm, AsyncEvent* ac);
 
+    // the start line and the header fields are read in one go into the
+    // buffer of m_headers, the fields are parsed in place by readFrom
+    result_t readHead(BufferedStream_base* stm, AsyncEvent* ac);
+    result_t readStartLine(exlib::string& retVal);
+
 public:
     void addHeader(const char* name, int32_t szName, const char* value,
         int32_t szValue);
@@ -77,6 +83,10 @@ public:
     size_t size();
     size_t getData(char* buf, size_t sz);
 
+private:
+    result_t readHeaders(int64_t& contentLength, bool& bChunked);
+
+public:
     result_t allHeader(exlib::string name, obj_ptr<NArray>& retVal)
     {
         return m_headers->all(name, retVal);
@@ -96,6 +106,8 @@ public:
     exlib::string m_origin;
     exlib::string m_encoding;
     obj_ptr<HttpCollection> m_headers;
+    int32_t m_headPos;
+    exlib::string m_headEol;
 };
 
 } /* namespace fibjs */
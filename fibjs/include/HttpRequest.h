@@ -90,6 +90,14 @@ public:
     virtual result_t get_form(obj_ptr<HttpCollection_base>& retVal);
     virtual result_t get_query(obj_ptr<HttpCollection_base>& retVal);
 
+public:
+    // readFrom in two steps, so that the head and the body can be timed apart
+    result_t readHead(Stream_base* stm, AsyncEvent* ac);
+    result_t readBody(Stream_base* stm, AsyncEvent* ac);
+
+private:
+    result_t readFrom(Stream_base* stm, bool headOnly, AsyncEvent* ac);
+
 public:
     result_t addHeader(NObject* map)
     {
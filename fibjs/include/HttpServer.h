@@ -23,10 +23,16 @@ public:
     virtual result_t get_socket(obj_ptr<Socket_base>& retVal);
     virtual result_t get_handler(obj_ptr<Handler_base>& retVal);
     virtual result_t set_handler(Handler_base* newVal);
+    virtual result_t get_maxConnections(int32_t& retVal);
+    virtual result_t set_maxConnections(int32_t newVal);
+    virtual result_t get_connections(int32_t& retVal);
 
 public:
     // HttpServer_base
     virtual result_t enableCrossOrigin(exlib::string allowHeaders);
+    virtual result_t enableAccessLog(v8::Local<v8::Object> opts);
+    virtual result_t disableAccessLog();
+    virtual result_t limitConcurrency(v8::Local<v8::Object> opts);
     virtual result_t get_maxHeadersCount(int32_t& retVal);
     virtual result_t set_maxHeadersCount(int32_t newVal);
     virtual result_t get_maxHeaderSize(int32_t& retVal);
@@ -37,6 +43,15 @@ public:
     virtual result_t set_enableEncoding(bool newVal);
     virtual result_t get_serverName(exlib::string& retVal);
     virtual result_t set_serverName(exlib::string newVal);
+    virtual result_t get_headerTimeout(int32_t& retVal);
+    virtual result_t set_headerTimeout(int32_t newVal);
+    virtual result_t get_bodyTimeout(int32_t& retVal);
+    virtual result_t set_bodyTimeout(int32_t newVal);
+    virtual result_t get_idleTimeout(int32_t& retVal);
+    virtual result_t set_idleTimeout(int32_t newVal);
+    virtual result_t get_handlerTimeout(int32_t& retVal);
+    virtual result_t set_handlerTimeout(int32_t newVal);
+    virtual result_t get_loadStats(v8::Local<v8::Object>& retVal);
 
 public:
     result_t create(exlib::string addr, int32_t port, Handler_base* hdlr);
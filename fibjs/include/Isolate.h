@@ -12,6 +12,7 @@
 #include "QuickArray.h"
 #include "utf8.h"
 #include <unordered_map>
+#include <vector>
 
 struct uv_loop_s;
 
@@ -34,6 +35,7 @@ class SandBox;
 class JSFiber;
 class HttpClient;
 class LruCache;
+class ScriptCache;
 class Stream_base;
 class ValueHolder;
 class SecureContext_base;
@@ -256,6 +258,17 @@ public:
     v8::Global<v8::Object> m_env;
 
     v8::Global<v8::Object> m_AssertionError;
+    v8::Global<v8::Object> m_snapshot_modules;
+
+    // builtin modules in the order they were first used, for --trace-builtins
+    struct BuiltinTouch {
+        const char* name;
+        uint64_t time;
+        uint64_t cost;
+    };
+
+    uint64_t m_start_time;
+    std::vector<BuiltinTouch> m_builtins;
 
     v8::Global<v8::ObjectTemplate> m_global_template;
 
@@ -266,6 +279,7 @@ public:
     bool m_intask = false;
 
     obj_ptr<HttpClient> m_httpclient;
+    obj_ptr<ScriptCache> m_script_cache;
     v8::Global<v8::Object> STATUS_CODES;
 
     obj_ptr<Stream_base> m_stdio[3];
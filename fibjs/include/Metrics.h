@@ -0,0 +1,283 @@
+/*
+ * Metrics.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "ifs/metrics.h"
+#include "ifs/Counter.h"
+#include "ifs/Gauge.h"
+#include "ifs/Histogram.h"
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace fibjs {
+
+// one time series of the process wide registry, every worker that asks for
+// the same name and labels gets the same object, updates are lock free.
+class Metric : public obj_base {
+public:
+    enum {
+        kCounter = 0,
+        kGauge = 1,
+        kHistogram = 2
+    };
+
+public:
+    Metric(int32_t type, exlib::string name, exlib::string labels)
+        : m_type(type)
+        , m_name(name)
+        , m_labels(labels)
+    {
+    }
+
+public:
+    // append the sample lines of this series in OpenMetrics text format
+    virtual void collect(exlib::string& out) = 0;
+
+public:
+    static void add(std::atomic<double>& v, double d)
+    {
+        double o = v.load(std::memory_order_relaxed);
+        while (!v.compare_exchange_weak(o, o + d, std::memory_order_relaxed))
+            ;
+    }
+
+    static int64_t now()
+    {
+        return (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+public:
+    int32_t m_type;
+    exlib::string m_name;
+    exlib::string m_labels;
+};
+
+class CounterMetric : public Metric {
+public:
+    CounterMetric(exlib::string name, exlib::string labels)
+        : Metric(kCounter, name, labels)
+        , m_value(0)
+    {
+    }
+
+public:
+    virtual void collect(exlib::string& out);
+
+public:
+    void inc(double v = 1)
+    {
+        add(m_value, v);
+    }
+
+    double value() const
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<double> m_value;
+};
+
+class GaugeMetric : public Metric {
+public:
+    typedef double (*sampler)();
+
+public:
+    GaugeMetric(exlib::string name, exlib::string labels, sampler fn = NULL)
+        : Metric(kGauge, name, labels)
+        , m_value(0)
+        , m_sampler(fn)
+    {
+    }
+
+public:
+    virtual void collect(exlib::string& out);
+
+public:
+    void set(double v)
+    {
+        m_value.store(v, std::memory_order_relaxed);
+    }
+
+    void inc(double v = 1)
+    {
+        add(m_value, v);
+    }
+
+    void dec(double v = 1)
+    {
+        add(m_value, -v);
+    }
+
+    double value() const
+    {
+        return m_sampler ? m_sampler() : m_value.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<double> m_value;
+    sampler m_sampler;
+};
+
+// log-linear HDR histogram of non-negative integers: every power of two is
+// split into 32 sub-buckets, so a recorded value is off by less than 3.2%.
+// values up to 2^42 - 1 are kept, larger ones are clamped.
+class HistogramMetric : public Metric {
+public:
+    enum {
+        kSubBits = 5,
+        kSubCount = 1 << kSubBits,
+        kMaxBits = 42,
+        kBucketCount = (kMaxBits - kSubBits + 1) * kSubCount
+    };
+
+public:
+    HistogramMetric(exlib::string name, exlib::string labels, std::vector<double>& bounds);
+
+public:
+    virtual void collect(exlib::string& out);
+
+public:
+    void observe(int64_t v)
+    {
+        if (v < 0)
+            v = 0;
+        else if (v >= (1ll << kMaxBits))
+            v = (1ll << kMaxBits) - 1;
+
+        m_counts[index(v)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        add(m_sum, (double)v);
+
+        int64_t m = m_max.load(std::memory_order_relaxed);
+        while (v > m && !m_max.compare_exchange_weak(m, v, std::memory_order_relaxed))
+            ;
+    }
+
+    int64_t count() const
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+    double sum() const
+    {
+        return m_sum.load(std::memory_order_relaxed);
+    }
+
+    double percentile(double p) const;
+
+public:
+    static int32_t index(int64_t v)
+    {
+        if (v < 2 * kSubCount)
+            return (int32_t)v;
+
+        int32_t shift = 63 - __builtin_clzll((uint64_t)v) - kSubBits;
+        return shift * kSubCount + (int32_t)(v >> shift);
+    }
+
+    static int64_t lower(int32_t idx)
+    {
+        if (idx < 2 * kSubCount)
+            return idx;
+
+        int32_t shift = idx / kSubCount - 1;
+        return (int64_t)(idx - shift * kSubCount) << shift;
+    }
+
+    static int64_t upper(int32_t idx)
+    {
+        return lower(idx + 1) - 1;
+    }
+
+private:
+    std::atomic<int64_t> m_counts[kBucketCount];
+    std::atomic<int64_t> m_count;
+    std::atomic<double> m_sum;
+    std::atomic<int64_t> m_max;
+    std::vector<double> m_bounds;
+};
+
+class Counter : public Counter_base {
+public:
+    Counter(CounterMetric* metric)
+        : m_metric(metric)
+    {
+    }
+
+public:
+    // Counter_base
+    virtual result_t get_name(exlib::string& retVal);
+    virtual result_t get_value(double& retVal);
+    virtual result_t inc(double value);
+
+private:
+    obj_ptr<CounterMetric> m_metric;
+};
+
+class Gauge : public Gauge_base {
+public:
+    Gauge(GaugeMetric* metric)
+        : m_metric(metric)
+    {
+    }
+
+public:
+    // Gauge_base
+    virtual result_t get_name(exlib::string& retVal);
+    virtual result_t get_value(double& retVal);
+    virtual result_t set(double value);
+    virtual result_t inc(double value);
+    virtual result_t dec(double value);
+
+private:
+    obj_ptr<GaugeMetric> m_metric;
+};
+
+class Histogram : public Histogram_base {
+public:
+    Histogram(HistogramMetric* metric)
+        : m_metric(metric)
+    {
+    }
+
+public:
+    // Histogram_base
+    virtual result_t get_name(exlib::string& retVal);
+    virtual result_t get_count(int64_t& retVal);
+    virtual result_t get_sum(double& retVal);
+    virtual result_t observe(double value);
+    virtual result_t percentile(double p, double& retVal);
+
+private:
+    obj_ptr<HistogramMetric> m_metric;
+};
+
+// built-in series, created on first use
+CounterMetric* metrics_counter(exlib::string name, exlib::string help, exlib::string labels = "");
+GaugeMetric* metrics_gauge(exlib::string name, exlib::string help, exlib::string labels = "",
+    GaugeMetric::sampler fn = NULL);
+HistogramMetric* metrics_histogram(exlib::string name, exlib::string help, exlib::string labels = "");
+
+HistogramMetric* metrics_http_server();
+CounterMetric* metrics_http_shed();
+HistogramMetric* metrics_http_client();
+CounterMetric* metrics_http_client_errors();
+HistogramMetric* metrics_db_query();
+CounterMetric* metrics_db_errors();
+GaugeMetric* metrics_sockets();
+CounterMetric* metrics_rejected_connections();
+HistogramMetric* metrics_loop_lag();
+CounterMetric* metrics_tls_handshakes(bool resumed);
+CounterMetric* metrics_tls_session_lookups(bool hit);
+CounterMetric* metrics_ws_compress_fallbacks();
+
+} /* namespace fibjs */
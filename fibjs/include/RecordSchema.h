@@ -0,0 +1,160 @@
+/*
+ * RecordSchema.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "ifs/MsgpackSchema.h"
+#include "ifs/JsonSchema.h"
+#include <vector>
+
+namespace fibjs {
+
+// append s to out as a quoted json string
+void json_quote(exlib::string& out, const char* s, size_t len);
+
+// per call key cache of the decoders. records of the same layout repeat the
+// same keys, each distinct key is turned into an internalized string once
+// and then reused, so objects built from the same keys in the same order
+// share one hidden class. the cache is direct mapped and only remembers the
+// last key of each slot, the key bytes must live as long as the cache.
+template <typename T>
+class KeyCache {
+public:
+    enum {
+        kSlots = 256,
+        kMaxKeyLength = 64
+    };
+
+public:
+    KeyCache()
+    {
+        for (int32_t i = 0; i < kSlots; i++)
+            m_slots[i].m_key = NULL;
+    }
+
+public:
+    template <typename F>
+    T get(const char* key, size_t len, F create)
+    {
+        if (len > kMaxKeyLength)
+            return create(key, len);
+
+        uint32_t h = 2166136261u;
+        for (size_t i = 0; i < len; i++)
+            h = (h ^ (uint8_t)key[i]) * 16777619u;
+
+        slot& s = m_slots[h % kSlots];
+        if (s.m_key && s.m_len == len && !memcmp(s.m_key, key, len))
+            return s.m_value;
+
+        s.m_key = key;
+        s.m_len = len;
+        s.m_value = create(key, len);
+
+        return s.m_value;
+    }
+
+private:
+    class slot {
+    public:
+        const char* m_key;
+        size_t m_len;
+        T m_value;
+    };
+
+    slot m_slots[kSlots];
+};
+
+// record layout compiled from an example object. a plain object field is a
+// nested record, an array holding one plain object is an array of records,
+// anything else is a free value handled by the generic codec. every field of
+// the tree gets a unique id so that one call can keep its keys in one table.
+class RecordSchema : public obj_base {
+public:
+    class field {
+    public:
+        exlib::string m_name;
+        exlib::string m_json;
+        int32_t m_id;
+        obj_ptr<RecordSchema> m_record;
+        bool m_array;
+    };
+
+public:
+    RecordSchema()
+        : m_count(0)
+    {
+    }
+
+public:
+    static result_t create(v8::Local<v8::Object> schema, obj_ptr<RecordSchema>& retVal);
+
+public:
+    int32_t find(const char* key, size_t len, int32_t hint) const
+    {
+        int32_t cnt = (int32_t)m_fields.size();
+
+        if (hint < cnt && m_fields[hint].m_name.length() == len
+            && !memcmp(m_fields[hint].m_name.c_str(), key, len))
+            return hint;
+
+        for (int32_t i = 0; i < cnt; i++)
+            if (m_fields[i].m_name.length() == len && !memcmp(m_fields[i].m_name.c_str(), key, len))
+                return i;
+
+        return -1;
+    }
+
+    static bool is_record(v8::Local<v8::Value> v)
+    {
+        return v->IsObject() && !v->IsArray() && !v->IsFunction() && !v->IsDate()
+            && !v->IsRegExp() && !v->IsArrayBufferView() && !v->IsArrayBuffer()
+            && !v->IsMap() && !v->IsSet() && !v->IsStringObject()
+            && !v->IsNumberObject() && !v->IsBooleanObject();
+    }
+
+private:
+    result_t parse(Isolate* isolate, v8::Local<v8::Object> o, int32_t& id, int32_t depth);
+
+public:
+    std::vector<field> m_fields;
+    int32_t m_count;
+};
+
+class MsgpackSchema : public MsgpackSchema_base {
+public:
+    MsgpackSchema(RecordSchema* schema)
+        : m_schema(schema)
+    {
+    }
+
+public:
+    // MsgpackSchema_base
+    virtual result_t encode(v8::Local<v8::Value> data, obj_ptr<Buffer_base>& retVal);
+    virtual result_t decode(Buffer_base* data, v8::Local<v8::Value>& retVal);
+
+private:
+    obj_ptr<RecordSchema> m_schema;
+};
+
+class JsonSchema : public JsonSchema_base {
+public:
+    JsonSchema(RecordSchema* schema)
+        : m_schema(schema)
+    {
+    }
+
+public:
+    // JsonSchema_base
+    virtual result_t encode(v8::Local<v8::Value> data, exlib::string& retVal);
+    virtual result_t decode(exlib::string data, v8::Local<v8::Value>& retVal);
+
+private:
+    obj_ptr<RecordSchema> m_schema;
+};
+
+} /* namespace fibjs */
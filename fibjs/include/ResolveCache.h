@@ -0,0 +1,47 @@
+/*
+ * ResolveCache.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "utils.h"
+
+namespace fibjs {
+
+// process wide cache of what require() learns from the file system while it
+// resolves a module: real paths, directory listings, the entry named by
+// package.json and the file an id resolved to. it is shared by every
+// SandBox and Worker, and is only enabled by --resolve-cache.
+class ResolveCache {
+public:
+    static bool enabled();
+
+    // bumped whenever the cache is invalidated. take it before probing the
+    // file system and pass it to set_package or set_resolved, what was
+    // probed is dropped if a change came in meanwhile.
+    static int64_t generation();
+
+    // false only when the listing of its directory says fname is not there
+    static bool exists(exlib::string fname);
+    static result_t realpath(exlib::string fname, exlib::string& retVal);
+
+    // the entry of the package in dir, hr is CALL_E_FILE_NOT_FOUND when it
+    // has none. returns false when the package was not seen yet.
+    static bool get_package(exlib::string dir, result_t& hr, exlib::string& retVal);
+    static void set_package(int64_t generation, exlib::string dir, result_t hr, exlib::string main);
+
+    // the file an id resolved to, key is the extensions the sandbox loads,
+    // base and id joined by '\n'
+    static bool get_resolved(exlib::string key, exlib::string& retVal);
+    static void set_resolved(int64_t generation, exlib::string key, exlib::string fname);
+
+    static void clear();
+
+    // write the resolved ids to the file of --resolve-cache=file
+    static void save();
+};
+
+} /* namespace fibjs */
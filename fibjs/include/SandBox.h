@@ -76,6 +76,13 @@ public:
     void installBuffer();
     void attachBuffer();
 
+public:
+    // a builtin module is only built when its exports are first read
+    static void lazy_builtin(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info);
+    static void lazy_builtin_promises(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info);
+    void installBuiltin(exlib::string fname, RootModule* pModule, v8::AccessorNameGetterCallback getter);
+    static void traceBuiltins(Isolate* isolate);
+
 public:
     class Context {
     public:
@@ -170,6 +177,7 @@ public:
     result_t resolveFile(exlib::string& fname, obj_ptr<Buffer_base>& data,
         v8::Local<v8::Value>* retVal);
     result_t resolveId(exlib::string& id, v8::Local<v8::Value>& retVal);
+    exlib::string resolve_key(exlib::string key);
     result_t resolveModule(exlib::string base, exlib::string& id, obj_ptr<Buffer_base>& data,
         v8::Local<v8::Value>& retVal);
     result_t resolve(exlib::string base, exlib::string& id, obj_ptr<Buffer_base>& data,
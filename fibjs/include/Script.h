@@ -8,22 +8,54 @@
 #pragma once
 
 #include "ifs/Script.h"
+#include <list>
+#include <unordered_map>
 
 namespace fibjs {
 
+// scripts compiled in an isolate, keyed by their origin and source. an
+// UnboundScript does not belong to any context, so a script that is
+// evaluated again, in any context, does not compile again.
+class ScriptCache : public obj_base {
+public:
+    v8::Local<v8::UnboundScript> get(Isolate* isolate, const exlib::string& key);
+    void put(Isolate* isolate, const exlib::string& key, v8::Local<v8::UnboundScript> script);
+
+private:
+    class entry {
+    public:
+        v8::Global<v8::UnboundScript> m_script;
+        std::list<exlib::string>::iterator m_lru;
+    };
+
+    std::unordered_map<exlib::string, entry> m_scripts;
+    std::list<exlib::string> m_lru;
+};
+
 class Script : public Script_base {
 
+public:
+    Script()
+        : m_cachedDataRejected(false)
+    {
+    }
+
 public:
     // Script_base
     virtual result_t runInContext(v8::Local<v8::Object> contextifiedObject, v8::Local<v8::Object> opts, v8::Local<v8::Value>& retVal);
     virtual result_t runInNewContext(v8::Local<v8::Object> contextObject, v8::Local<v8::Object> opts, v8::Local<v8::Value>& retVal);
     virtual result_t runInThisContext(v8::Local<v8::Object> opts, v8::Local<v8::Value>& retVal);
+    virtual result_t createCachedData(obj_ptr<Buffer_base>& retVal);
+    virtual result_t get_cachedData(obj_ptr<Buffer_base>& retVal);
+    virtual result_t get_cachedDataRejected(bool& retVal);
 
 public:
     result_t init(exlib::string code, v8::Local<v8::Object> opts);
 
 private:
     v8::Global<v8::UnboundScript> m_script;
+    obj_ptr<Buffer_base> m_cachedData;
+    bool m_cachedDataRejected;
 };
 
 }
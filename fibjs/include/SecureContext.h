@@ -30,6 +30,7 @@ public:
     result_t SetRootCerts();
     result_t init(v8::Local<v8::Object> options, bool isServer);
     SSL_CTX* ctx() { return m_ctx; }
+    uint32_t id() { return m_id; }
 
 private:
     void init_ctx(const SSL_METHOD* method);
@@ -44,6 +45,7 @@ private:
 
 private:
     SSLCtxPointer m_ctx;
+    uint32_t m_id;
     obj_ptr<X509Certificate_base> m_ca;
     obj_ptr<X509Certificate_base> m_cert;
     obj_ptr<KeyObject_base> m_key;
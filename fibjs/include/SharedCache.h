@@ -0,0 +1,255 @@
+/*
+ * SharedCache.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "ifs/SharedCache.h"
+#include <unordered_map>
+#include <vector>
+
+namespace fibjs {
+
+class SharedCache : public SharedCache_base {
+public:
+    enum {
+        kString = 0,
+        kBuffer = 1,
+        kPacked = 2
+    };
+
+    enum {
+        kWindow = 0,
+        kProbation = 1,
+        kProtected = 2
+    };
+
+    class Entry {
+    public:
+        Entry(exlib::string key, uint64_t hash)
+            : m_key(key)
+            , m_hash(hash)
+            , m_type(kString)
+            , m_queue(kWindow)
+            , m_expire(0)
+            , m_prev(NULL)
+            , m_next(NULL)
+        {
+        }
+
+    public:
+        int64_t bytes() const
+        {
+            return (int64_t)(sizeof(Entry) + m_key.length() + m_value.length());
+        }
+
+    public:
+        exlib::string m_key;
+        uint64_t m_hash;
+        exlib::string m_value;
+        int32_t m_type;
+        int32_t m_queue;
+        int64_t m_expire;
+        Entry* m_prev;
+        Entry* m_next;
+    };
+
+    class Queue {
+    public:
+        Queue()
+            : m_head(NULL)
+            , m_tail(NULL)
+            , m_count(0)
+            , m_bytes(0)
+        {
+        }
+
+    public:
+        void push_front(Entry* e)
+        {
+            e->m_prev = NULL;
+            e->m_next = m_head;
+            if (m_head)
+                m_head->m_prev = e;
+            else
+                m_tail = e;
+            m_head = e;
+
+            m_count++;
+            m_bytes += e->bytes();
+        }
+
+        void remove(Entry* e)
+        {
+            if (e->m_prev)
+                e->m_prev->m_next = e->m_next;
+            else
+                m_head = e->m_next;
+
+            if (e->m_next)
+                e->m_next->m_prev = e->m_prev;
+            else
+                m_tail = e->m_prev;
+
+            e->m_prev = e->m_next = NULL;
+
+            m_count--;
+            m_bytes -= e->bytes();
+        }
+
+        void clear()
+        {
+            m_head = m_tail = NULL;
+            m_count = 0;
+            m_bytes = 0;
+        }
+
+    public:
+        Entry* m_head;
+        Entry* m_tail;
+        int32_t m_count;
+        int64_t m_bytes;
+    };
+
+    class Sketch {
+    public:
+        void init(int64_t width);
+        int32_t frequency(uint64_t hash) const;
+        void increment(uint64_t hash);
+
+    private:
+        static uint64_t index(uint64_t hash, int32_t i);
+
+    private:
+        std::vector<uint8_t> m_table;
+        uint64_t m_mask;
+        int64_t m_additions;
+        int64_t m_sampleSize;
+    };
+
+    class Loader : public obj_base {
+    public:
+        exlib::Event m_ready;
+    };
+
+    class Shard {
+    public:
+        Shard()
+            : m_maxBytes(0)
+            , m_maxEntries(0)
+            , m_hits(0)
+            , m_misses(0)
+            , m_evictions(0)
+            , m_rejections(0)
+            , m_expirations(0)
+            , m_loads(0)
+            , m_waits(0)
+            , m_windowBytes(0)
+            , m_windowEntries(0)
+            , m_protectedBytes(0)
+            , m_protectedEntries(0)
+        {
+        }
+
+        ~Shard()
+        {
+            clear();
+        }
+
+    public:
+        void init(int64_t maxBytes, int32_t maxEntries);
+        Entry* find(const exlib::string& key, uint64_t hash, int64_t now, bool touch);
+        bool put(const exlib::string& key, uint64_t hash, int32_t type, exlib::string& value,
+            int64_t expire, bool replace);
+        void erase(Entry* e);
+        void clear();
+
+    private:
+        Queue& queue(int32_t n)
+        {
+            return n == kWindow ? m_window : (n == kProbation ? m_probation : m_protected);
+        }
+
+        void touch(Entry* e);
+        void admit();
+        void evict(Entry* e);
+        bool window_full() const;
+        bool protected_full() const;
+        bool full() const;
+
+    public:
+        exlib::spinlock m_lock;
+        std::unordered_map<exlib::string, Entry*> m_map;
+        std::unordered_map<exlib::string, obj_ptr<Loader>> m_loading;
+
+        Queue m_window;
+        Queue m_probation;
+        Queue m_protected;
+        Sketch m_sketch;
+
+        int64_t m_maxBytes;
+        int32_t m_maxEntries;
+
+        int64_t m_hits;
+        int64_t m_misses;
+        int64_t m_evictions;
+        int64_t m_rejections;
+        int64_t m_expirations;
+        int64_t m_loads;
+        int64_t m_waits;
+
+    private:
+        int64_t m_windowBytes;
+        int32_t m_windowEntries;
+        int64_t m_protectedBytes;
+        int32_t m_protectedEntries;
+    };
+
+    class Store : public obj_base {
+    public:
+        Store(exlib::string name, int64_t maxBytes, int32_t maxEntries, int32_t timeout, int32_t shards);
+
+    public:
+        Shard& shard(uint64_t hash)
+        {
+            return m_shards[hash % m_shards.size()];
+        }
+
+    public:
+        exlib::string m_name;
+        int32_t m_timeout;
+        std::vector<Shard> m_shards;
+    };
+
+public:
+    SharedCache(Store* store)
+        : m_store(store)
+    {
+    }
+
+public:
+    // SharedCache_base
+    virtual result_t get_name(exlib::string& retVal);
+    virtual result_t get_size(int32_t& retVal);
+    virtual result_t get_bytes(int64_t& retVal);
+    virtual result_t get_stats(v8::Local<v8::Object>& retVal);
+    virtual result_t clear();
+    virtual result_t has(exlib::string name, bool& retVal);
+    virtual result_t get(exlib::string name, v8::Local<v8::Value>& retVal);
+    virtual result_t get(exlib::string name, v8::Local<v8::Function> updater, v8::Local<v8::Value>& retVal);
+    virtual result_t set(exlib::string name, v8::Local<v8::Value> value, int32_t timeout);
+    virtual result_t remove(exlib::string name);
+
+private:
+    result_t encode(v8::Local<v8::Value> value, int32_t& type, exlib::string& data);
+    result_t decode(int32_t type, const exlib::string& data, v8::Local<v8::Value>& retVal);
+    result_t store(exlib::string& name, uint64_t hash, v8::Local<v8::Value> value, int32_t timeout, bool replace);
+
+private:
+    obj_ptr<Store> m_store;
+};
+
+} /* namespace fibjs */
@@ -0,0 +1,25 @@
+/*
+ * Snapshot.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+namespace fibjs {
+
+// slots of the data attached to the default context of the startup snapshot
+enum {
+    kSnapshotAssertionError = 0,
+    kSnapshotModules = 1
+};
+
+// the blob every isolate is created from. it is built once per process, or
+// loaded from --snapshot-blob, and --build-snapshot writes it out and exits.
+const v8::StartupData* startup_snapshot();
+const intptr_t* snapshot_external_references();
+
+v8::Local<v8::Object> compile_AssertionError(v8::Isolate* isolate, v8::Local<v8::Context> context);
+
+} /* namespace fibjs */
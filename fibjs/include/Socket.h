@@ -11,6 +11,7 @@
 #include "inetAddr.h"
 #include "AsyncIO.h"
 #include "Timer.h"
+#include "Metrics.h"
 
 namespace fibjs {
 
@@ -25,6 +26,7 @@ public:
         , m_bBind(FALSE)
 #endif
     {
+        metrics_sockets()->inc();
     }
 
     Socket(SOCKET s, int32_t family)
@@ -34,6 +36,7 @@ public:
         , m_bBind(FALSE)
 #endif
     {
+        metrics_sockets()->inc();
     }
 
     virtual ~Socket();
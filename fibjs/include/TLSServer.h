@@ -23,6 +23,9 @@ public:
     virtual result_t get_socket(obj_ptr<Socket_base>& retVal);
     virtual result_t get_handler(obj_ptr<Handler_base>& retVal);
     virtual result_t set_handler(Handler_base* newVal);
+    virtual result_t get_maxConnections(int32_t& retVal);
+    virtual result_t set_maxConnections(int32_t newVal);
+    virtual result_t get_connections(int32_t& retVal);
 
 public:
     // TLSServer_base
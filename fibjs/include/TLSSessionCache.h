@@ -0,0 +1,68 @@
+/*
+ * TLSSessionCache.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "crypto_util.h"
+#include <list>
+#include <unordered_map>
+
+namespace fibjs {
+
+// process wide cache of client sessions, shared by every isolate. the key is
+// made of the secure context, the peer address and the server name, so a
+// session is only offered again to the same server under the same settings.
+// tls 1.3 tickets are taken out on use, the server sends fresh ones on every
+// connection, tls 1.2 sessions stay until they expire or are pushed out.
+class TLSSessionCache {
+public:
+    TLSSessionCache()
+        : m_size(1024)
+        , m_timeout(300)
+    {
+    }
+
+public:
+    static TLSSessionCache* current();
+
+    // SSL_CTX_sess_set_new_cb callback of the secure contexts
+    static int32_t new_session(SSL* ssl, SSL_SESSION* sess);
+
+public:
+    // return a new reference or NULL
+    SSL_SESSION* get(const exlib::string& key);
+    // take over the reference of sess on success
+    bool put(const exlib::string& key, SSL_SESSION* sess);
+
+    int32_t count();
+
+    int32_t get_size();
+    void set_size(int32_t size);
+    int32_t get_timeout();
+    void set_timeout(int32_t timeout);
+
+private:
+    class entry {
+    public:
+        exlib::string m_key;
+        SSL_SESSION* m_sess;
+        int64_t m_expire;
+    };
+
+private:
+    void erase(std::list<entry>::iterator it);
+    void trim();
+
+private:
+    exlib::spinlock m_lock;
+    std::list<entry> m_lru;
+    std::unordered_map<exlib::string, std::list<entry>::iterator> m_map;
+    int32_t m_size;
+    int32_t m_timeout;
+};
+
+}
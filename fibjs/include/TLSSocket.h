@@ -29,6 +29,7 @@ public:
     virtual result_t get_remotePort(int32_t& retVal);
     virtual result_t get_localAddress(exlib::string& retVal);
     virtual result_t get_localPort(int32_t& retVal);
+    virtual result_t get_ktls(bool& retVal);
 
 public:
     // Stream_base
@@ -45,6 +46,8 @@ public:
 
 public:
     result_t init(SecureContext_base* context);
+    void enable_ktls();
+    void ktls_close_notify();
 
     static TLSSocket* FromBIO(BIO* bio)
     {
@@ -83,6 +86,8 @@ public:
     int32_t m_inpos = 0;
     long m_eof = 0;
     exlib::atomic m_closed;
+    bool m_ktls = false;
+    exlib::string m_session_key;
 
 public:
     exlib::Locker m_read_lock;
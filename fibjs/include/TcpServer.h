@@ -27,6 +27,9 @@ public:
     virtual result_t get_socket(obj_ptr<Socket_base>& retVal);
     virtual result_t get_handler(obj_ptr<Handler_base>& retVal);
     virtual result_t set_handler(Handler_base* newVal);
+    virtual result_t get_maxConnections(int32_t& retVal);
+    virtual result_t set_maxConnections(int32_t newVal);
+    virtual result_t get_connections(int32_t& retVal);
 
 public:
     class Holder : public object_base {
@@ -39,6 +42,8 @@ public:
 
 private:
     bool m_running;
+    int32_t m_maxConnections;
+    exlib::atomic m_connections;
     obj_ptr<Socket_base> m_socket;
     obj_ptr<Handler_base> m_hdlr;
 };
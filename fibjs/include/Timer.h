@@ -8,6 +8,7 @@
 #pragma once
 
 #include "ifs/Timer.h"
+#include "ifs/Stream.h"
 #include "Fiber.h"
 #include <vector>
 
@@ -113,6 +114,34 @@ private:
     exlib::atomic m_cancel;
 };
 
+// closes a stream when the time is up. unlike a socket timeout it bounds a
+// whole exchange rather than a single read.
+class StreamTimer : public Timer {
+public:
+    StreamTimer(int32_t timeout, Stream_base* stm)
+        : Timer(timeout)
+        , m_stm(stm)
+        , m_fired(0)
+    {
+    }
+
+public:
+    virtual void on_timer()
+    {
+        m_fired.xchg(1);
+        m_stm->cc_close();
+    }
+
+    bool fired()
+    {
+        return m_fired != 0;
+    }
+
+private:
+    obj_ptr<Stream_base> m_stm;
+    exlib::atomic m_fired;
+};
+
 class JSTimer : public Timer {
 public:
     JSTimer(v8::Local<v8::Function> callback, OptArgs& args, int32_t timeout = 0,
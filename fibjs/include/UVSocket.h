@@ -11,6 +11,7 @@
 #include "inetAddr.h"
 #include "AsyncUV.h"
 #include "UVStream.h"
+#include "Metrics.h"
 
 namespace fibjs {
 
@@ -21,6 +22,12 @@ public:
     UVSocket(int32_t family)
         : m_family(family)
     {
+        metrics_sockets()->inc();
+    }
+
+    ~UVSocket()
+    {
+        metrics_sockets()->dec();
     }
 
 public:
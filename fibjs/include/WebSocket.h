@@ -10,7 +10,8 @@
 #include "ifs/WebSocket.h"
 #include "ifs/ws.h"
 #include "ifs/Stream.h"
-#include "ZlibStream.h"
+#include "WebSocketDeflate.h"
+#include <atomic>
 
 namespace fibjs {
 
@@ -27,9 +28,15 @@ public:
         , m_compress(false)
         , m_enableCompress(enableCompress)
         , m_maxSize(maxSize)
+        , m_deflateBits(15)
+        , m_inflateBits(15)
+        , m_deflateTakeover(true)
+        , m_inflateTakeover(true)
+        , m_compressMemory(0)
         , m_readyState(ws_base::C_CONNECTING)
         , m_closeState(ws_base::C_OPEN)
         , m_ioState(1)
+        , m_frameBuffered(0)
     {
     }
 
@@ -41,9 +48,15 @@ public:
         , m_compress(false)
         , m_enableCompress(enableCompress)
         , m_maxSize(maxSize)
+        , m_deflateBits(15)
+        , m_inflateBits(15)
+        , m_deflateTakeover(true)
+        , m_inflateTakeover(true)
+        , m_compressMemory(0)
         , m_readyState(ws_base::C_OPEN)
         , m_closeState(ws_base::C_OPEN)
         , m_ioState(1)
+        , m_frameBuffered(0)
     {
     }
 
@@ -88,7 +101,14 @@ public:
     void startRecv(Isolate* isolate);
     void endConnect(int32_t code, exlib::string reason);
     void endConnect(SeekableStream_base* body);
-    void enableCompress();
+    void enableCompress(const WebSocketDeflate& agreed);
+    // streams for one message, either the ones of the socket or pooled ones
+    obj_ptr<ws_defraw> borrowDeflate();
+    void returnDeflate(ws_defraw* zs);
+    obj_ptr<ws_infraw> borrowInflate();
+    void returnInflate(ws_infraw* zs);
+    // queue a frame built by WebSocketHub, deflated frames carry no context
+    void sendFrame(Buffer_base* frame, bool deflated);
 
     void free_mem();
 
@@ -96,8 +116,8 @@ public:
     obj_ptr<Stream_base> m_stream;
     AsyncEvent* m_ac;
 
-    obj_ptr<ZlibStream> m_deflate;
-    obj_ptr<ZlibStream> m_inflate;
+    obj_ptr<ws_defraw> m_deflate;
+    obj_ptr<ws_infraw> m_inflate;
     obj_ptr<Buffer_base> m_flushTail;
 
     obj_ptr<SeekableStream_base> m_buffer;
@@ -112,12 +132,20 @@ public:
     bool m_masked;
     bool m_compress;
     bool m_enableCompress;
+    WebSocketDeflate m_deflateOpts;
     int32_t m_maxSize;
 
+    int32_t m_deflateBits;
+    int32_t m_inflateBits;
+    bool m_deflateTakeover;
+    bool m_inflateTakeover;
+    int64_t m_compressMemory;
+
     exlib::atomic m_readyState;
     exlib::atomic m_readState;
     exlib::atomic m_closeState;
     exlib::atomic m_ioState;
+    std::atomic<int64_t> m_frameBuffered;
 
     int32_t m_code;
     exlib::string m_reason;
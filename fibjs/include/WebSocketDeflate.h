@@ -0,0 +1,108 @@
+/*
+ * WebSocketDeflate.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "ZlibStream.h"
+#include <atomic>
+
+namespace fibjs {
+
+// permessage-deflate parameters of RFC 7692, either as configured on one end
+// or as agreed on by the handshake.
+class WebSocketDeflate {
+public:
+    WebSocketDeflate()
+        : server_no_context_takeover(false)
+        , client_no_context_takeover(false)
+        , server_max_window_bits(15)
+        , client_max_window_bits(15)
+    {
+    }
+
+public:
+    // perMessageDeflate is either a Boolean or an object of parameters
+    static result_t load(Isolate* isolate, v8::Local<v8::Object> opts, bool& enable, WebSocketDeflate& retVal);
+
+    // client: the Sec-WebSocket-Extensions offer
+    exlib::string offer() const;
+    // client: check the answer of the server against the offer
+    bool parse(exlib::string answer, WebSocketDeflate& agreed) const;
+    // server: pick the first acceptable offer and build the answer
+    bool accept(exlib::string offers, WebSocketDeflate& agreed, exlib::string& answer) const;
+
+    // the same parameters, without context takeover once the budget is used up
+    WebSocketDeflate bounded() const;
+
+public:
+    bool server_no_context_takeover;
+    bool client_no_context_takeover;
+    int32_t server_max_window_bits;
+    int32_t client_max_window_bits;
+};
+
+// raw deflate/inflate streams of WebSocket, their zlib state is allocated
+// through a counting allocator so that the process knows how much memory
+// compression holds.
+class ws_defraw : public def_base {
+public:
+    ws_defraw(int32_t bits);
+
+public:
+    void reset()
+    {
+        deflateReset(&strm);
+        attach(NULL);
+    }
+
+public:
+    int32_t m_bits;
+};
+
+class ws_infraw : public inf_base {
+public:
+    ws_infraw(int32_t bits, int32_t maxSize);
+
+public:
+    void reset(int32_t maxSize)
+    {
+        inflateReset(&strm);
+        attach(NULL);
+        m_maxSize = maxSize;
+    }
+
+public:
+    int32_t m_bits;
+};
+
+// process wide pool of streams for messages that are compressed without
+// context takeover, and the budget for the zlib state of all sockets.
+class WebSocketZlib {
+public:
+    static obj_ptr<ws_defraw> deflater(int32_t bits);
+    static obj_ptr<ws_infraw> inflater(int32_t bits, int32_t maxSize);
+    static void release(ws_defraw* zs);
+    static void release(ws_infraw* zs);
+
+    // whether size more bytes of zlib state fit in the budget
+    static bool reserve(int64_t size);
+
+    // rough size of the zlib state, see zconf.h
+    static int64_t state_size(int32_t bits, bool deflate)
+    {
+        return deflate ? (1ll << (bits + 2)) + (1ll << (8 + 9)) + 6 * 1024
+                       : (1ll << bits) + 7 * 1024;
+    }
+
+public:
+    static std::atomic<int64_t> s_deflate_memory;
+    static std::atomic<int64_t> s_inflate_memory;
+    static std::atomic<int64_t> s_pooled;
+    static std::atomic<int64_t> s_limit;
+};
+
+} /* namespace fibjs */
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "ifs/Handler.h"
+#include "WebSocketDeflate.h"
 
 namespace fibjs {
 
@@ -24,6 +25,7 @@ public:
 
 public:
     bool m_enableCompress;
+    WebSocketDeflate m_deflateOpts;
     int32_t m_maxSize;
 };
 
@@ -0,0 +1,55 @@
+/*
+ * WebSocketHub.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "ifs/WebSocketHub.h"
+#include "WebSocket.h"
+#include "Buffer.h"
+#include <unordered_map>
+#include <vector>
+
+namespace fibjs {
+
+class WebSocketHub : public WebSocketHub_base {
+public:
+    WebSocketHub(int64_t maxBuffered)
+        : m_maxBuffered(maxBuffered)
+        , m_published(0)
+        , m_frames(0)
+        , m_encoded(0)
+        , m_bytes(0)
+        , m_evicted(0)
+    {
+    }
+
+public:
+    // WebSocketHub_base
+    virtual result_t subscribe(WebSocket_base* sock, exlib::string topic);
+    virtual result_t unsubscribe(WebSocket_base* sock, exlib::string topic);
+    virtual result_t publish(exlib::string topic, exlib::string data, int32_t& retVal);
+    virtual result_t publish(exlib::string topic, Buffer_base* data, int32_t& retVal);
+    virtual result_t count(exlib::string topic, int32_t& retVal);
+    virtual result_t get_stats(v8::Local<v8::Object>& retVal);
+
+private:
+    result_t publish(exlib::string topic, int32_t type, const uint8_t* data, size_t len, int32_t& retVal);
+
+private:
+    typedef std::unordered_map<WebSocket*, obj_ptr<WebSocket>> Subscribers;
+
+    std::unordered_map<exlib::string, Subscribers> m_topics;
+    int64_t m_maxBuffered;
+
+    int64_t m_published;
+    int64_t m_frames;
+    int64_t m_encoded;
+    int64_t m_bytes;
+    int64_t m_evicted;
+};
+
+} /* namespace fibjs */
@@ -0,0 +1,183 @@
+/*
+ * WorkerPool.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "ifs/WorkerPool.h"
+#include "WorkerMessage.h"
+#include <deque>
+#include <vector>
+
+namespace fibjs {
+
+class WorkerPool : public WorkerPool_base {
+public:
+    class Task : public obj_base {
+    public:
+        Task(exlib::string fn, v8::Local<v8::Array> args)
+            : m_fn(fn)
+            , m_ac(NULL)
+            , m_queued(0)
+        {
+            m_args = new WorkerMessage(args);
+        }
+
+    public:
+        exlib::string m_fn;
+        obj_ptr<WorkerMessage> m_args;
+        obj_ptr<WorkerMessage> m_result;
+        AsyncEvent* m_ac;
+        uint64_t m_queued;
+    };
+
+    class Core;
+
+    class Slot : public obj_base {
+    public:
+        Slot(Core* core, int32_t index)
+            : m_core(core)
+            , m_index(index)
+            , m_isolate(NULL)
+        {
+        }
+
+    public:
+        void push(Task* task)
+        {
+            m_lock.lock();
+            m_queue.push_back(task);
+            m_lock.unlock();
+        }
+
+        bool pop_front(obj_ptr<Task>& task)
+        {
+            bool found = false;
+
+            m_lock.lock();
+            if (!m_queue.empty()) {
+                task = m_queue.front();
+                m_queue.pop_front();
+                found = true;
+            }
+            m_lock.unlock();
+
+            return found;
+        }
+
+        bool pop_back(obj_ptr<Task>& task)
+        {
+            bool found = false;
+
+            m_lock.lock();
+            if (!m_queue.empty()) {
+                task = m_queue.back();
+                m_queue.pop_back();
+                found = true;
+            }
+            m_lock.unlock();
+
+            return found;
+        }
+
+        void drain(std::deque<obj_ptr<Task>>& tasks)
+        {
+            m_lock.lock();
+            tasks.swap(m_queue);
+            m_lock.unlock();
+        }
+
+        int32_t depth()
+        {
+            int32_t n;
+
+            m_lock.lock();
+            n = (int32_t)m_queue.size();
+            m_lock.unlock();
+
+            return n;
+        }
+
+    public:
+        void start(bool file_system, bool safe_buffer);
+
+    private:
+        static result_t worker_fiber(Slot* slot);
+        void _main();
+        result_t invoke(v8::Local<v8::Object> exports, Task* task);
+
+    public:
+        Core* m_core;
+        int32_t m_index;
+        Isolate* m_isolate;
+        exlib::Semaphore m_sem;
+        exlib::atomic m_busy;
+        exlib::string m_error;
+
+    private:
+        exlib::spinlock m_lock;
+        std::deque<obj_ptr<Task>> m_queue;
+    };
+
+    class Core : public obj_base {
+    public:
+        Core(exlib::string path)
+            : m_path(path)
+            , m_waitTotal(0)
+            , m_waitMax(0)
+            , m_runTotal(0)
+            , m_runMax(0)
+            , m_samples(0)
+        {
+        }
+
+    public:
+        void post(Task* task);
+        bool next(Slot* self, obj_ptr<Task>& task, bool& stolen);
+        int32_t cancel();
+        void close();
+        void record(uint64_t wait, uint64_t run, bool stolen, bool ok);
+
+    public:
+        exlib::string m_path;
+        std::vector<obj_ptr<Slot>> m_slots;
+        exlib::atomic m_closed;
+        exlib::atomic m_cursor;
+
+        exlib::atomic m_pending;
+        exlib::atomic m_running;
+        exlib::atomic m_completed;
+        exlib::atomic m_failed;
+        exlib::atomic m_cancelled;
+        exlib::atomic m_stolen;
+
+        exlib::spinlock m_statLock;
+        uint64_t m_waitTotal;
+        uint64_t m_waitMax;
+        uint64_t m_runTotal;
+        uint64_t m_runMax;
+        int64_t m_samples;
+    };
+
+public:
+    WorkerPool(exlib::string path, int32_t size, bool file_system, bool safe_buffer);
+    ~WorkerPool();
+
+    FIBER_FREE();
+
+public:
+    // WorkerPool_base
+    virtual result_t run(exlib::string fn, v8::Local<v8::Array> args, Variant& retVal, AsyncEvent* ac);
+    virtual result_t cancel(int32_t& retVal);
+    virtual result_t close();
+    virtual result_t get_size(int32_t& retVal);
+    virtual result_t get_pending(int32_t& retVal);
+    virtual result_t get_stats(v8::Local<v8::Object>& retVal);
+
+private:
+    obj_ptr<Core> m_core;
+};
+}
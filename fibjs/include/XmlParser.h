@@ -22,6 +22,14 @@ public:
     {
     }
 
+public:
+    void reset()
+    {
+        m_list.clear();
+        m_now = m_document;
+        m_list.push_back(m_now);
+    }
+
 public:
     static result_t parse(XmlDocument* doc, exlib::string source);
     static result_t parseHtml(XmlDocument* doc, exlib::string source);
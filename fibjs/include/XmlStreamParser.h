@@ -0,0 +1,115 @@
+/*
+ * XmlStreamParser.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "utils.h"
+
+#include "ifs/Stream.h"
+#include "XmlParser.h"
+#include <vector>
+#include <memory>
+
+namespace fibjs {
+
+class XmlStreamParser {
+public:
+    XmlStreamParser(Isolate* isolate, v8::Local<v8::Object> handlers)
+        : m_isolate(isolate)
+        , m_handlers(handlers)
+        , m_parser(NULL)
+        , m_hr(0)
+        , m_capture(0)
+    {
+    }
+
+public:
+    static result_t parse(Stream_base* stream, v8::Local<v8::Object> handlers, v8::Local<v8::Object> opts);
+
+    void OnStartElement(const char* name, const char** atts);
+    void OnEndElement(const char* name);
+    void OnCharacterData(const char* s, int32_t len);
+    void OnProcessingInstruction(const char* target, const char* data);
+    void OnComment(const char* data);
+    void OnStartCdataSection();
+    void OnEndCdataSection();
+
+private:
+    v8::Local<v8::Function> handler(const char* name);
+    void call(v8::Local<v8::Function> func, int32_t argc, v8::Local<v8::Value>* argv);
+    void flushText();
+    bool matchPath(const char* name);
+
+private:
+    static void StartElementHandler(void* userData, const char* name,
+        const char** atts)
+    {
+        XmlStreamParser* pThis = static_cast<XmlStreamParser*>(userData);
+        pThis->OnStartElement(name, atts);
+    }
+
+    static void EndElementHandler(void* userData, const char* name)
+    {
+        XmlStreamParser* pThis = static_cast<XmlStreamParser*>(userData);
+        pThis->OnEndElement(name);
+    }
+
+    static void CharacterDataHandler(void* userData, const char* s, int32_t len)
+    {
+        XmlStreamParser* pThis = static_cast<XmlStreamParser*>(userData);
+        pThis->OnCharacterData(s, len);
+    }
+
+    static void ProcessingInstructionHandler(void* userData,
+        const char* target, const char* data)
+    {
+        XmlStreamParser* pThis = static_cast<XmlStreamParser*>(userData);
+        pThis->OnProcessingInstruction(target, data);
+    }
+
+    static void CommentHandler(void* userData, const char* data)
+    {
+        XmlStreamParser* pThis = static_cast<XmlStreamParser*>(userData);
+        pThis->OnComment(data);
+    }
+
+    static void StartCdataSectionHandler(void* userData)
+    {
+        XmlStreamParser* pThis = static_cast<XmlStreamParser*>(userData);
+        pThis->OnStartCdataSection();
+    }
+
+    static void EndCdataSectionHandler(void* userData)
+    {
+        XmlStreamParser* pThis = static_cast<XmlStreamParser*>(userData);
+        pThis->OnEndCdataSection();
+    }
+
+private:
+    Isolate* m_isolate;
+    v8::Local<v8::Object> m_handlers;
+    void* m_parser;
+    result_t m_hr;
+
+    v8::Local<v8::Function> m_onStartElement;
+    v8::Local<v8::Function> m_onEndElement;
+    v8::Local<v8::Function> m_onText;
+    v8::Local<v8::Function> m_onComment;
+    v8::Local<v8::Function> m_onProcessingInstruction;
+    v8::Local<v8::Function> m_onElement;
+
+    exlib::string m_text;
+    exlib::string m_path;
+    std::vector<size_t> m_pathStack;
+    std::vector<exlib::string> m_select;
+
+    int32_t m_capture;
+    obj_ptr<XmlDocument> m_doc;
+    std::unique_ptr<XmlParser> m_builder;
+};
+
+} /* namespace fibjs */
@@ -107,6 +107,69 @@ using X509Pointer = AutoPointer<X509, X509_free>;
 using X509ReqPointer = AutoPointer<X509_REQ, X509_REQ_free>;
 using X509ExtPointer = AutoPointer<X509_EXTENSION, X509_EXTENSION_free>;
 
+// inputs of at least this many bytes are hashed or ciphered on the async pool
+// instead of the calling fiber, smaller ones are not worth the thread hop
+#define CRYPTO_ASYNC_THRESHOLD (64 * 1024)
+
+// splits a batch of independent items into ranges and processes them on
+// several async pool workers, the first range stays on the calling worker
+// and the last range to finish posts result() to the pending call
+class CryptoBatch : public obj_base {
+public:
+    CryptoBatch(AsyncEvent* ac)
+        : m_ac(ac)
+    {
+    }
+
+public:
+    virtual void process(size_t begin, size_t end) = 0;
+    virtual result_t result() = 0;
+
+public:
+    result_t run(const std::vector<size_t>& bounds)
+    {
+        if (bounds.size() < 3) {
+            if (bounds.size() == 2)
+                process(bounds[0], bounds[1]);
+            return result();
+        }
+
+        m_pending.xchg((int32_t)bounds.size() - 1);
+        for (size_t i = 1; i < bounds.size() - 1; i++) {
+            struct _range {
+                obj_ptr<CryptoBatch> batch;
+                size_t begin;
+                size_t end;
+            };
+
+            asyncCall(
+                [](_range* r) -> result_t {
+                    r->batch->process(r->begin, r->end);
+                    r->batch->done();
+                    delete r;
+                    return 0;
+                },
+                new _range { this, bounds[i], bounds[i + 1] });
+        }
+
+        process(bounds[0], bounds[1]);
+        done();
+
+        return CALL_E_PENDDING;
+    }
+
+private:
+    void done()
+    {
+        if (m_pending.dec() == 0)
+            m_ac->post(result());
+    }
+
+private:
+    AsyncEvent* m_ac;
+    exlib::atomic m_pending;
+};
+
 result_t randomBytes(uint8_t* buf, int32_t size);
 
 const EVP_MD* _evp_md_type(const char* algo);
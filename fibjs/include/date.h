@@ -136,6 +136,8 @@ public:
     void toGMTString(exlib::string& retVal);
     void toX509String(exlib::string& retVal);
     void sqlString(exlib::string& retVal);
+    void clfString(exlib::string& retVal);
+    void isoString(exlib::string& retVal);
     void stamp(exlib::string& retVal);
 
     static int32_t timezone();
@@ -0,0 +1,84 @@
+/*
+ * http_parser.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include "qstring.h"
+#include <string.h>
+
+namespace fibjs {
+
+// split the line starting at pos, end receives the end of the line content
+// and next the start of the following line. like BufferedStream::readLine,
+// a line only ends at eol, other control bytes are part of the line.
+inline void http_next_line(const char* buf, int32_t pos, int32_t len,
+    const exlib::string& eol, int32_t& end, int32_t& next)
+{
+    const char* mk = eol.c_str();
+    int32_t mklen = (int32_t)eol.length();
+    const char* p = buf + pos;
+    const char* e = buf + len;
+
+    if (mklen == 0)
+        mklen = 1;
+
+    while ((p = (const char*)memchr(p, mk[0], e - p)) != NULL) {
+        if (e - p >= mklen && !memcmp(p, mk, mklen)) {
+            end = (int32_t)(p - buf);
+            next = end + mklen;
+            return;
+        }
+        p++;
+    }
+
+    end = next = len;
+}
+
+// split a header line buf[pos, end) into name and value. the name runs up to
+// the first whitespace or ':', whitespace may follow it before the ':' and
+// leading whitespace of the value is dropped.
+inline bool http_split_header(const char* buf, int32_t pos, int32_t end,
+    int32_t& name_len, int32_t& value, int32_t& value_len)
+{
+    int32_t p = pos;
+
+    while (p < end && buf[p] && buf[p] != ':' && !qisspace(buf[p]))
+        p++;
+
+    if (p == pos)
+        return false;
+    name_len = p - pos;
+
+    while (p < end && qisspace(buf[p]))
+        p++;
+    if (p == end || buf[p] != ':')
+        return false;
+
+    p++;
+    while (p < end && qisspace(buf[p]))
+        p++;
+
+    value = p;
+    value_len = end - p;
+
+    return true;
+}
+
+// case insensitive FNV-1a of a header name
+inline uint32_t http_name_hash(const char* name, int32_t len)
+{
+    uint32_t h = 2166136261u;
+
+    for (int32_t i = 0; i < len; i++) {
+        h ^= (uint32_t)(unsigned char)qtolower(name[i]);
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+} /* namespace fibjs */
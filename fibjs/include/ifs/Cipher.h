@@ -28,8 +28,8 @@ public:
     virtual result_t setAAD(Buffer_base* buffer, v8::Local<v8::Object> options, obj_ptr<Cipher_base>& retVal) = 0;
     virtual result_t setAAD(exlib::string buffer, v8::Local<v8::Object> options, obj_ptr<Cipher_base>& retVal) = 0;
     virtual result_t setAutoPadding(bool autoPadding, obj_ptr<Cipher_base>& retVal) = 0;
-    virtual result_t update(Buffer_base* data, exlib::string inputEncoding, exlib::string outputEncoding, v8::Local<v8::Value>& retVal) = 0;
-    virtual result_t update(exlib::string data, exlib::string inputEncoding, exlib::string outputEncoding, v8::Local<v8::Value>& retVal) = 0;
+    virtual result_t update(Buffer_base* data, exlib::string inputEncoding, exlib::string outputEncoding, Variant& retVal, AsyncEvent* ac) = 0;
+    virtual result_t update(exlib::string data, exlib::string inputEncoding, exlib::string outputEncoding, Variant& retVal, AsyncEvent* ac) = 0;
     virtual result_t final(exlib::string outputEncoding, v8::Local<v8::Value>& retVal) = 0;
 
 public:
@@ -48,6 +48,10 @@ public:
     static void s_setAutoPadding(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_update(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_final(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+public:
+    ASYNC_MEMBERVALUE4(Cipher_base, update, Buffer_base*, exlib::string, exlib::string, Variant);
+    ASYNC_MEMBERVALUE4(Cipher_base, update, exlib::string, exlib::string, exlib::string, Variant);
 };
 }
 
@@ -61,7 +65,8 @@ inline ClassInfo& Cipher_base::class_info()
         { "getAuthTag", s_getAuthTag, false, false },
         { "setAAD", s_setAAD, false, false },
         { "setAutoPadding", s_setAutoPadding, false, false },
-        { "update", s_update, false, false },
+        { "update", s_update, false, true },
+        { "updateSync", s_update, false, false },
         { "final", s_final, false, false }
     };
 
@@ -156,26 +161,32 @@ inline void Cipher_base::s_setAutoPadding(const v8::FunctionCallbackInfo<v8::Val
 
 inline void Cipher_base::s_update(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
-    v8::Local<v8::Value> vr;
+    Variant vr;
 
     METHOD_INSTANCE(Cipher_base);
     METHOD_ENTER();
 
-    METHOD_OVER(3, 1);
+    ASYNC_METHOD_OVER(3, 1);
 
     ARG(obj_ptr<Buffer_base>, 0);
     OPT_ARG(exlib::string, 1, "buffer");
     OPT_ARG(exlib::string, 2, "buffer");
 
-    hr = pInst->update(v0, v1, v2, vr);
+    if (!cb.IsEmpty())
+        hr = pInst->acb_update(v0, v1, v2, cb, args);
+    else
+        hr = pInst->ac_update(v0, v1, v2, vr);
 
-    METHOD_OVER(3, 1);
+    ASYNC_METHOD_OVER(3, 1);
 
     ARG(exlib::string, 0);
     OPT_ARG(exlib::string, 1, "utf8");
     OPT_ARG(exlib::string, 2, "buffer");
 
-    hr = pInst->update(v0, v1, v2, vr);
+    if (!cb.IsEmpty())
+        hr = pInst->acb_update(v0, v1, v2, cb, args);
+    else
+        hr = pInst->ac_update(v0, v1, v2, vr);
 
     METHOD_RETURN();
 }
@@ -0,0 +1,141 @@
+/***************************************************************************
+ *                                                                         *
+ *   This file was automatically generated using idlc.js                   *
+ *   PLEASE DO NOT EDIT!!!!                                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+/**
+ @author Leo Hoo <lion@9465.net>
+ */
+
+#include "../object.h"
+
+namespace fibjs {
+
+class ContextPool_base : public object_base {
+    DECLARE_CLASS(ContextPool_base);
+
+public:
+    // ContextPool_base
+    static result_t _new(v8::Local<v8::Object> opts, obj_ptr<ContextPool_base>& retVal, v8::Local<v8::Object> This = v8::Local<v8::Object>());
+    virtual result_t acquire(v8::Local<v8::Object> contextObject, v8::Local<v8::Object>& retVal) = 0;
+    virtual result_t release(v8::Local<v8::Object> contextObject) = 0;
+    virtual result_t get_size(int32_t& retVal) = 0;
+    virtual result_t get_available(int32_t& retVal) = 0;
+
+public:
+    template <typename T>
+    static void __new(const T& args);
+
+public:
+    static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_acquire(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_release(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_get_size(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_available(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+};
+}
+
+namespace fibjs {
+inline ClassInfo& ContextPool_base::class_info()
+{
+    static ClassData::ClassMethod s_method[] = {
+        { "acquire", s_acquire, false, false },
+        { "release", s_release, false, false }
+    };
+
+    static ClassData::ClassProperty s_property[] = {
+        { "size", s_get_size, block_set, false },
+        { "available", s_get_available, block_set, false }
+    };
+
+    static ClassData s_cd = {
+        "ContextPool", false, s__new, NULL,
+        ARRAYSIZE(s_method), s_method, 0, NULL, ARRAYSIZE(s_property), s_property, 0, NULL, NULL, NULL,
+        &object_base::class_info(),
+        false
+    };
+
+    static ClassInfo s_ci(s_cd);
+    return s_ci;
+}
+
+inline void ContextPool_base::s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    CONSTRUCT_INIT();
+    __new(args);
+}
+
+template <typename T>
+void ContextPool_base::__new(const T& args)
+{
+    obj_ptr<ContextPool_base> vr;
+
+    CONSTRUCT_ENTER();
+
+    METHOD_OVER(1, 0);
+
+    OPT_ARG(v8::Local<v8::Object>, 0, v8::Object::New(isolate->m_isolate));
+
+    hr = _new(v0, vr, args.This());
+
+    CONSTRUCT_RETURN();
+}
+
+inline void ContextPool_base::s_acquire(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    v8::Local<v8::Object> vr;
+
+    METHOD_INSTANCE(ContextPool_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 0);
+
+    OPT_ARG(v8::Local<v8::Object>, 0, v8::Object::New(isolate->m_isolate));
+
+    hr = pInst->acquire(v0, vr);
+
+    METHOD_RETURN();
+}
+
+inline void ContextPool_base::s_release(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(ContextPool_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 1);
+
+    ARG(v8::Local<v8::Object>, 0);
+
+    hr = pInst->release(v0);
+
+    METHOD_VOID();
+}
+
+inline void ContextPool_base::s_get_size(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(ContextPool_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_size(vr);
+
+    METHOD_RETURN();
+}
+
+inline void ContextPool_base::s_get_available(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(ContextPool_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_available(vr);
+
+    METHOD_RETURN();
+}
+}
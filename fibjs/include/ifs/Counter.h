@@ -0,0 +1,103 @@
+/***************************************************************************
+ *                                                                         *
+ *   This file was automatically generated using idlc.js                   *
+ *   PLEASE DO NOT EDIT!!!!                                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+/**
+ @author Leo Hoo <lion@9465.net>
+ */
+
+#include "../object.h"
+
+namespace fibjs {
+
+class Counter_base : public object_base {
+    DECLARE_CLASS(Counter_base);
+
+public:
+    // Counter_base
+    virtual result_t get_name(exlib::string& retVal) = 0;
+    virtual result_t get_value(double& retVal) = 0;
+    virtual result_t inc(double value) = 0;
+
+public:
+    static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
+    {
+        CONSTRUCT_INIT();
+
+        isolate->m_isolate->ThrowException(
+            isolate->NewString("not a constructor"));
+    }
+
+public:
+    static void s_get_name(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_value(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_inc(const v8::FunctionCallbackInfo<v8::Value>& args);
+};
+}
+
+namespace fibjs {
+inline ClassInfo& Counter_base::class_info()
+{
+    static ClassData::ClassMethod s_method[] = {
+        { "inc", s_inc, false, false }
+    };
+
+    static ClassData::ClassProperty s_property[] = {
+        { "name", s_get_name, block_set, false },
+        { "value", s_get_value, block_set, false }
+    };
+
+    static ClassData s_cd = {
+        "Counter", false, s__new, NULL,
+        ARRAYSIZE(s_method), s_method, 0, NULL, ARRAYSIZE(s_property), s_property, 0, NULL, NULL, NULL,
+        &object_base::class_info(),
+        false
+    };
+
+    static ClassInfo s_ci(s_cd);
+    return s_ci;
+}
+
+inline void Counter_base::s_get_name(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    exlib::string vr;
+
+    METHOD_INSTANCE(Counter_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_name(vr);
+
+    METHOD_RETURN();
+}
+
+inline void Counter_base::s_get_value(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    double vr;
+
+    METHOD_INSTANCE(Counter_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_value(vr);
+
+    METHOD_RETURN();
+}
+
+inline void Counter_base::s_inc(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(Counter_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 0);
+
+    OPT_ARG(double, 0, 1);
+
+    hr = pInst->inc(v0);
+
+    METHOD_VOID();
+}
+}
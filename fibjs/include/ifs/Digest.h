@@ -22,8 +22,8 @@ class Digest_base : public object_base {
 
 public:
     // Digest_base
-    virtual result_t update(Buffer_base* data, obj_ptr<Digest_base>& retVal) = 0;
-    virtual result_t update(exlib::string data, exlib::string codec, obj_ptr<Digest_base>& retVal) = 0;
+    virtual result_t update(Buffer_base* data, obj_ptr<Digest_base>& retVal, AsyncEvent* ac) = 0;
+    virtual result_t update(exlib::string data, exlib::string codec, obj_ptr<Digest_base>& retVal, AsyncEvent* ac) = 0;
     virtual result_t digest(exlib::string codec, v8::Local<v8::Value>& retVal) = 0;
     virtual result_t get_size(int32_t& retVal) = 0;
 
@@ -40,6 +40,10 @@ public:
     static void s_update(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_digest(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_get_size(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+
+public:
+    ASYNC_MEMBERVALUE2(Digest_base, update, Buffer_base*, obj_ptr<Digest_base>);
+    ASYNC_MEMBERVALUE3(Digest_base, update, exlib::string, exlib::string, obj_ptr<Digest_base>);
 };
 }
 
@@ -49,7 +53,8 @@ namespace fibjs {
 inline ClassInfo& Digest_base::class_info()
 {
     static ClassData::ClassMethod s_method[] = {
-        { "update", s_update, false, false },
+        { "update", s_update, false, true },
+        { "updateSync", s_update, false, false },
         { "digest", s_digest, false, false }
     };
 
@@ -75,18 +80,24 @@ inline void Digest_base::s_update(const v8::FunctionCallbackInfo<v8::Value>& arg
     METHOD_INSTANCE(Digest_base);
     METHOD_ENTER();
 
-    METHOD_OVER(1, 1);
+    ASYNC_METHOD_OVER(1, 1);
 
     ARG(obj_ptr<Buffer_base>, 0);
 
-    hr = pInst->update(v0, vr);
+    if (!cb.IsEmpty())
+        hr = pInst->acb_update(v0, cb, args);
+    else
+        hr = pInst->ac_update(v0, vr);
 
-    METHOD_OVER(2, 1);
+    ASYNC_METHOD_OVER(2, 1);
 
     ARG(exlib::string, 0);
     OPT_ARG(exlib::string, 1, "utf8");
 
-    hr = pInst->update(v0, v1, vr);
+    if (!cb.IsEmpty())
+        hr = pInst->acb_update(v0, v1, cb, args);
+    else
+        hr = pInst->ac_update(v0, v1, vr);
 
     METHOD_RETURN();
 }
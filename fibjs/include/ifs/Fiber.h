@@ -25,6 +25,8 @@ public:
     virtual result_t get_caller(obj_ptr<Fiber_base>& retVal) = 0;
     virtual result_t get_stack(exlib::string& retVal) = 0;
     virtual result_t get_stack_usage(int32_t& retVal) = 0;
+    virtual result_t get_deadline(double& retVal) = 0;
+    virtual result_t set_deadline(double newVal) = 0;
 
 public:
     static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
@@ -41,6 +43,8 @@ public:
     static void s_get_caller(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_get_stack(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_get_stack_usage(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_deadline(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_set_deadline(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
 };
 }
 
@@ -55,7 +59,8 @@ inline ClassInfo& Fiber_base::class_info()
         { "id", s_get_id, block_set, false },
         { "caller", s_get_caller, block_set, false },
         { "stack", s_get_stack, block_set, false },
-        { "stack_usage", s_get_stack_usage, block_set, false }
+        { "stack_usage", s_get_stack_usage, block_set, false },
+        { "deadline", s_get_deadline, s_set_deadline, false }
     };
 
     static ClassData s_cd = {
@@ -128,4 +133,27 @@ inline void Fiber_base::s_get_stack_usage(v8::Local<v8::Name> property, const v8
 
     METHOD_RETURN();
 }
+
+inline void Fiber_base::s_get_deadline(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    double vr;
+
+    METHOD_INSTANCE(Fiber_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_deadline(vr);
+
+    METHOD_RETURN();
+}
+
+inline void Fiber_base::s_set_deadline(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    METHOD_INSTANCE(Fiber_base);
+    PROPERTY_ENTER();
+    PROPERTY_VAL(double);
+
+    hr = pInst->set_deadline(v0);
+
+    PROPERTY_SET_LEAVE();
+}
 }
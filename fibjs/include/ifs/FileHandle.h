@@ -27,6 +27,7 @@ public:
     virtual result_t chmod(int32_t mode, AsyncEvent* ac) = 0;
     virtual result_t stat(obj_ptr<Stat_base>& retVal, AsyncEvent* ac) = 0;
     virtual result_t read(Buffer_base* buffer, int32_t offset, int32_t length, int32_t position, int32_t& retVal, AsyncEvent* ac) = 0;
+    virtual result_t readv(v8::Local<v8::Array> buffers, int32_t position, int32_t& retVal, AsyncEvent* ac) = 0;
     virtual result_t write(Buffer_base* buffer, int32_t offset, int32_t length, int32_t position, int32_t& retVal, AsyncEvent* ac) = 0;
     virtual result_t write(exlib::string string, int32_t position, exlib::string encoding, int32_t& retVal, AsyncEvent* ac) = 0;
     virtual result_t close(AsyncEvent* ac) = 0;
@@ -45,6 +46,7 @@ public:
     static void s_chmod(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_stat(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_read(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_readv(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_write(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_close(const v8::FunctionCallbackInfo<v8::Value>& args);
 
@@ -52,6 +54,7 @@ public:
     ASYNC_MEMBER1(FileHandle_base, chmod, int32_t);
     ASYNC_MEMBERVALUE1(FileHandle_base, stat, obj_ptr<Stat_base>);
     ASYNC_MEMBERVALUE5(FileHandle_base, read, Buffer_base*, int32_t, int32_t, int32_t, int32_t);
+    ASYNC_MEMBERVALUE3(FileHandle_base, readv, v8::Local<v8::Array>, int32_t, int32_t);
     ASYNC_MEMBERVALUE5(FileHandle_base, write, Buffer_base*, int32_t, int32_t, int32_t, int32_t);
     ASYNC_MEMBERVALUE4(FileHandle_base, write, exlib::string, int32_t, exlib::string, int32_t);
     ASYNC_MEMBER0(FileHandle_base, close);
@@ -71,6 +74,8 @@ inline ClassInfo& FileHandle_base::class_info()
         { "statSync", s_stat, false, false },
         { "read", s_read, false, true },
         { "readSync", s_read, false, false },
+        { "readv", s_readv, false, true },
+        { "readvSync", s_readv, false, false },
         { "write", s_write, false, true },
         { "writeSync", s_write, false, false },
         { "close", s_close, false, true },
@@ -160,6 +165,26 @@ inline void FileHandle_base::s_read(const v8::FunctionCallbackInfo<v8::Value>& a
     METHOD_RETURN();
 }
 
+inline void FileHandle_base::s_readv(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    ASYNC_METHOD_INSTANCE(FileHandle_base);
+    METHOD_ENTER();
+
+    ASYNC_METHOD_OVER(2, 1);
+
+    ARG(v8::Local<v8::Array>, 0);
+    OPT_ARG(int32_t, 1, -1);
+
+    if (!cb.IsEmpty())
+        hr = pInst->acb_readv(v0, v1, cb, args);
+    else
+        hr = pInst->ac_readv(v0, v1, vr);
+
+    METHOD_RETURN();
+}
+
 inline void FileHandle_base::s_write(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
     int32_t vr;
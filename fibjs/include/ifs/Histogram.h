@@ -0,0 +1,137 @@
+/***************************************************************************
+ *                                                                         *
+ *   This file was automatically generated using idlc.js                   *
+ *   PLEASE DO NOT EDIT!!!!                                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+/**
+ @author Leo Hoo <lion@9465.net>
+ */
+
+#include "../object.h"
+
+namespace fibjs {
+
+class Histogram_base : public object_base {
+    DECLARE_CLASS(Histogram_base);
+
+public:
+    // Histogram_base
+    virtual result_t get_name(exlib::string& retVal) = 0;
+    virtual result_t get_count(int64_t& retVal) = 0;
+    virtual result_t get_sum(double& retVal) = 0;
+    virtual result_t observe(double value) = 0;
+    virtual result_t percentile(double p, double& retVal) = 0;
+
+public:
+    static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
+    {
+        CONSTRUCT_INIT();
+
+        isolate->m_isolate->ThrowException(
+            isolate->NewString("not a constructor"));
+    }
+
+public:
+    static void s_get_name(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_count(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_sum(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_observe(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_percentile(const v8::FunctionCallbackInfo<v8::Value>& args);
+};
+}
+
+namespace fibjs {
+inline ClassInfo& Histogram_base::class_info()
+{
+    static ClassData::ClassMethod s_method[] = {
+        { "observe", s_observe, false, false },
+        { "percentile", s_percentile, false, false }
+    };
+
+    static ClassData::ClassProperty s_property[] = {
+        { "name", s_get_name, block_set, false },
+        { "count", s_get_count, block_set, false },
+        { "sum", s_get_sum, block_set, false }
+    };
+
+    static ClassData s_cd = {
+        "Histogram", false, s__new, NULL,
+        ARRAYSIZE(s_method), s_method, 0, NULL, ARRAYSIZE(s_property), s_property, 0, NULL, NULL, NULL,
+        &object_base::class_info(),
+        false
+    };
+
+    static ClassInfo s_ci(s_cd);
+    return s_ci;
+}
+
+inline void Histogram_base::s_get_name(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    exlib::string vr;
+
+    METHOD_INSTANCE(Histogram_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_name(vr);
+
+    METHOD_RETURN();
+}
+
+inline void Histogram_base::s_get_count(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int64_t vr;
+
+    METHOD_INSTANCE(Histogram_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_count(vr);
+
+    METHOD_RETURN();
+}
+
+inline void Histogram_base::s_get_sum(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    double vr;
+
+    METHOD_INSTANCE(Histogram_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_sum(vr);
+
+    METHOD_RETURN();
+}
+
+inline void Histogram_base::s_observe(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(Histogram_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 1);
+
+    ARG(double, 0);
+
+    hr = pInst->observe(v0);
+
+    METHOD_VOID();
+}
+
+inline void Histogram_base::s_percentile(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    double vr;
+
+    METHOD_INSTANCE(Histogram_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 1);
+
+    ARG(double, 0);
+
+    hr = pInst->percentile(v0, vr);
+
+    METHOD_RETURN();
+}
+}
@@ -28,6 +28,9 @@ public:
     static result_t _new(exlib::string addr, int32_t port, Handler_base* hdlr, obj_ptr<HttpServer_base>& retVal, v8::Local<v8::Object> This = v8::Local<v8::Object>());
     static result_t _new(exlib::string addr, Handler_base* hdlr, obj_ptr<HttpServer_base>& retVal, v8::Local<v8::Object> This = v8::Local<v8::Object>());
     virtual result_t enableCrossOrigin(exlib::string allowHeaders) = 0;
+    virtual result_t enableAccessLog(v8::Local<v8::Object> opts) = 0;
+    virtual result_t disableAccessLog() = 0;
+    virtual result_t limitConcurrency(v8::Local<v8::Object> opts) = 0;
     virtual result_t get_maxHeadersCount(int32_t& retVal) = 0;
     virtual result_t set_maxHeadersCount(int32_t newVal) = 0;
     virtual result_t get_maxHeaderSize(int32_t& retVal) = 0;
@@ -38,6 +41,15 @@ public:
     virtual result_t set_enableEncoding(bool newVal) = 0;
     virtual result_t get_serverName(exlib::string& retVal) = 0;
     virtual result_t set_serverName(exlib::string newVal) = 0;
+    virtual result_t get_headerTimeout(int32_t& retVal) = 0;
+    virtual result_t set_headerTimeout(int32_t newVal) = 0;
+    virtual result_t get_bodyTimeout(int32_t& retVal) = 0;
+    virtual result_t set_bodyTimeout(int32_t newVal) = 0;
+    virtual result_t get_idleTimeout(int32_t& retVal) = 0;
+    virtual result_t set_idleTimeout(int32_t newVal) = 0;
+    virtual result_t get_handlerTimeout(int32_t& retVal) = 0;
+    virtual result_t set_handlerTimeout(int32_t newVal) = 0;
+    virtual result_t get_loadStats(v8::Local<v8::Object>& retVal) = 0;
 
 public:
     template <typename T>
@@ -46,6 +58,9 @@ public:
 public:
     static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_enableCrossOrigin(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_enableAccessLog(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_disableAccessLog(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_limitConcurrency(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_get_maxHeadersCount(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_set_maxHeadersCount(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
     static void s_get_maxHeaderSize(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
@@ -56,6 +71,15 @@ public:
     static void s_set_enableEncoding(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
     static void s_get_serverName(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_set_serverName(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
+    static void s_get_headerTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_set_headerTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
+    static void s_get_bodyTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_set_bodyTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
+    static void s_get_idleTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_set_idleTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
+    static void s_get_handlerTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_set_handlerTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
+    static void s_get_loadStats(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
 };
 }
 
@@ -65,7 +89,10 @@ namespace fibjs {
 inline ClassInfo& HttpServer_base::class_info()
 {
     static ClassData::ClassMethod s_method[] = {
-        { "enableCrossOrigin", s_enableCrossOrigin, false, false }
+        { "enableCrossOrigin", s_enableCrossOrigin, false, false },
+        { "enableAccessLog", s_enableAccessLog, false, false },
+        { "disableAccessLog", s_disableAccessLog, false, false },
+        { "limitConcurrency", s_limitConcurrency, false, false }
     };
 
     static ClassData::ClassProperty s_property[] = {
@@ -73,7 +100,12 @@ inline ClassInfo& HttpServer_base::class_info()
         { "maxHeaderSize", s_get_maxHeaderSize, s_set_maxHeaderSize, false },
         { "maxBodySize", s_get_maxBodySize, s_set_maxBodySize, false },
         { "enableEncoding", s_get_enableEncoding, s_set_enableEncoding, false },
-        { "serverName", s_get_serverName, s_set_serverName, false }
+        { "serverName", s_get_serverName, s_set_serverName, false },
+        { "headerTimeout", s_get_headerTimeout, s_set_headerTimeout, false },
+        { "bodyTimeout", s_get_bodyTimeout, s_set_bodyTimeout, false },
+        { "idleTimeout", s_get_idleTimeout, s_set_idleTimeout, false },
+        { "handlerTimeout", s_get_handlerTimeout, s_set_handlerTimeout, false },
+        { "loadStats", s_get_loadStats, block_set, false }
     };
 
     static ClassData s_cd = {
@@ -139,6 +171,46 @@ inline void HttpServer_base::s_enableCrossOrigin(const v8::FunctionCallbackInfo<
     METHOD_VOID();
 }
 
+inline void HttpServer_base::s_enableAccessLog(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(HttpServer_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 0);
+
+    OPT_ARG(v8::Local<v8::Object>, 0, v8::Object::New(isolate->m_isolate));
+
+    hr = pInst->enableAccessLog(v0);
+
+    METHOD_VOID();
+}
+
+inline void HttpServer_base::s_disableAccessLog(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(HttpServer_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(0, 0);
+
+    hr = pInst->disableAccessLog();
+
+    METHOD_VOID();
+}
+
+inline void HttpServer_base::s_limitConcurrency(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(HttpServer_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 0);
+
+    OPT_ARG(v8::Local<v8::Object>, 0, v8::Object::New(isolate->m_isolate));
+
+    hr = pInst->limitConcurrency(v0);
+
+    METHOD_VOID();
+}
+
 inline void HttpServer_base::s_get_maxHeadersCount(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
 {
     int32_t vr;
@@ -253,4 +325,108 @@ inline void HttpServer_base::s_set_serverName(v8::Local<v8::Name> property, v8::
 
     PROPERTY_SET_LEAVE();
 }
+
+inline void HttpServer_base::s_get_headerTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_headerTimeout(vr);
+
+    METHOD_RETURN();
+}
+
+inline void HttpServer_base::s_set_headerTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+    PROPERTY_VAL(int32_t);
+
+    hr = pInst->set_headerTimeout(v0);
+
+    PROPERTY_SET_LEAVE();
+}
+
+inline void HttpServer_base::s_get_bodyTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_bodyTimeout(vr);
+
+    METHOD_RETURN();
+}
+
+inline void HttpServer_base::s_set_bodyTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+    PROPERTY_VAL(int32_t);
+
+    hr = pInst->set_bodyTimeout(v0);
+
+    PROPERTY_SET_LEAVE();
+}
+
+inline void HttpServer_base::s_get_idleTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_idleTimeout(vr);
+
+    METHOD_RETURN();
+}
+
+inline void HttpServer_base::s_set_idleTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+    PROPERTY_VAL(int32_t);
+
+    hr = pInst->set_idleTimeout(v0);
+
+    PROPERTY_SET_LEAVE();
+}
+
+inline void HttpServer_base::s_get_handlerTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_handlerTimeout(vr);
+
+    METHOD_RETURN();
+}
+
+inline void HttpServer_base::s_set_handlerTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+    PROPERTY_VAL(int32_t);
+
+    hr = pInst->set_handlerTimeout(v0);
+
+    PROPERTY_SET_LEAVE();
+}
+
+inline void HttpServer_base::s_get_loadStats(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    v8::Local<v8::Object> vr;
+
+    METHOD_INSTANCE(HttpServer_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_loadStats(vr);
+
+    METHOD_RETURN();
+}
 }
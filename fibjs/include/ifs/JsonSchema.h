@@ -0,0 +1,91 @@
+/***************************************************************************
+ *                                                                         *
+ *   This file was automatically generated using idlc.js                   *
+ *   PLEASE DO NOT EDIT!!!!                                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+/**
+ @author Leo Hoo <lion@9465.net>
+ */
+
+#include "../object.h"
+
+namespace fibjs {
+
+class JsonSchema_base : public object_base {
+    DECLARE_CLASS(JsonSchema_base);
+
+public:
+    // JsonSchema_base
+    virtual result_t encode(v8::Local<v8::Value> data, exlib::string& retVal) = 0;
+    virtual result_t decode(exlib::string data, v8::Local<v8::Value>& retVal) = 0;
+
+public:
+    static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
+    {
+        CONSTRUCT_INIT();
+
+        isolate->m_isolate->ThrowException(
+            isolate->NewString("not a constructor"));
+    }
+
+public:
+    static void s_encode(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_decode(const v8::FunctionCallbackInfo<v8::Value>& args);
+};
+}
+
+namespace fibjs {
+inline ClassInfo& JsonSchema_base::class_info()
+{
+    static ClassData::ClassMethod s_method[] = {
+        { "encode", s_encode, false, false },
+        { "decode", s_decode, false, false }
+    };
+
+    static ClassData s_cd = {
+        "JsonSchema", false, s__new, NULL,
+        ARRAYSIZE(s_method), s_method, 0, NULL, 0, NULL, 0, NULL, NULL, NULL,
+        &object_base::class_info(),
+        false
+    };
+
+    static ClassInfo s_ci(s_cd);
+    return s_ci;
+}
+
+inline void JsonSchema_base::s_encode(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    exlib::string vr;
+
+    METHOD_INSTANCE(JsonSchema_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 1);
+
+    ARG(v8::Local<v8::Value>, 0);
+
+    hr = pInst->encode(v0, vr);
+
+    METHOD_RETURN();
+}
+
+inline void JsonSchema_base::s_decode(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    v8::Local<v8::Value> vr;
+
+    METHOD_INSTANCE(JsonSchema_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 1);
+
+    ARG(exlib::string, 0);
+
+    hr = pInst->decode(v0, vr);
+
+    METHOD_RETURN();
+}
+}
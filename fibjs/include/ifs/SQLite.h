@@ -27,6 +27,7 @@ public:
     virtual result_t get_timeout(int32_t& retVal) = 0;
     virtual result_t set_timeout(int32_t newVal) = 0;
     virtual result_t backup(exlib::string fileName, AsyncEvent* ac) = 0;
+    virtual result_t executeColumnar(exlib::string sql, OptArgs args, obj_ptr<NObject>& retVal, AsyncEvent* ac) = 0;
 
 public:
     static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
@@ -42,9 +43,11 @@ public:
     static void s_get_timeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_set_timeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
     static void s_backup(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_executeColumnar(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
     ASYNC_MEMBER1(SQLite_base, backup, exlib::string);
+    ASYNC_MEMBERVALUE3(SQLite_base, executeColumnar, exlib::string, OptArgs, obj_ptr<NObject>);
 };
 }
 
@@ -53,7 +56,9 @@ inline ClassInfo& SQLite_base::class_info()
 {
     static ClassData::ClassMethod s_method[] = {
         { "backup", s_backup, false, true },
-        { "backupSync", s_backup, false, false }
+        { "backupSync", s_backup, false, false },
+        { "executeColumnar", s_executeColumnar, false, true },
+        { "executeColumnarSync", s_executeColumnar, false, false }
     };
 
     static ClassData::ClassProperty s_property[] = {
@@ -123,4 +128,24 @@ inline void SQLite_base::s_backup(const v8::FunctionCallbackInfo<v8::Value>& arg
 
     METHOD_VOID();
 }
+
+inline void SQLite_base::s_executeColumnar(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<NObject> vr;
+
+    ASYNC_METHOD_INSTANCE(SQLite_base);
+    METHOD_ENTER();
+
+    ASYNC_METHOD_OVER(-1, 1);
+
+    ARG(exlib::string, 0);
+    ARG_LIST(1);
+
+    if (!cb.IsEmpty())
+        hr = pInst->acb_executeColumnar(v0, v1, cb, args);
+    else
+        hr = pInst->ac_executeColumnar(v0, v1, vr);
+
+    METHOD_RETURN();
+}
 }
@@ -15,6 +15,8 @@
 
 namespace fibjs {
 
+class Buffer_base;
+
 class Script_base : public object_base {
     DECLARE_CLASS(Script_base);
 
@@ -24,6 +26,9 @@ public:
     virtual result_t runInContext(v8::Local<v8::Object> contextifiedObject, v8::Local<v8::Object> opts, v8::Local<v8::Value>& retVal) = 0;
     virtual result_t runInNewContext(v8::Local<v8::Object> contextObject, v8::Local<v8::Object> opts, v8::Local<v8::Value>& retVal) = 0;
     virtual result_t runInThisContext(v8::Local<v8::Object> opts, v8::Local<v8::Value>& retVal) = 0;
+    virtual result_t createCachedData(obj_ptr<Buffer_base>& retVal) = 0;
+    virtual result_t get_cachedData(obj_ptr<Buffer_base>& retVal) = 0;
+    virtual result_t get_cachedDataRejected(bool& retVal) = 0;
 
 public:
     template <typename T>
@@ -34,21 +39,32 @@ public:
     static void s_runInContext(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_runInNewContext(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_runInThisContext(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_createCachedData(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_get_cachedData(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_cachedDataRejected(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
 };
 }
 
+#include "ifs/Buffer.h"
+
 namespace fibjs {
 inline ClassInfo& Script_base::class_info()
 {
     static ClassData::ClassMethod s_method[] = {
         { "runInContext", s_runInContext, false, false },
         { "runInNewContext", s_runInNewContext, false, false },
-        { "runInThisContext", s_runInThisContext, false, false }
+        { "runInThisContext", s_runInThisContext, false, false },
+        { "createCachedData", s_createCachedData, false, false }
+    };
+
+    static ClassData::ClassProperty s_property[] = {
+        { "cachedData", s_get_cachedData, block_set, false },
+        { "cachedDataRejected", s_get_cachedDataRejected, block_set, false }
     };
 
     static ClassData s_cd = {
         "Script", false, s__new, NULL,
-        ARRAYSIZE(s_method), s_method, 0, NULL, 0, NULL, 0, NULL, NULL, NULL,
+        ARRAYSIZE(s_method), s_method, 0, NULL, ARRAYSIZE(s_property), s_property, 0, NULL, NULL, NULL,
         &object_base::class_info(),
         false
     };
@@ -129,4 +145,42 @@ inline void Script_base::s_runInThisContext(const v8::FunctionCallbackInfo<v8::V
 
     METHOD_RETURN();
 }
+
+inline void Script_base::s_createCachedData(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<Buffer_base> vr;
+
+    METHOD_INSTANCE(Script_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(0, 0);
+
+    hr = pInst->createCachedData(vr);
+
+    METHOD_RETURN();
+}
+
+inline void Script_base::s_get_cachedData(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<Buffer_base> vr;
+
+    METHOD_INSTANCE(Script_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_cachedData(vr);
+
+    METHOD_RETURN();
+}
+
+inline void Script_base::s_get_cachedDataRejected(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    bool vr;
+
+    METHOD_INSTANCE(Script_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_cachedDataRejected(vr);
+
+    METHOD_RETURN();
+}
 }
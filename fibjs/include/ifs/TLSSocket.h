@@ -39,6 +39,7 @@ public:
     virtual result_t get_remotePort(int32_t& retVal) = 0;
     virtual result_t get_localAddress(exlib::string& retVal) = 0;
     virtual result_t get_localPort(int32_t& retVal) = 0;
+    virtual result_t get_ktls(bool& retVal) = 0;
 
 public:
     template <typename T>
@@ -57,6 +58,7 @@ public:
     static void s_get_remotePort(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_get_localAddress(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_get_localPort(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_ktls(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
 
 public:
     ASYNC_MEMBER2(TLSSocket_base, connect, Stream_base*, exlib::string);
@@ -86,7 +88,8 @@ inline ClassInfo& TLSSocket_base::class_info()
         { "remoteAddress", s_get_remoteAddress, block_set, false },
         { "remotePort", s_get_remotePort, block_set, false },
         { "localAddress", s_get_localAddress, block_set, false },
-        { "localPort", s_get_localPort, block_set, false }
+        { "localPort", s_get_localPort, block_set, false },
+        { "ktls", s_get_ktls, block_set, false }
     };
 
     static ClassData s_cd = {
@@ -281,4 +284,16 @@ inline void TLSSocket_base::s_get_localPort(v8::Local<v8::Name> property, const
 
     METHOD_RETURN();
 }
+
+inline void TLSSocket_base::s_get_ktls(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    bool vr;
+
+    METHOD_INSTANCE(TLSSocket_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_ktls(vr);
+
+    METHOD_RETURN();
+}
 }
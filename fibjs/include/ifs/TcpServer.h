@@ -31,6 +31,9 @@ public:
     virtual result_t get_socket(obj_ptr<Socket_base>& retVal) = 0;
     virtual result_t get_handler(obj_ptr<Handler_base>& retVal) = 0;
     virtual result_t set_handler(Handler_base* newVal) = 0;
+    virtual result_t get_maxConnections(int32_t& retVal) = 0;
+    virtual result_t set_maxConnections(int32_t newVal) = 0;
+    virtual result_t get_connections(int32_t& retVal) = 0;
 
 public:
     template <typename T>
@@ -43,6 +46,9 @@ public:
     static void s_get_socket(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_get_handler(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_set_handler(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
+    static void s_get_maxConnections(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_set_maxConnections(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
+    static void s_get_connections(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
 
 public:
     ASYNC_MEMBER0(TcpServer_base, stop);
@@ -63,7 +69,9 @@ inline ClassInfo& TcpServer_base::class_info()
 
     static ClassData::ClassProperty s_property[] = {
         { "socket", s_get_socket, block_set, false },
-        { "handler", s_get_handler, s_set_handler, false }
+        { "handler", s_get_handler, s_set_handler, false },
+        { "maxConnections", s_get_maxConnections, s_set_maxConnections, false },
+        { "connections", s_get_connections, block_set, false }
     };
 
     static ClassData s_cd = {
@@ -176,4 +184,39 @@ inline void TcpServer_base::s_set_handler(v8::Local<v8::Name> property, v8::Loca
 
     PROPERTY_SET_LEAVE();
 }
+
+inline void TcpServer_base::s_get_maxConnections(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(TcpServer_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_maxConnections(vr);
+
+    METHOD_RETURN();
+}
+
+inline void TcpServer_base::s_set_maxConnections(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    METHOD_INSTANCE(TcpServer_base);
+    PROPERTY_ENTER();
+    PROPERTY_VAL(int32_t);
+
+    hr = pInst->set_maxConnections(v0);
+
+    PROPERTY_SET_LEAVE();
+}
+
+inline void TcpServer_base::s_get_connections(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(TcpServer_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_connections(vr);
+
+    METHOD_RETURN();
+}
 }
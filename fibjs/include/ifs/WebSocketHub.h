@@ -0,0 +1,179 @@
+/***************************************************************************
+ *                                                                         *
+ *   This file was automatically generated using idlc.js                   *
+ *   PLEASE DO NOT EDIT!!!!                                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+/**
+ @author Leo Hoo <lion@9465.net>
+ */
+
+#include "../object.h"
+
+namespace fibjs {
+
+class WebSocket_base;
+class Buffer_base;
+
+class WebSocketHub_base : public object_base {
+    DECLARE_CLASS(WebSocketHub_base);
+
+public:
+    // WebSocketHub_base
+    static result_t _new(v8::Local<v8::Object> opts, obj_ptr<WebSocketHub_base>& retVal, v8::Local<v8::Object> This = v8::Local<v8::Object>());
+    virtual result_t subscribe(WebSocket_base* sock, exlib::string topic) = 0;
+    virtual result_t unsubscribe(WebSocket_base* sock, exlib::string topic) = 0;
+    virtual result_t publish(exlib::string topic, exlib::string data, int32_t& retVal) = 0;
+    virtual result_t publish(exlib::string topic, Buffer_base* data, int32_t& retVal) = 0;
+    virtual result_t count(exlib::string topic, int32_t& retVal) = 0;
+    virtual result_t get_stats(v8::Local<v8::Object>& retVal) = 0;
+
+public:
+    template <typename T>
+    static void __new(const T& args);
+
+public:
+    static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_subscribe(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_unsubscribe(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_publish(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_count(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_get_stats(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+};
+}
+
+#include "ifs/WebSocket.h"
+#include "ifs/Buffer.h"
+
+namespace fibjs {
+inline ClassInfo& WebSocketHub_base::class_info()
+{
+    static ClassData::ClassMethod s_method[] = {
+        { "subscribe", s_subscribe, false, false },
+        { "unsubscribe", s_unsubscribe, false, false },
+        { "publish", s_publish, false, false },
+        { "count", s_count, false, false }
+    };
+
+    static ClassData::ClassProperty s_property[] = {
+        { "stats", s_get_stats, block_set, false }
+    };
+
+    static ClassData s_cd = {
+        "WebSocketHub", false, s__new, NULL,
+        ARRAYSIZE(s_method), s_method, 0, NULL, ARRAYSIZE(s_property), s_property, 0, NULL, NULL, NULL,
+        &object_base::class_info(),
+        false
+    };
+
+    static ClassInfo s_ci(s_cd);
+    return s_ci;
+}
+
+inline void WebSocketHub_base::s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    CONSTRUCT_INIT();
+    __new(args);
+}
+
+template <typename T>
+void WebSocketHub_base::__new(const T& args)
+{
+    obj_ptr<WebSocketHub_base> vr;
+
+    CONSTRUCT_ENTER();
+
+    METHOD_OVER(1, 0);
+
+    OPT_ARG(v8::Local<v8::Object>, 0, v8::Object::New(isolate->m_isolate));
+
+    hr = _new(v0, vr, args.This());
+
+    CONSTRUCT_RETURN();
+}
+
+inline void WebSocketHub_base::s_subscribe(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(WebSocketHub_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(2, 1);
+
+    ARG(obj_ptr<WebSocket_base>, 0);
+    OPT_ARG(exlib::string, 1, "");
+
+    hr = pInst->subscribe(v0, v1);
+
+    METHOD_VOID();
+}
+
+inline void WebSocketHub_base::s_unsubscribe(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(WebSocketHub_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(2, 1);
+
+    ARG(obj_ptr<WebSocket_base>, 0);
+    OPT_ARG(exlib::string, 1, "");
+
+    hr = pInst->unsubscribe(v0, v1);
+
+    METHOD_VOID();
+}
+
+inline void WebSocketHub_base::s_publish(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(WebSocketHub_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(2, 2);
+
+    ARG(exlib::string, 0);
+    ARG(exlib::string, 1);
+
+    hr = pInst->publish(v0, v1, vr);
+
+    METHOD_OVER(2, 2);
+
+    ARG(exlib::string, 0);
+    ARG(obj_ptr<Buffer_base>, 1);
+
+    hr = pInst->publish(v0, v1, vr);
+
+    METHOD_RETURN();
+}
+
+inline void WebSocketHub_base::s_count(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(WebSocketHub_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 0);
+
+    OPT_ARG(exlib::string, 0, "");
+
+    hr = pInst->count(v0, vr);
+
+    METHOD_RETURN();
+}
+
+inline void WebSocketHub_base::s_get_stats(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    v8::Local<v8::Object> vr;
+
+    METHOD_INSTANCE(WebSocketHub_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_stats(vr);
+
+    METHOD_RETURN();
+}
+}
@@ -0,0 +1,180 @@
+/***************************************************************************
+ *                                                                         *
+ *   This file was automatically generated using idlc.js                   *
+ *   PLEASE DO NOT EDIT!!!!                                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+/**
+ @author Leo Hoo <lion@9465.net>
+ */
+
+#include "../object.h"
+
+namespace fibjs {
+
+class WorkerPool_base : public object_base {
+    DECLARE_CLASS(WorkerPool_base);
+
+public:
+    // WorkerPool_base
+    static result_t _new(exlib::string path, v8::Local<v8::Object> opts, obj_ptr<WorkerPool_base>& retVal, v8::Local<v8::Object> This = v8::Local<v8::Object>());
+    virtual result_t run(exlib::string fn, v8::Local<v8::Array> args, Variant& retVal, AsyncEvent* ac) = 0;
+    virtual result_t cancel(int32_t& retVal) = 0;
+    virtual result_t close() = 0;
+    virtual result_t get_size(int32_t& retVal) = 0;
+    virtual result_t get_pending(int32_t& retVal) = 0;
+    virtual result_t get_stats(v8::Local<v8::Object>& retVal) = 0;
+
+public:
+    template <typename T>
+    static void __new(const T& args);
+
+public:
+    static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_run(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_cancel(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_close(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_get_size(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_pending(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_get_stats(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+
+public:
+    ASYNC_MEMBERVALUE3(WorkerPool_base, run, exlib::string, v8::Local<v8::Array>, Variant);
+};
+}
+
+namespace fibjs {
+inline ClassInfo& WorkerPool_base::class_info()
+{
+    static ClassData::ClassMethod s_method[] = {
+        { "run", s_run, false, true },
+        { "runSync", s_run, false, false },
+        { "cancel", s_cancel, false, false },
+        { "close", s_close, false, false }
+    };
+
+    static ClassData::ClassProperty s_property[] = {
+        { "size", s_get_size, block_set, false },
+        { "pending", s_get_pending, block_set, false },
+        { "stats", s_get_stats, block_set, false }
+    };
+
+    static ClassData s_cd = {
+        "WorkerPool", false, s__new, NULL,
+        ARRAYSIZE(s_method), s_method, 0, NULL, ARRAYSIZE(s_property), s_property, 0, NULL, NULL, NULL,
+        &object_base::class_info(),
+        true
+    };
+
+    static ClassInfo s_ci(s_cd);
+    return s_ci;
+}
+
+inline void WorkerPool_base::s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    CONSTRUCT_INIT();
+    __new(args);
+}
+
+template <typename T>
+void WorkerPool_base::__new(const T& args)
+{
+    obj_ptr<WorkerPool_base> vr;
+
+    CONSTRUCT_ENTER();
+
+    METHOD_OVER(2, 1);
+
+    ARG(exlib::string, 0);
+    OPT_ARG(v8::Local<v8::Object>, 1, v8::Object::New(isolate->m_isolate));
+
+    hr = _new(v0, v1, vr, args.This());
+
+    CONSTRUCT_RETURN();
+}
+
+inline void WorkerPool_base::s_run(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    Variant vr;
+
+    ASYNC_METHOD_INSTANCE(WorkerPool_base);
+    METHOD_ENTER();
+
+    ASYNC_METHOD_OVER(2, 1);
+
+    ARG(exlib::string, 0);
+    OPT_ARG(v8::Local<v8::Array>, 1, v8::Array::New(isolate->m_isolate));
+
+    if (!cb.IsEmpty())
+        hr = pInst->acb_run(v0, v1, cb, args);
+    else
+        hr = pInst->ac_run(v0, v1, vr);
+
+    METHOD_RETURN();
+}
+
+inline void WorkerPool_base::s_cancel(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(WorkerPool_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(0, 0);
+
+    hr = pInst->cancel(vr);
+
+    METHOD_RETURN();
+}
+
+inline void WorkerPool_base::s_close(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_INSTANCE(WorkerPool_base);
+    METHOD_ENTER();
+
+    METHOD_OVER(0, 0);
+
+    hr = pInst->close();
+
+    METHOD_VOID();
+}
+
+inline void WorkerPool_base::s_get_size(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(WorkerPool_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_size(vr);
+
+    METHOD_RETURN();
+}
+
+inline void WorkerPool_base::s_get_pending(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_INSTANCE(WorkerPool_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_pending(vr);
+
+    METHOD_RETURN();
+}
+
+inline void WorkerPool_base::s_get_stats(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    v8::Local<v8::Object> vr;
+
+    METHOD_INSTANCE(WorkerPool_base);
+    PROPERTY_ENTER();
+
+    hr = pInst->get_stats(vr);
+
+    METHOD_RETURN();
+}
+}
@@ -20,6 +20,7 @@ class Semaphore_base;
 class Condition_base;
 class Event_base;
 class Worker_base;
+class WorkerPool_base;
 class Fiber_base;
 
 class coroutine_base : public object_base {
@@ -72,6 +73,7 @@ public:
 #include "ifs/Condition.h"
 #include "ifs/Event.h"
 #include "ifs/Worker.h"
+#include "ifs/WorkerPool.h"
 #include "ifs/Fiber.h"
 
 namespace fibjs {
@@ -90,7 +92,8 @@ inline ClassInfo& coroutine_base::class_info()
         { "Semaphore", Semaphore_base::class_info },
         { "Condition", Condition_base::class_info },
         { "Event", Event_base::class_info },
-        { "Worker", Worker_base::class_info }
+        { "Worker", Worker_base::class_info },
+        { "WorkerPool", WorkerPool_base::class_info }
     };
 
     static ClassData::ClassProperty s_property[] = {
@@ -74,7 +74,8 @@ public:
     static result_t createCertificateRequest(Buffer_base* csr, obj_ptr<X509CertificateRequest_base>& retVal);
     static result_t createCertificateRequest(v8::Local<v8::Object> options, obj_ptr<X509CertificateRequest_base>& retVal);
     static result_t diffieHellman(v8::Local<v8::Object> options, obj_ptr<Buffer_base>& retVal);
-    static result_t hash(exlib::string algorithm, Buffer_base* data, exlib::string outputEncoding, v8::Local<v8::Value>& retVal);
+    static result_t hash(exlib::string algorithm, Buffer_base* data, exlib::string outputEncoding, Variant& retVal, AsyncEvent* ac);
+    static result_t hashBatch(exlib::string algorithm, v8::Local<v8::Array> datas, exlib::string outputEncoding, obj_ptr<NArray>& retVal, AsyncEvent* ac);
     static result_t randomBytes(int32_t size, obj_ptr<Buffer_base>& retVal, AsyncEvent* ac);
     static result_t randomFill(Buffer_base* buffer, int32_t offset, int32_t size, obj_ptr<Buffer_base>& retVal, AsyncEvent* ac);
     static result_t generateKeyPair(exlib::string type, v8::Local<v8::Object> options, obj_ptr<GenerateKeyPairType>& retVal, AsyncEvent* ac);
@@ -98,6 +99,7 @@ public:
     static result_t verify(v8::Local<v8::Value> algorithm, Buffer_base* data, Buffer_base* publicKey, Buffer_base* signature, bool& retVal, AsyncEvent* ac);
     static result_t verify(v8::Local<v8::Value> algorithm, Buffer_base* data, KeyObject_base* publicKey, Buffer_base* signature, bool& retVal, AsyncEvent* ac);
     static result_t verify(v8::Local<v8::Value> algorithm, Buffer_base* data, v8::Local<v8::Object> key, Buffer_base* signature, bool& retVal, AsyncEvent* ac);
+    static result_t verifyBatch(v8::Local<v8::Value> algorithm, v8::Local<v8::Array> items, obj_ptr<NArray>& retVal, AsyncEvent* ac);
 
 public:
     static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
@@ -126,6 +128,7 @@ public:
     static void s_static_createCertificateRequest(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_diffieHellman(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_hash(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_hashBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_randomBytes(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_randomFill(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_generateKeyPair(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -137,8 +140,11 @@ public:
     static void s_static_publicEncrypt(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_sign(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_verify(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_verifyBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
+    ASYNC_STATICVALUE4(crypto_base, hash, exlib::string, Buffer_base*, exlib::string, Variant);
+    ASYNC_STATICVALUE4(crypto_base, hashBatch, exlib::string, v8::Local<v8::Array>, exlib::string, obj_ptr<NArray>);
     ASYNC_STATICVALUE2(crypto_base, randomBytes, int32_t, obj_ptr<Buffer_base>);
     ASYNC_STATICVALUE4(crypto_base, randomFill, Buffer_base*, int32_t, int32_t, obj_ptr<Buffer_base>);
     ASYNC_STATICVALUE3(crypto_base, generateKeyPair, exlib::string, v8::Local<v8::Object>, obj_ptr<GenerateKeyPairType>);
@@ -150,6 +156,7 @@ public:
     ASYNC_STATICVALUE5(crypto_base, verify, v8::Local<v8::Value>, Buffer_base*, Buffer_base*, Buffer_base*, bool);
     ASYNC_STATICVALUE5(crypto_base, verify, v8::Local<v8::Value>, Buffer_base*, KeyObject_base*, Buffer_base*, bool);
     ASYNC_STATICVALUE5(crypto_base, verify, v8::Local<v8::Value>, Buffer_base*, v8::Local<v8::Object>, Buffer_base*, bool);
+    ASYNC_STATICVALUE3(crypto_base, verifyBatch, v8::Local<v8::Value>, v8::Local<v8::Array>, obj_ptr<NArray>);
 };
 }
 
@@ -183,7 +190,10 @@ inline ClassInfo& crypto_base::class_info()
         { "createSecretKey", s_static_createSecretKey, true, false },
         { "createCertificateRequest", s_static_createCertificateRequest, true, false },
         { "diffieHellman", s_static_diffieHellman, true, false },
-        { "hash", s_static_hash, true, false },
+        { "hash", s_static_hash, true, true },
+        { "hashSync", s_static_hash, true, false },
+        { "hashBatch", s_static_hashBatch, true, true },
+        { "hashBatchSync", s_static_hashBatch, true, false },
         { "randomBytes", s_static_randomBytes, true, true },
         { "randomBytesSync", s_static_randomBytes, true, false },
         { "randomFill", s_static_randomFill, true, true },
@@ -201,7 +211,9 @@ inline ClassInfo& crypto_base::class_info()
         { "sign", s_static_sign, true, true },
         { "signSync", s_static_sign, true, false },
         { "verify", s_static_verify, true, true },
-        { "verifySync", s_static_verify, true, false }
+        { "verifySync", s_static_verify, true, false },
+        { "verifyBatch", s_static_verifyBatch, true, true },
+        { "verifyBatchSync", s_static_verifyBatch, true, false }
     };
 
     static ClassData::ClassObject s_object[] = {
@@ -520,17 +532,40 @@ inline void crypto_base::s_static_diffieHellman(const v8::FunctionCallbackInfo<v
 
 inline void crypto_base::s_static_hash(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
-    v8::Local<v8::Value> vr;
+    Variant vr;
 
     METHOD_ENTER();
 
-    METHOD_OVER(3, 2);
+    ASYNC_METHOD_OVER(3, 2);
 
     ARG(exlib::string, 0);
     ARG(obj_ptr<Buffer_base>, 1);
     OPT_ARG(exlib::string, 2, "hex");
 
-    hr = hash(v0, v1, v2, vr);
+    if (!cb.IsEmpty())
+        hr = acb_hash(v0, v1, v2, cb, args);
+    else
+        hr = ac_hash(v0, v1, v2, vr);
+
+    METHOD_RETURN();
+}
+
+inline void crypto_base::s_static_hashBatch(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<NArray> vr;
+
+    METHOD_ENTER();
+
+    ASYNC_METHOD_OVER(3, 2);
+
+    ARG(exlib::string, 0);
+    ARG(v8::Local<v8::Array>, 1);
+    OPT_ARG(exlib::string, 2, "hex");
+
+    if (!cb.IsEmpty())
+        hr = acb_hashBatch(v0, v1, v2, cb, args);
+    else
+        hr = ac_hashBatch(v0, v1, v2, vr);
 
     METHOD_RETURN();
 }
@@ -842,4 +877,23 @@ inline void crypto_base::s_static_verify(const v8::FunctionCallbackInfo<v8::Valu
 
     METHOD_RETURN();
 }
+
+inline void crypto_base::s_static_verifyBatch(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<NArray> vr;
+
+    METHOD_ENTER();
+
+    ASYNC_METHOD_OVER(2, 2);
+
+    ARG(v8::Local<v8::Value>, 0);
+    ARG(v8::Local<v8::Array>, 1);
+
+    if (!cb.IsEmpty())
+        hr = acb_verifyBatch(v0, v1, cb, args);
+    else
+        hr = ac_verifyBatch(v0, v1, vr);
+
+    METHOD_RETURN();
+}
 }
@@ -57,6 +57,7 @@ public:
     static result_t symlink(exlib::string target, exlib::string linkpath, exlib::string type, AsyncEvent* ac);
     static result_t truncate(exlib::string path, int32_t len, AsyncEvent* ac);
     static result_t read(FileHandle_base* fd, Buffer_base* buffer, int32_t offset, int32_t length, int32_t position, int32_t& retVal, AsyncEvent* ac);
+    static result_t readv(FileHandle_base* fd, v8::Local<v8::Array> buffers, int32_t position, int32_t& retVal, AsyncEvent* ac);
     static result_t fchmod(FileHandle_base* fd, int32_t mode, AsyncEvent* ac);
     static result_t fchown(FileHandle_base* fd, int32_t uid, int32_t gid, AsyncEvent* ac);
     static result_t fdatasync(FileHandle_base* fd, AsyncEvent* ac);
@@ -120,6 +121,7 @@ public:
     static void s_static_symlink(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_truncate(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_read(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_readv(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_fchmod(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_fchown(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_fdatasync(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -164,6 +166,7 @@ public:
     ASYNC_STATIC3(fs_base, symlink, exlib::string, exlib::string, exlib::string);
     ASYNC_STATIC2(fs_base, truncate, exlib::string, int32_t);
     ASYNC_STATICVALUE6(fs_base, read, FileHandle_base*, Buffer_base*, int32_t, int32_t, int32_t, int32_t);
+    ASYNC_STATICVALUE4(fs_base, readv, FileHandle_base*, v8::Local<v8::Array>, int32_t, int32_t);
     ASYNC_STATIC2(fs_base, fchmod, FileHandle_base*, int32_t);
     ASYNC_STATIC3(fs_base, fchown, FileHandle_base*, int32_t, int32_t);
     ASYNC_STATIC1(fs_base, fdatasync, FileHandle_base*);
@@ -241,6 +244,8 @@ inline ClassInfo& fs_base::class_info()
         { "truncateSync", s_static_truncate, true, false },
         { "read", s_static_read, true, true },
         { "readSync", s_static_read, true, false },
+        { "readv", s_static_readv, true, true },
+        { "readvSync", s_static_readv, true, false },
         { "fchmod", s_static_fchmod, true, true },
         { "fchmodSync", s_static_fchmod, true, false },
         { "fchown", s_static_fchown, true, true },
@@ -663,6 +668,26 @@ inline void fs_base::s_static_read(const v8::FunctionCallbackInfo<v8::Value>& ar
     METHOD_RETURN();
 }
 
+inline void fs_base::s_static_readv(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    METHOD_ENTER();
+
+    ASYNC_METHOD_OVER(3, 2);
+
+    ARG(obj_ptr<FileHandle_base>, 0);
+    ARG(v8::Local<v8::Array>, 1);
+    OPT_ARG(int32_t, 2, -1);
+
+    if (!cb.IsEmpty())
+        hr = acb_readv(v0, v1, v2, cb, args);
+    else
+        hr = ac_readv(v0, v1, v2, vr);
+
+    METHOD_RETURN();
+}
+
 inline void fs_base::s_static_fchmod(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
     METHOD_ENTER();
@@ -15,6 +15,8 @@
 
 namespace fibjs {
 
+class JsonSchema_base;
+
 class json_base : public object_base {
     DECLARE_CLASS(json_base);
 
@@ -22,6 +24,7 @@ public:
     // json_base
     static result_t encode(v8::Local<v8::Value> data, exlib::string& retVal);
     static result_t decode(exlib::string data, v8::Local<v8::Value>& retVal);
+    static result_t compile(v8::Local<v8::Object> schema, obj_ptr<JsonSchema_base>& retVal);
 
 public:
     static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
@@ -35,15 +38,19 @@ public:
 public:
     static void s_static_encode(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_decode(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_compile(const v8::FunctionCallbackInfo<v8::Value>& args);
 };
 }
 
+#include "ifs/JsonSchema.h"
+
 namespace fibjs {
 inline ClassInfo& json_base::class_info()
 {
     static ClassData::ClassMethod s_method[] = {
         { "encode", s_static_encode, true, false },
-        { "decode", s_static_decode, true, false }
+        { "decode", s_static_decode, true, false },
+        { "compile", s_static_compile, true, false }
     };
 
     static ClassData s_cd = {
@@ -86,4 +93,19 @@ inline void json_base::s_static_decode(const v8::FunctionCallbackInfo<v8::Value>
 
     METHOD_RETURN();
 }
+
+inline void json_base::s_static_compile(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<JsonSchema_base> vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 1);
+
+    ARG(v8::Local<v8::Object>, 0);
+
+    hr = compile(v0, vr);
+
+    METHOD_RETURN();
+}
 }
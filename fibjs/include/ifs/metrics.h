@@ -0,0 +1,158 @@
+/***************************************************************************
+ *                                                                         *
+ *   This file was automatically generated using idlc.js                   *
+ *   PLEASE DO NOT EDIT!!!!                                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+/**
+ @author Leo Hoo <lion@9465.net>
+ */
+
+#include "../object.h"
+
+namespace fibjs {
+
+class Counter_base;
+class Gauge_base;
+class Histogram_base;
+class Handler_base;
+
+class metrics_base : public object_base {
+    DECLARE_CLASS(metrics_base);
+
+public:
+    // metrics_base
+    static result_t counter(exlib::string name, v8::Local<v8::Object> opts, obj_ptr<Counter_base>& retVal);
+    static result_t gauge(exlib::string name, v8::Local<v8::Object> opts, obj_ptr<Gauge_base>& retVal);
+    static result_t histogram(exlib::string name, v8::Local<v8::Object> opts, obj_ptr<Histogram_base>& retVal);
+    static result_t collect(exlib::string& retVal);
+    static result_t handler(obj_ptr<Handler_base>& retVal);
+
+public:
+    static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
+    {
+        CONSTRUCT_INIT();
+
+        isolate->m_isolate->ThrowException(
+            isolate->NewString("not a constructor"));
+    }
+
+public:
+    static void s_static_counter(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_gauge(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_histogram(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_collect(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_handler(const v8::FunctionCallbackInfo<v8::Value>& args);
+};
+}
+
+#include "ifs/Counter.h"
+#include "ifs/Gauge.h"
+#include "ifs/Histogram.h"
+#include "ifs/Handler.h"
+
+namespace fibjs {
+inline ClassInfo& metrics_base::class_info()
+{
+    static ClassData::ClassMethod s_method[] = {
+        { "counter", s_static_counter, true, false },
+        { "gauge", s_static_gauge, true, false },
+        { "histogram", s_static_histogram, true, false },
+        { "collect", s_static_collect, true, false },
+        { "handler", s_static_handler, true, false }
+    };
+
+    static ClassData::ClassObject s_object[] = {
+        { "Counter", Counter_base::class_info },
+        { "Gauge", Gauge_base::class_info },
+        { "Histogram", Histogram_base::class_info }
+    };
+
+    static ClassData s_cd = {
+        "metrics", true, s__new, NULL,
+        ARRAYSIZE(s_method), s_method, ARRAYSIZE(s_object), s_object, 0, NULL, 0, NULL, NULL, NULL,
+        &object_base::class_info(),
+        false
+    };
+
+    static ClassInfo s_ci(s_cd);
+    return s_ci;
+}
+
+inline void metrics_base::s_static_counter(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<Counter_base> vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(2, 1);
+
+    ARG(exlib::string, 0);
+    OPT_ARG(v8::Local<v8::Object>, 1, v8::Object::New(isolate->m_isolate));
+
+    hr = counter(v0, v1, vr);
+
+    METHOD_RETURN();
+}
+
+inline void metrics_base::s_static_gauge(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<Gauge_base> vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(2, 1);
+
+    ARG(exlib::string, 0);
+    OPT_ARG(v8::Local<v8::Object>, 1, v8::Object::New(isolate->m_isolate));
+
+    hr = gauge(v0, v1, vr);
+
+    METHOD_RETURN();
+}
+
+inline void metrics_base::s_static_histogram(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<Histogram_base> vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(2, 1);
+
+    ARG(exlib::string, 0);
+    OPT_ARG(v8::Local<v8::Object>, 1, v8::Object::New(isolate->m_isolate));
+
+    hr = histogram(v0, v1, vr);
+
+    METHOD_RETURN();
+}
+
+inline void metrics_base::s_static_collect(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    exlib::string vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(0, 0);
+
+    hr = collect(vr);
+
+    METHOD_RETURN();
+}
+
+inline void metrics_base::s_static_handler(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<Handler_base> vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(0, 0);
+
+    hr = handler(vr);
+
+    METHOD_RETURN();
+}
+}
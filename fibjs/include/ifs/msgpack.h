@@ -16,6 +16,7 @@
 namespace fibjs {
 
 class Buffer_base;
+class MsgpackSchema_base;
 
 class msgpack_base : public object_base {
     DECLARE_CLASS(msgpack_base);
@@ -24,6 +25,7 @@ public:
     // msgpack_base
     static result_t encode(v8::Local<v8::Value> data, obj_ptr<Buffer_base>& retVal);
     static result_t decode(Buffer_base* data, v8::Local<v8::Value>& retVal);
+    static result_t compile(v8::Local<v8::Object> schema, obj_ptr<MsgpackSchema_base>& retVal);
 
 public:
     static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
@@ -37,17 +39,20 @@ public:
 public:
     static void s_static_encode(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_decode(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_compile(const v8::FunctionCallbackInfo<v8::Value>& args);
 };
 }
 
 #include "ifs/Buffer.h"
+#include "ifs/MsgpackSchema.h"
 
 namespace fibjs {
 inline ClassInfo& msgpack_base::class_info()
 {
     static ClassData::ClassMethod s_method[] = {
         { "encode", s_static_encode, true, false },
-        { "decode", s_static_decode, true, false }
+        { "decode", s_static_decode, true, false },
+        { "compile", s_static_compile, true, false }
     };
 
     static ClassData s_cd = {
@@ -90,4 +95,19 @@ inline void msgpack_base::s_static_decode(const v8::FunctionCallbackInfo<v8::Val
 
     METHOD_RETURN();
 }
+
+inline void msgpack_base::s_static_compile(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<MsgpackSchema_base> vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(1, 1);
+
+    ARG(v8::Local<v8::Object>, 0);
+
+    hr = compile(v0, vr);
+
+    METHOD_RETURN();
+}
 }
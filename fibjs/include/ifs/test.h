@@ -38,6 +38,7 @@ public:
     static result_t mustNotCall(v8::Local<v8::Function> func, v8::Local<v8::Function>& retVal);
     static result_t mustNotCall(v8::Local<v8::Function>& retVal);
     static result_t run(int32_t mode, v8::Local<v8::Object>& retVal);
+    static result_t bench(exlib::string name, v8::Local<v8::Function> fn, v8::Local<v8::Object> opts, v8::Local<v8::Object>& retVal);
     static result_t setup();
     static result_t get_slow(int32_t& retVal);
     static result_t set_slow(int32_t newVal);
@@ -66,6 +67,7 @@ public:
     static void s_static_mustCall(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_mustNotCall(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_run(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_bench(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_setup(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_get_slow(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
     static void s_static_set_slow(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
@@ -93,6 +95,7 @@ inline ClassInfo& test_base::class_info()
         { "mustCall", s_static_mustCall, true, false },
         { "mustNotCall", s_static_mustNotCall, true, false },
         { "run", s_static_run, true, false },
+        { "bench", s_static_bench, true, false },
         { "setup", s_static_setup, true, false }
     };
 
@@ -314,6 +317,23 @@ inline void test_base::s_static_run(const v8::FunctionCallbackInfo<v8::Value>& a
     METHOD_RETURN();
 }
 
+inline void test_base::s_static_bench(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    v8::Local<v8::Object> vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(3, 2);
+
+    ARG(exlib::string, 0);
+    ARG(v8::Local<v8::Function>, 1);
+    OPT_ARG(v8::Local<v8::Object>, 2, v8::Object::New(isolate->m_isolate));
+
+    hr = bench(v0, v1, v2, vr);
+
+    METHOD_RETURN();
+}
+
 inline void test_base::s_static_setup(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
     METHOD_ENTER();
@@ -29,6 +29,10 @@ public:
     static result_t createSecureContext(v8::Local<v8::Object> options, bool isServer, obj_ptr<SecureContext_base>& retVal);
     static result_t createSecureContext(bool isServer, obj_ptr<SecureContext_base>& retVal);
     static result_t get_secureContext(obj_ptr<SecureContext_base>& retVal);
+    static result_t get_sessionCacheSize(int32_t& retVal);
+    static result_t set_sessionCacheSize(int32_t newVal);
+    static result_t get_sessionCacheTimeout(int32_t& retVal);
+    static result_t set_sessionCacheTimeout(int32_t newVal);
     static result_t connect(exlib::string url, int32_t timeout, obj_ptr<Stream_base>& retVal, AsyncEvent* ac);
     static result_t connect(exlib::string url, SecureContext_base* secureContext, int32_t timeout, obj_ptr<Stream_base>& retVal, AsyncEvent* ac);
     static result_t connect(exlib::string url, v8::Local<v8::Object> optionns, obj_ptr<Stream_base>& retVal, AsyncEvent* ac);
@@ -45,6 +49,10 @@ public:
 public:
     static void s_static_createSecureContext(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_get_secureContext(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_static_get_sessionCacheSize(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_static_set_sessionCacheSize(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
+    static void s_static_get_sessionCacheTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_static_set_sessionCacheTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
     static void s_static_connect(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
@@ -76,7 +84,9 @@ inline ClassInfo& tls_base::class_info()
     };
 
     static ClassData::ClassProperty s_property[] = {
-        { "secureContext", s_static_get_secureContext, block_set, true }
+        { "secureContext", s_static_get_secureContext, block_set, true },
+        { "sessionCacheSize", s_static_get_sessionCacheSize, s_static_set_sessionCacheSize, true },
+        { "sessionCacheTimeout", s_static_get_sessionCacheTimeout, s_static_set_sessionCacheTimeout, true }
     };
 
     static ClassData s_cd = {
@@ -123,6 +133,48 @@ inline void tls_base::s_static_get_secureContext(v8::Local<v8::Name> property, c
     METHOD_RETURN();
 }
 
+inline void tls_base::s_static_get_sessionCacheSize(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    PROPERTY_ENTER();
+
+    hr = get_sessionCacheSize(vr);
+
+    METHOD_RETURN();
+}
+
+inline void tls_base::s_static_set_sessionCacheSize(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    PROPERTY_ENTER();
+    PROPERTY_VAL(int32_t);
+
+    hr = set_sessionCacheSize(v0);
+
+    PROPERTY_SET_LEAVE();
+}
+
+inline void tls_base::s_static_get_sessionCacheTimeout(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int32_t vr;
+
+    PROPERTY_ENTER();
+
+    hr = get_sessionCacheTimeout(vr);
+
+    METHOD_RETURN();
+}
+
+inline void tls_base::s_static_set_sessionCacheTimeout(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    PROPERTY_ENTER();
+    PROPERTY_VAL(int32_t);
+
+    hr = set_sessionCacheTimeout(v0);
+
+    PROPERTY_SET_LEAVE();
+}
+
 inline void tls_base::s_static_connect(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
     obj_ptr<Stream_base> vr;
@@ -16,6 +16,7 @@
 namespace fibjs {
 
 class LruCache_base;
+class SharedCache_base;
 class TextDecoder_base;
 class TextEncoder_base;
 class types_base;
@@ -83,6 +84,7 @@ public:
     static result_t reduce(v8::Local<v8::Value> list, v8::Local<v8::Function> iterator, v8::Local<v8::Value> memo, v8::Local<v8::Value> context, v8::Local<v8::Value>& retVal);
     static result_t parseArgs(exlib::string command, obj_ptr<NArray>& retVal);
     static result_t compile(exlib::string srcname, exlib::string script, int32_t mode, obj_ptr<Buffer_base>& retVal);
+    static result_t bundle(v8::Local<v8::Object> files, v8::Local<v8::Object> opts, obj_ptr<Buffer_base>& retVal);
     static result_t sync(v8::Local<v8::Function> func, bool async_func, v8::Local<v8::Function>& retVal);
     static result_t promisify(v8::Local<v8::Function> func, v8::Local<v8::Function>& retVal);
     static result_t callbackify(v8::Local<v8::Function> func, v8::Local<v8::Function>& retVal);
@@ -152,6 +154,7 @@ public:
     static void s_static_reduce(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_parseArgs(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_compile(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_bundle(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_sync(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_promisify(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_callbackify(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -160,6 +163,7 @@ public:
 }
 
 #include "ifs/LruCache.h"
+#include "ifs/SharedCache.h"
 #include "ifs/TextDecoder.h"
 #include "ifs/TextEncoder.h"
 #include "ifs/types.h"
@@ -223,6 +227,7 @@ inline ClassInfo& util_base::class_info()
         { "reduce", s_static_reduce, true, false },
         { "parseArgs", s_static_parseArgs, true, false },
         { "compile", s_static_compile, true, false },
+        { "bundle", s_static_bundle, true, false },
         { "sync", s_static_sync, true, false },
         { "promisify", s_static_promisify, true, false },
         { "callbackify", s_static_callbackify, true, false },
@@ -231,6 +236,7 @@ inline ClassInfo& util_base::class_info()
 
     static ClassData::ClassObject s_object[] = {
         { "LruCache", LruCache_base::class_info },
+        { "SharedCache", SharedCache_base::class_info },
         { "TextDecoder", TextDecoder_base::class_info },
         { "TextEncoder", TextEncoder_base::class_info },
         { "types", types_base::class_info }
@@ -1097,6 +1103,22 @@ inline void util_base::s_static_compile(const v8::FunctionCallbackInfo<v8::Value
     METHOD_RETURN();
 }
 
+inline void util_base::s_static_bundle(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    obj_ptr<Buffer_base> vr;
+
+    METHOD_ENTER();
+
+    METHOD_OVER(2, 1);
+
+    ARG(v8::Local<v8::Object>, 0);
+    OPT_ARG(v8::Local<v8::Object>, 1, v8::Object::New(isolate->m_isolate));
+
+    hr = bundle(v0, v1, vr);
+
+    METHOD_RETURN();
+}
+
 inline void util_base::s_static_sync(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
     v8::Local<v8::Function> vr;
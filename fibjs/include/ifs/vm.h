@@ -17,6 +17,7 @@ namespace fibjs {
 
 class SandBox_base;
 class Script_base;
+class ContextPool_base;
 
 class vm_base : public object_base {
     DECLARE_CLASS(vm_base);
@@ -31,6 +32,7 @@ public:
     static result_t runInNewContext(exlib::string code, v8::Local<v8::Object> contextObject, exlib::string filename, v8::Local<v8::Value>& retVal);
     static result_t runInThisContext(exlib::string code, v8::Local<v8::Object> opts, v8::Local<v8::Value>& retVal);
     static result_t runInThisContext(exlib::string code, exlib::string filename, v8::Local<v8::Value>& retVal);
+    static result_t clearResolveCache();
 
 public:
     static void s__new(const v8::FunctionCallbackInfo<v8::Value>& args)
@@ -47,11 +49,13 @@ public:
     static void s_static_runInContext(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_runInNewContext(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_runInThisContext(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_clearResolveCache(const v8::FunctionCallbackInfo<v8::Value>& args);
 };
 }
 
 #include "ifs/SandBox.h"
 #include "ifs/Script.h"
+#include "ifs/ContextPool.h"
 
 namespace fibjs {
 inline ClassInfo& vm_base::class_info()
@@ -61,12 +65,14 @@ inline ClassInfo& vm_base::class_info()
         { "isContext", s_static_isContext, true, false },
         { "runInContext", s_static_runInContext, true, false },
         { "runInNewContext", s_static_runInNewContext, true, false },
-        { "runInThisContext", s_static_runInThisContext, true, false }
+        { "runInThisContext", s_static_runInThisContext, true, false },
+        { "clearResolveCache", s_static_clearResolveCache, true, false }
     };
 
     static ClassData::ClassObject s_object[] = {
         { "SandBox", SandBox_base::class_info },
-        { "Script", Script_base::class_info }
+        { "Script", Script_base::class_info },
+        { "ContextPool", ContextPool_base::class_info }
     };
 
     static ClassData s_cd = {
@@ -183,4 +189,15 @@ inline void vm_base::s_static_runInThisContext(const v8::FunctionCallbackInfo<v8
 
     METHOD_RETURN();
 }
+
+inline void vm_base::s_static_clearResolveCache(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_ENTER();
+
+    METHOD_OVER(0, 0);
+
+    hr = clearResolveCache();
+
+    METHOD_VOID();
+}
 }
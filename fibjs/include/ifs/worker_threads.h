@@ -16,6 +16,7 @@
 namespace fibjs {
 
 class Worker_base;
+class WorkerPool_base;
 
 class worker_threads_base : public object_base {
     DECLARE_CLASS(worker_threads_base);
@@ -43,12 +44,14 @@ public:
 }
 
 #include "ifs/Worker.h"
+#include "ifs/WorkerPool.h"
 
 namespace fibjs {
 inline ClassInfo& worker_threads_base::class_info()
 {
     static ClassData::ClassObject s_object[] = {
-        { "Worker", Worker_base::class_info }
+        { "Worker", Worker_base::class_info },
+        { "WorkerPool", WorkerPool_base::class_info }
     };
 
     static ClassData::ClassProperty s_property[] = {
@@ -17,6 +17,7 @@ namespace fibjs {
 
 class WebSocketMessage_base;
 class WebSocket_base;
+class WebSocketHub_base;
 class Handler_base;
 
 class ws_base : public object_base {
@@ -38,6 +39,9 @@ public:
 
 public:
     // ws_base
+    static result_t get_compressMemory(int64_t& retVal);
+    static result_t get_compressMemoryLimit(int64_t& retVal);
+    static result_t set_compressMemoryLimit(int64_t newVal);
     static result_t upgrade(v8::Local<v8::Function> accept, obj_ptr<Handler_base>& retVal);
     static result_t upgrade(v8::Local<v8::Object> opts, v8::Local<v8::Function> accept, obj_ptr<Handler_base>& retVal);
 
@@ -51,12 +55,16 @@ public:
     }
 
 public:
+    static void s_static_get_compressMemory(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_static_get_compressMemoryLimit(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args);
+    static void s_static_set_compressMemoryLimit(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args);
     static void s_static_upgrade(const v8::FunctionCallbackInfo<v8::Value>& args);
 };
 }
 
 #include "ifs/WebSocketMessage.h"
 #include "ifs/WebSocket.h"
+#include "ifs/WebSocketHub.h"
 #include "ifs/Handler.h"
 
 namespace fibjs {
@@ -68,7 +76,13 @@ inline ClassInfo& ws_base::class_info()
 
     static ClassData::ClassObject s_object[] = {
         { "Message", WebSocketMessage_base::class_info },
-        { "Socket", WebSocket_base::class_info }
+        { "Socket", WebSocket_base::class_info },
+        { "Hub", WebSocketHub_base::class_info }
+    };
+
+    static ClassData::ClassProperty s_property[] = {
+        { "compressMemory", s_static_get_compressMemory, block_set, true },
+        { "compressMemoryLimit", s_static_get_compressMemoryLimit, s_static_set_compressMemoryLimit, true }
     };
 
     static ClassData::ClassConst s_const[] = {
@@ -86,7 +100,7 @@ inline ClassInfo& ws_base::class_info()
 
     static ClassData s_cd = {
         "ws", true, s__new, NULL,
-        ARRAYSIZE(s_method), s_method, ARRAYSIZE(s_object), s_object, 0, NULL, ARRAYSIZE(s_const), s_const, NULL, NULL,
+        ARRAYSIZE(s_method), s_method, ARRAYSIZE(s_object), s_object, ARRAYSIZE(s_property), s_property, ARRAYSIZE(s_const), s_const, NULL, NULL,
         &object_base::class_info(),
         false
     };
@@ -95,6 +109,38 @@ inline ClassInfo& ws_base::class_info()
     return s_ci;
 }
 
+inline void ws_base::s_static_get_compressMemory(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int64_t vr;
+
+    PROPERTY_ENTER();
+
+    hr = get_compressMemory(vr);
+
+    METHOD_RETURN();
+}
+
+inline void ws_base::s_static_get_compressMemoryLimit(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args)
+{
+    int64_t vr;
+
+    PROPERTY_ENTER();
+
+    hr = get_compressMemoryLimit(vr);
+
+    METHOD_RETURN();
+}
+
+inline void ws_base::s_static_set_compressMemoryLimit(v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& args)
+{
+    PROPERTY_ENTER();
+    PROPERTY_VAL(int64_t);
+
+    hr = set_compressMemoryLimit(v0);
+
+    PROPERTY_SET_LEAVE();
+}
+
 inline void ws_base::s_static_upgrade(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
     obj_ptr<Handler_base> vr;
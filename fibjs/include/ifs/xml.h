@@ -17,6 +17,7 @@ namespace fibjs {
 
 class XmlDocument_base;
 class Buffer_base;
+class Stream_base;
 class XmlNode_base;
 
 class xml_base : public object_base {
@@ -38,6 +39,7 @@ public:
     // xml_base
     static result_t parse(exlib::string source, exlib::string type, obj_ptr<XmlDocument_base>& retVal);
     static result_t parse(Buffer_base* source, exlib::string type, obj_ptr<XmlDocument_base>& retVal);
+    static result_t parseStream(Stream_base* stream, v8::Local<v8::Object> handlers, v8::Local<v8::Object> opts);
     static result_t serialize(XmlNode_base* node, exlib::string& retVal);
 
 public:
@@ -51,12 +53,14 @@ public:
 
 public:
     static void s_static_parse(const v8::FunctionCallbackInfo<v8::Value>& args);
+    static void s_static_parseStream(const v8::FunctionCallbackInfo<v8::Value>& args);
     static void s_static_serialize(const v8::FunctionCallbackInfo<v8::Value>& args);
 };
 }
 
 #include "ifs/XmlDocument.h"
 #include "ifs/Buffer.h"
+#include "ifs/Stream.h"
 #include "ifs/XmlNode.h"
 
 namespace fibjs {
@@ -64,6 +68,7 @@ inline ClassInfo& xml_base::class_info()
 {
     static ClassData::ClassMethod s_method[] = {
         { "parse", s_static_parse, true, false },
+        { "parseStream", s_static_parseStream, true, false },
         { "serialize", s_static_serialize, true, false }
     };
 
@@ -116,6 +121,21 @@ inline void xml_base::s_static_parse(const v8::FunctionCallbackInfo<v8::Value>&
     METHOD_RETURN();
 }
 
+inline void xml_base::s_static_parseStream(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    METHOD_ENTER();
+
+    METHOD_OVER(3, 2);
+
+    ARG(obj_ptr<Stream_base>, 0);
+    ARG(v8::Local<v8::Object>, 1);
+    OPT_ARG(v8::Local<v8::Object>, 2, v8::Object::New(isolate->m_isolate));
+
+    hr = parseStream(v0, v1, v2);
+
+    METHOD_VOID();
+}
+
 inline void xml_base::s_static_serialize(const v8::FunctionCallbackInfo<v8::Value>& args)
 {
     exlib::string vr;
@@ -31,6 +31,19 @@ extern bool g_track_native_object;
 
 extern bool g_openssl_legacy_provider;
 
+extern exlib::string g_snapshot_blob;
+extern bool g_build_snapshot;
+extern std::vector<exlib::string> g_snapshot_modules;
+
+extern bool g_resolve_cache;
+extern bool g_resolve_cache_watch;
+extern exlib::string g_resolve_cache_file;
+
+extern bool g_trace_builtins;
+
+extern int32_t g_script_cache_size;
+extern exlib::string g_script_cache_dir;
+
 struct OptData {
     const char* name;
     int32_t size;
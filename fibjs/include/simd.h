@@ -0,0 +1,151 @@
+/*
+ * simd.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FIBJS_SIMD_SSE2
+
+#if defined(__GNUC__) || defined(__clang__)
+#include <tmmintrin.h>
+#define FIBJS_SIMD_SSSE3_DISPATCH
+#define FIBJS_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+
+#elif defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define FIBJS_SIMD_NEON
+#endif
+
+namespace fibjs {
+
+inline bool cpu_has_ssse3()
+{
+#if defined(FIBJS_SIMD_SSSE3_DISPATCH) && !defined(_WIN32)
+    static const bool s_ssse3 = __builtin_cpu_supports("ssse3");
+    return s_ssse3;
+#else
+    return false;
+#endif
+}
+
+inline uint64_t simd_load64(const void* p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// count the leading ascii bytes of src, examined 16 (or 8) bytes at a time.
+inline size_t ascii_prefix(const char* src, size_t len)
+{
+    size_t i = 0;
+
+#if defined(FIBJS_SIMD_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        int32_t mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(src + i)));
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#elif defined(FIBJS_SIMD_NEON)
+    for (; i + 16 <= len; i += 16)
+        if (vmaxvq_u8(vld1q_u8((const uint8_t*)src + i)) >= 0x80)
+            break;
+#endif
+
+    for (; i + 8 <= len; i += 8)
+        if (simd_load64(src + i) & 0x8080808080808080ull)
+            break;
+
+    while (i < len && (unsigned char)src[i] < 0x80)
+        i++;
+
+    return i;
+}
+
+// count the leading ascii code units of src.
+inline size_t ascii_prefix(const char16_t* src, size_t len)
+{
+    size_t i = 0;
+
+#if defined(FIBJS_SIMD_SSE2)
+    const __m128i mask = _mm_set1_epi16((int16_t)0xff80);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 8 <= len; i += 8) {
+        __m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + i)), mask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(v, zero)) != 0xffff)
+            break;
+    }
+#elif defined(FIBJS_SIMD_NEON)
+    for (; i + 8 <= len; i += 8)
+        if (vmaxvq_u16(vld1q_u16((const uint16_t*)src + i)) >= 0x80)
+            break;
+#else
+    for (; i + 4 <= len; i += 4)
+        if (simd_load64(src + i) & 0xff80ff80ff80ff80ull)
+            break;
+#endif
+
+    while (i < len && src[i] < 0x80)
+        i++;
+
+    return i;
+}
+
+// widen len ascii bytes to utf-16, caller must make sure src is ascii.
+inline void ascii_widen(const char* src, char16_t* dst, size_t len)
+{
+    size_t i = 0;
+
+#if defined(FIBJS_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#elif defined(FIBJS_SIMD_NEON)
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t*)src + i);
+        vst1q_u16((uint16_t*)dst + i, vmovl_u8(vget_low_u8(v)));
+        vst1q_u16((uint16_t*)dst + i + 8, vmovl_high_u8(v));
+    }
+#endif
+
+    for (; i < len; i++)
+        dst[i] = (char16_t)src[i];
+}
+
+// narrow len ascii code units to utf-8, caller must make sure src is ascii.
+inline void ascii_narrow(const char16_t* src, char* dst, size_t len)
+{
+    size_t i = 0;
+
+#if defined(FIBJS_SIMD_SSE2)
+    for (; i + 16 <= len; i += 16) {
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i v2 = _mm_loadu_si128((const __m128i*)(src + i + 8));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(v1, v2));
+    }
+#elif defined(FIBJS_SIMD_NEON)
+    for (; i + 16 <= len; i += 16) {
+        uint16x8_t v1 = vld1q_u16((const uint16_t*)src + i);
+        uint16x8_t v2 = vld1q_u16((const uint16_t*)src + i + 8);
+        vst1q_u8((uint8_t*)dst + i, vcombine_u8(vmovn_u16(v1), vmovn_u16(v2)));
+    }
+#endif
+
+    for (; i < len; i++)
+        dst[i] = (char)src[i];
+}
+}
@@ -14,9 +14,12 @@
 #include "ifs/global.h"
 #include "SecureContext.h"
 #include "HttpClient.h"
+#include "Script.h"
 #include "SandBox.h"
 #include "TTYStream.h"
 #include "EventEmitter.h"
+#include "Snapshot.h"
+#include <uv/include/uv.h>
 #include "v8/include/libplatform/libplatform.h"
 
 using namespace v8;
@@ -146,6 +149,8 @@ Isolate::Isolate(exlib::string jsFilename, exlib::string jsCode)
 {
     s_isolates.putTail(this);
 
+    m_start_time = uv_hrtime();
+
     if (jsCode.empty())
         m_fname = jsFilename;
     else
@@ -153,20 +158,9 @@ Isolate::Isolate(exlib::string jsFilename, exlib::string jsCode)
 
     static v8::Isolate::CreateParams create_params;
     static ShellArrayBufferAllocator array_buffer_allocator;
-    static v8::StartupData blob;
-
-    if (blob.data == NULL) {
-        v8::SnapshotCreator creator;
-        v8::Isolate* isolate = creator.GetIsolate();
-        {
-            v8::HandleScope handle_scope(isolate);
-            v8::Local<v8::Context> context = v8::Context::New(isolate);
-            creator.SetDefaultContext(context);
-        }
-        blob = creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
-    }
 
-    create_params.snapshot_blob = &blob;
+    create_params.snapshot_blob = startup_snapshot();
+    create_params.external_references = snapshot_external_references();
     create_params.array_buffer_allocator = &array_buffer_allocator;
 
     m_isolate = v8::Isolate::New(create_params);
@@ -273,34 +267,17 @@ void Isolate::init()
     _context->SetEmbedderData(kObjectPrototype, v8::Object::New(m_isolate)->GetPrototype());
     _context->SetEmbedderData(kSandboxObject, global_base::class_info().getModule(this));
 
-    const char* assertion_error = "class AssertionError extends Error {"
-                                  "   constructor(options) {"
-                                  "       var { actual, expected, message, operator } = options;"
-                                  "       if (message) {"
-                                  "           super(message);"
-                                  "       } else {"
-                                  "           if (actual && actual.stack && actual instanceof Error)"
-                                  "               actual = `${actual.name}: ${actual.message}`;"
-                                  "           if (expected && expected.stack && expected instanceof Error)"
-                                  "               expected = `${expected.name}: ${expected.message}`;"
-                                  "           super(`${JSON.stringify(actual).slice(0, 128)} ` +"
-                                  "               `${operator} ${JSON.stringify(expected).slice(0, 128)}`);"
-                                  "       }"
-                                  "       this.generatedMessage = !message;"
-                                  "       this.name = 'AssertionError [ERR_ASSERTION]';"
-                                  "       this.code = 'ERR_ASSERTION';"
-                                  "       this.actual = actual;"
-                                  "       this.expected = expected;"
-                                  "       this.operator = operator;"
-                                  "   }"
-                                  "}"
-                                  "AssertionError;";
-
-    v8::Local<v8::Script> script = v8::Script::Compile(_context, NewString(assertion_error)).FromMaybe(v8::Local<v8::Script>());
-    v8::Local<v8::Value> result = script->Run(_context).FromMaybe(v8::Local<v8::Value>());
-    v8::Local<v8::Object> AssertionError = result.As<v8::Object>();
+    // the shims and the preloaded modules come with the startup snapshot,
+    // once per context
+    v8::Local<v8::Object> AssertionError;
+    if (!_context->GetDataFromSnapshotOnce<v8::Object>(kSnapshotAssertionError).ToLocal(&AssertionError))
+        AssertionError = compile_AssertionError(m_isolate, _context);
     m_AssertionError.Reset(m_isolate, AssertionError);
 
+    v8::Local<v8::Object> snapshot_modules;
+    if (_context->GetDataFromSnapshotOnce<v8::Object>(kSnapshotModules).ToLocal(&snapshot_modules))
+        m_snapshot_modules.Reset(m_isolate, snapshot_modules);
+
     m_isolate->SetPromiseRejectCallback(_PromiseRejectCallback);
     m_isolate->SetHostImportModuleDynamicallyCallback(SandBox::ImportModuleDynamically);
 
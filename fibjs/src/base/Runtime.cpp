@@ -8,6 +8,7 @@
 #include "object.h"
 #include "options.h"
 #include "Runtime.h"
+#include "Bundle.h"
 #include "fibjs.h"
 #include "ifs/os.h"
 #include "ifs/process.h"
@@ -95,8 +96,10 @@ void start(int32_t argc, char** argv, result_t (*jsEntryFiber)(Isolate*), Isolat
 
             process_base::get_execPath(exePath);
 
-            bool bZip;
-            ifZipFile(exePath, bZip);
+            // a bundle appended to the executable is mapped here, once
+            bool bZip = Bundle::is_bundle(exePath);
+            if (!bZip)
+                ifZipFile(exePath, bZip);
             if (bZip) {
 
                 exePath.append(1, '$');
@@ -30,9 +30,16 @@ public:
 public:
     void put(AsyncEvent* ac)
     {
+        m_pending.inc();
         m_pool.put(ac);
     }
 
+    void stats(int32_t& pending, int32_t& workers)
+    {
+        pending = (int32_t)m_pending.value();
+        workers = (int32_t)m_workers.value();
+    }
+
 private:
     void new_worker()
     {
@@ -75,6 +82,7 @@ private:
         Runtime rtForThread(NULL);
         AsyncEvent* p;
 
+        m_workers.inc();
         m_idleWorkers.dec();
 
         while (true) {
@@ -86,12 +94,15 @@ private:
             }
 
             p = m_pool.get();
+            m_pending.dec();
             if (m_idleWorkers.dec() == 0)
                 if (m_idleWorkers.CompareAndSwap(0, 1) == 0)
                     new_worker();
 
             p->invoke();
         }
+
+        m_workers.dec();
     }
 
     static void FiberProcWorker(void* ptr)
@@ -104,11 +115,18 @@ private:
     int32_t m_max_idle;
     exlib::Queue<AsyncEvent> m_pool;
     exlib::atomic m_idleWorkers;
+    exlib::atomic m_pending;
+    exlib::atomic m_workers;
 };
 
 static acPool* s_acPool;
 static acPool* s_lsPool;
 
+void acPoolStats(bool longsync, int32_t& pending, int32_t& workers)
+{
+    (longsync ? s_lsPool : s_acPool)->stats(pending, workers);
+}
+
 void putGuiPool(AsyncEvent* ac);
 
 void AsyncEvent::async(int32_t type)
@@ -122,6 +140,7 @@ void AsyncEvent::async(int32_t type)
 }
 
 AsyncCallBack::AsyncCallBack(v8::Local<v8::Function> cb, object_base* pThis)
+    : m_deadline(current_deadline())
 {
     if (pThis) {
         m_pThis = pThis;
@@ -614,6 +614,68 @@ void date_t::sqlString(exlib::string& retVal)
     putInt(ptrBuf, ds.wSecond, 2);
 }
 
+void date_t::clfString(exlib::string& retVal)
+{
+    if (std::isnan(d))
+        return;
+
+    static char szMonth[][4] = {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct",
+        "Nov", "Dec"
+    };
+
+    int64_t local = s_dc->ToLocal((int64_t)d);
+    int32_t offset = (int32_t)((local - (int64_t)d) / 60000);
+    Part ds = _getdate((double)local);
+
+    retVal.resize(26);
+    char* ptrBuf = retVal.data();
+
+    putInt(ptrBuf, ds.wDay + 1, 2);
+    *ptrBuf++ = '/';
+    putStr(ptrBuf, szMonth[ds.wMonth], 3);
+    *ptrBuf++ = '/';
+    putInt(ptrBuf, ds.wYear, 4);
+    *ptrBuf++ = ':';
+    putInt(ptrBuf, ds.wHour, 2);
+    *ptrBuf++ = ':';
+    putInt(ptrBuf, ds.wMinute, 2);
+    *ptrBuf++ = ':';
+    putInt(ptrBuf, ds.wSecond, 2);
+    *ptrBuf++ = ' ';
+    *ptrBuf++ = offset < 0 ? '-' : '+';
+    if (offset < 0)
+        offset = -offset;
+    putInt(ptrBuf, offset / 60, 2);
+    putInt(ptrBuf, offset % 60, 2);
+}
+
+void date_t::isoString(exlib::string& retVal)
+{
+    if (std::isnan(d))
+        return;
+
+    Part ds = _getdate(d);
+
+    retVal.resize(24);
+    char* ptrBuf = retVal.data();
+
+    putInt(ptrBuf, ds.wYear, 4);
+    *ptrBuf++ = '-';
+    putInt(ptrBuf, ds.wMonth + 1, 2);
+    *ptrBuf++ = '-';
+    putInt(ptrBuf, ds.wDay + 1, 2);
+    *ptrBuf++ = 'T';
+    putInt(ptrBuf, ds.wHour, 2);
+    *ptrBuf++ = ':';
+    putInt(ptrBuf, ds.wMinute, 2);
+    *ptrBuf++ = ':';
+    putInt(ptrBuf, ds.wSecond, 2);
+    *ptrBuf++ = '.';
+    putInt(ptrBuf, ds.wMillisecond, 3);
+    *ptrBuf++ = 'Z';
+}
+
 void date_t::stamp(exlib::string& retVal)
 {
     if (std::isnan(d))
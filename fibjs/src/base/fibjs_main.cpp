@@ -48,9 +48,10 @@ result_t FiberProcJsEntry(Isolate* isolate)
         v8::Local<v8::Object> glob = _context->Global();
 
         while (pModule) {
-            glob->DefineOwnProperty(_context,
+            glob->SetLazyDataProperty(_context,
                     isolate->NewString(pModule->name()),
-                    pModule->getModule(isolate),
+                    SandBox::lazy_builtin,
+                    v8::External::New(isolate->m_isolate, pModule),
                     (v8::PropertyAttribute)(v8::DontEnum))
                 .IsJust();
             pModule = pModule->m_next;
@@ -40,6 +40,19 @@ bool g_openssl_legacy_provider = false;
 
 exlib::string g_exec_code;
 
+exlib::string g_snapshot_blob;
+bool g_build_snapshot = false;
+std::vector<exlib::string> g_snapshot_modules;
+
+bool g_resolve_cache = false;
+bool g_resolve_cache_watch = false;
+exlib::string g_resolve_cache_file;
+
+bool g_trace_builtins = false;
+
+int32_t g_script_cache_size = 1024;
+exlib::string g_script_cache_dir;
+
 #ifdef DEBUG
 #define GUARD_SIZE 32
 #else
@@ -72,6 +85,16 @@ static void printHelp()
          "\n"
          "  --openssl-legacy-provider   enable OpenSSL 3.0 legacy provider.\n"
          "\n"
+         "  --snapshot-blob=file        start from the startup snapshot in file.\n"
+         "  --build-snapshot --snapshot-blob=file [module.js ...]\n"
+         "                              write a startup snapshot with the given modules preloaded.\n"
+         "\n"
+         "  --resolve-cache[=file]      cache module resolution, and keep it in file between runs.\n"
+         "  --resolve-cache-watch       cache module resolution, and drop what changes on disk.\n"
+         "  --trace-builtins            report which builtin modules were used when exiting.\n"
+         "  --script-cache=dir          keep the code cache of vm.Script in dir between runs.\n"
+         "  --script-cache-size=n       number of vm.Script compilations kept per isolate (default: 1024).\n"
+         "\n"
          "  --prof                      log statistical profiling information.\n"
          "  --prof-interval=n           interval for --prof samples (in microseconds, default: 1000).\n"
          "  --prof-process              process log file generated by profiler.start.\n"
@@ -145,6 +168,32 @@ void options(int32_t& pos, char* argv[])
         } else if (!qstrcmp(arg, "--openssl-legacy-provider")) {
             g_openssl_legacy_provider = true;
             df++;
+        } else if (!qstrcmp(arg, "--snapshot-blob=", 16)) {
+            g_snapshot_blob = arg + 16;
+            df++;
+        } else if (!qstrcmp(arg, "--build-snapshot")) {
+            g_build_snapshot = true;
+            df++;
+        } else if (!qstrcmp(arg, "--resolve-cache")) {
+            g_resolve_cache = true;
+            df++;
+        } else if (!qstrcmp(arg, "--resolve-cache=", 16)) {
+            g_resolve_cache = true;
+            g_resolve_cache_file = arg + 16;
+            df++;
+        } else if (!qstrcmp(arg, "--resolve-cache-watch")) {
+            g_resolve_cache = true;
+            g_resolve_cache_watch = true;
+            df++;
+        } else if (!qstrcmp(arg, "--trace-builtins")) {
+            g_trace_builtins = true;
+            df++;
+        } else if (!qstrcmp(arg, "--script-cache=", 15)) {
+            g_script_cache_dir = arg + 15;
+            df++;
+        } else if (!qstrcmp(arg, "--script-cache-size=", 20)) {
+            g_script_cache_size = atoi(arg + 20);
+            df++;
         } else if (!qstrcmp(arg, "--cov=", 6)) {
             g_cov = fopen(arg + 6, "a");
             if (g_cov == nullptr) {
@@ -175,6 +224,16 @@ void options(int32_t& pos, char* argv[])
         }
     }
 
+    if (g_build_snapshot) {
+        if (g_snapshot_blob.empty()) {
+            puts("--build-snapshot requires --snapshot-blob=file");
+            _exit(1);
+        }
+
+        for (int32_t j = i; j < pos; j++)
+            g_snapshot_modules.push_back(argv[j]);
+    }
+
     pos = i;
     int32_t argc = pos - df;
 
@@ -0,0 +1,241 @@
+/*
+ * snapshot.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "options.h"
+#include "ifs/path.h"
+#include "Snapshot.h"
+#include "SandBox.h"
+#include <stdio.h>
+
+namespace fibjs {
+
+static const char* s_assertion_error = "class AssertionError extends Error {"
+                                       "   constructor(options) {"
+                                       "       var { actual, expected, message, operator } = options;"
+                                       "       if (message) {"
+                                       "           super(message);"
+                                       "       } else {"
+                                       "           if (actual && actual.stack && actual instanceof Error)"
+                                       "               actual = `${actual.name}: ${actual.message}`;"
+                                       "           if (expected && expected.stack && expected instanceof Error)"
+                                       "               expected = `${expected.name}: ${expected.message}`;"
+                                       "           super(`${JSON.stringify(actual).slice(0, 128)} ` +"
+                                       "               `${operator} ${JSON.stringify(expected).slice(0, 128)}`);"
+                                       "       }"
+                                       "       this.generatedMessage = !message;"
+                                       "       this.name = 'AssertionError [ERR_ASSERTION]';"
+                                       "       this.code = 'ERR_ASSERTION';"
+                                       "       this.actual = actual;"
+                                       "       this.expected = expected;"
+                                       "       this.operator = operator;"
+                                       "   }"
+                                       "}"
+                                       "AssertionError;";
+
+v8::Local<v8::Object> compile_AssertionError(v8::Isolate* isolate, v8::Local<v8::Context> context)
+{
+    v8::Local<v8::Script> script = v8::Script::Compile(context, NewString(isolate, s_assertion_error)).FromMaybe(v8::Local<v8::Script>());
+    v8::Local<v8::Value> result = script->Run(context).FromMaybe(v8::Local<v8::Value>());
+    return result.As<v8::Object>();
+}
+
+static bool read_file(exlib::string fname, exlib::string& retVal)
+{
+    FILE* fp = fopen(fname.c_str(), "rb");
+    if (fp == NULL)
+        return false;
+
+    char buf[8192];
+    size_t sz;
+
+    while ((sz = fread(buf, 1, sizeof(buf), fp)) > 0)
+        retVal.append(buf, sz);
+
+    bool ok = !ferror(fp);
+    fclose(fp);
+
+    return ok;
+}
+
+// the require of a preloaded module resolves relative ids against the
+// directory of that module, and tries the .js and .json extensions.
+static void snapshot_require(const v8::FunctionCallbackInfo<v8::Value>& args)
+{
+    static const char* s_exts[] = { "", ".js", ".json" };
+
+    v8::Isolate* isolate = args.GetIsolate();
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    v8::Local<v8::Array> data = args.Data().As<v8::Array>();
+    v8::Local<v8::Object> modules = data->Get(context, 0).ToLocalChecked().As<v8::Object>();
+    exlib::string id = ToString(isolate, args[0]);
+    v8::Local<v8::Value> m;
+
+    if (SandBox::is_relative(id))
+        id = ToString(isolate, data->Get(context, 1).ToLocalChecked()) + PATH_SLASH + id;
+    path_base::normalize(id, id);
+
+    for (int32_t i = 0; i < (int32_t)ARRAYSIZE(s_exts); i++)
+        if (modules->Get(context, NewString(isolate, id + s_exts[i])).ToLocal(&m) && m->IsObject()) {
+            args.GetReturnValue().Set(m.As<v8::Object>()->Get(context, NewString(isolate, "exports")).FromMaybe(v8::Local<v8::Value>()));
+            return;
+        }
+
+    isolate->ThrowException(v8::Exception::Error(NewString(isolate, "snapshot: module " + id + " is not preloaded.")));
+}
+
+// native functions that can be reached from the snapshot heap
+static const intptr_t s_external_references[] = {
+    (intptr_t)snapshot_require,
+    0
+};
+
+const intptr_t* snapshot_external_references()
+{
+    return s_external_references;
+}
+
+// run a preloaded module as CommonJS in the snapshot context. it runs before
+// any binding exists, so it can only use the JavaScript builtins and the
+// modules preloaded before it. a .json module is parsed into its exports.
+static void preload_module(v8::Isolate* isolate, v8::Local<v8::Context> context,
+    v8::Local<v8::Object> modules, exlib::string fname)
+{
+    exlib::string src;
+
+    path_base::fullpath(fname, fname);
+    if (!read_file(fname, src)) {
+        printf("Can't open file: %s\n", fname.c_str());
+        _exit(1);
+    }
+
+    exlib::string dirname;
+    path_base::dirname(fname, dirname);
+
+    exlib::string extname;
+    path_base::extname(fname, extname);
+
+    v8::TryCatch try_catch(isolate);
+    v8::Local<v8::Object> module = v8::Object::New(isolate);
+
+    module->Set(context, NewString(isolate, "filename"), NewString(isolate, fname)).IsJust();
+
+    if (extname == ".json") {
+        v8::Local<v8::Value> exports;
+
+        if (v8::JSON::Parse(context, NewString(isolate, src)).ToLocal(&exports)) {
+            module->Set(context, NewString(isolate, "exports"), exports).IsJust();
+            modules->Set(context, NewString(isolate, fname), module).IsJust();
+            return;
+        }
+    } else {
+        src = "(function (exports, require, module, __filename, __dirname) {" + src + "\n})";
+
+        v8::ScriptOrigin origin(isolate, NewString(isolate, fname));
+        v8::Local<v8::Script> script;
+        v8::Local<v8::Value> fn;
+
+        if (v8::Script::Compile(context, NewString(isolate, src), &origin).ToLocal(&script)
+            && script->Run(context).ToLocal(&fn)) {
+            v8::Local<v8::Object> exports = v8::Object::New(isolate);
+            v8::Local<v8::Array> data = v8::Array::New(isolate, 2);
+
+            data->Set(context, 0, modules).IsJust();
+            data->Set(context, 1, NewString(isolate, dirname)).IsJust();
+            v8::Local<v8::Function> require = v8::Function::New(context, snapshot_require, data).ToLocalChecked();
+
+            module->Set(context, NewString(isolate, "exports"), exports).IsJust();
+
+            v8::Local<v8::Value> args[] = {
+                exports, require, module, NewString(isolate, fname), NewString(isolate, dirname)
+            };
+
+            if (!fn.As<v8::Function>()->Call(context, context->Global(), 5, args).IsEmpty()) {
+                modules->Set(context, NewString(isolate, fname), module).IsJust();
+                return;
+            }
+        }
+    }
+
+    v8::String::Utf8Value msg(isolate, try_catch.Exception());
+    printf("%s: %s\n", fname.c_str(), *msg ? *msg : "unknown error");
+    _exit(1);
+}
+
+static void build_snapshot(v8::StartupData& blob)
+{
+    v8::SnapshotCreator creator(s_external_references);
+    v8::Isolate* isolate = creator.GetIsolate();
+    bool preload = !g_snapshot_modules.empty();
+
+    {
+        v8::HandleScope handle_scope(isolate);
+        v8::Local<v8::Context> context = v8::Context::New(isolate);
+        v8::Context::Scope context_scope(context);
+
+        creator.AddData(context, compile_AssertionError(isolate, context));
+
+        v8::Local<v8::Object> modules = v8::Object::New(isolate);
+        for (size_t i = 0; i < g_snapshot_modules.size(); i++)
+            preload_module(isolate, context, modules, g_snapshot_modules[i]);
+        creator.AddData(context, modules);
+
+        creator.SetDefaultContext(context);
+    }
+
+    // keep the bytecode of preloaded modules so they do not compile again
+    blob = creator.CreateBlob(preload ? v8::SnapshotCreator::FunctionCodeHandling::kKeep
+                                      : v8::SnapshotCreator::FunctionCodeHandling::kClear);
+}
+
+const v8::StartupData* startup_snapshot()
+{
+    static v8::StartupData blob;
+
+    if (blob.data != NULL)
+        return &blob;
+
+    if (g_build_snapshot) {
+        build_snapshot(blob);
+
+        FILE* fp = fopen(g_snapshot_blob.c_str(), "wb");
+        if (fp == NULL || fwrite(blob.data, 1, blob.raw_size, fp) != (size_t)blob.raw_size) {
+            printf("Can't write file: %s\n", g_snapshot_blob.c_str());
+            _exit(1);
+        }
+        fclose(fp);
+
+        _exit(0);
+    }
+
+    if (!g_snapshot_blob.empty()) {
+        exlib::string data;
+
+        if (!read_file(g_snapshot_blob, data)) {
+            printf("Can't open file: %s\n", g_snapshot_blob.c_str());
+            _exit(1);
+        }
+
+        char* buf = new char[data.length()];
+        memcpy(buf, data.c_str(), data.length());
+
+        blob.data = buf;
+        blob.raw_size = (int)data.length();
+
+        if (!blob.IsValid()) {
+            printf("Invalid snapshot blob: %s, it was built by another version of fibjs.\n", g_snapshot_blob.c_str());
+            _exit(1);
+        }
+
+        return &blob;
+    }
+
+    build_snapshot(blob);
+    return &blob;
+}
+
+} /* namespace fibjs */
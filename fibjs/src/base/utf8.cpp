@@ -1,4 +1,6 @@
 #include "utf8.h"
+#include "simd.h"
+#include <algorithm>
 
 namespace fibjs {
 
@@ -293,14 +295,61 @@ ssize_t utf_putchar(char32_t ch, char32_t*& dst, const char32_t* end)
     return _putchar(ch, dst, end);
 }
 
+template <typename T1>
+inline ssize_t _ascii_skip(const T1*& src, const T1* src_end)
+{
+    return 0;
+}
+
+inline ssize_t _ascii_skip(const char*& src, const char* src_end)
+{
+    ssize_t n = (ssize_t)ascii_prefix(src, src_end - src);
+    src += n;
+    return n;
+}
+
+inline ssize_t _ascii_skip(const char16_t*& src, const char16_t* src_end)
+{
+    ssize_t n = (ssize_t)ascii_prefix(src, src_end - src);
+    src += n;
+    return n;
+}
+
+template <typename T1, typename T2>
+inline ssize_t _ascii_copy(const T1*& src, const T1* src_end, T2*& dst, const T2* dst_end)
+{
+    return 0;
+}
+
+inline ssize_t _ascii_copy(const char*& src, const char* src_end, char16_t*& dst, const char16_t* dst_end)
+{
+    ssize_t n = (ssize_t)ascii_prefix(src, std::min(src_end - src, dst_end - dst));
+    ascii_widen(src, dst, n);
+    src += n;
+    dst += n;
+    return n;
+}
+
+inline ssize_t _ascii_copy(const char16_t*& src, const char16_t* src_end, char*& dst, const char* dst_end)
+{
+    ssize_t n = (ssize_t)ascii_prefix(src, std::min(src_end - src, dst_end - dst));
+    ascii_narrow(src, dst, n);
+    src += n;
+    dst += n;
+    return n;
+}
+
 template <typename T1, typename T2>
 inline ssize_t _test(const T1* src, ssize_t srclen, T2* dst)
 {
     ssize_t count = 0;
     const T1* src_end = src + srclen;
 
-    while (src < src_end)
-        count += _putchar(_getchar(src, src_end), dst, dst);
+    while (src < src_end) {
+        count += _ascii_skip(src, src_end);
+        if (src < src_end)
+            count += _putchar(_getchar(src, src_end), dst, dst);
+    }
 
     return count;
 }
@@ -316,6 +365,12 @@ inline ssize_t _convert(const T1* src, ssize_t srclen, T2* dst, ssize_t dstlen)
         char32_t ch = *src;
 
         if (ch < 0x80) {
+            ssize_t n = _ascii_copy(src, src_end, dst, dst_end);
+            if (n) {
+                count += n;
+                continue;
+            }
+
             src++;
             *dst++ = ch;
             count++;
@@ -10,12 +10,14 @@
 #include "ifs/os.h"
 #include "ifs/process.h"
 #include "options.h"
+#include "Metrics.h"
 
 namespace fibjs {
 
 #define MAX_IDLE 256
 
 int32_t g_spareFibers = MAX_IDLE;
+exlib::atomic g_pendingJobs;
 static exlib::fiber_local<JSFiber*> s_current;
 
 void JSFiber::FiberProcRunJavascript(void* p)
@@ -59,6 +61,9 @@ void JSFiber::FiberProcRunJavascript(void* p)
                 v8::HandleScope handle_scope(isolate->m_isolate);
                 AsyncEvent* ae = (AsyncEvent*)isolate->m_jobs.getHead();
 
+                g_pendingJobs.dec();
+                metrics_loop_lag()->observe(Metric::now() - ae->m_queued);
+
                 hr = ae->js_invoke();
             }
 
@@ -76,6 +81,8 @@ void JSFiber::set_caller(Fiber_base* caller)
     m_caller = caller;
 
     if (m_caller) {
+        m_deadline = ((JSFiber*)caller)->m_deadline;
+
         v8::Local<v8::Object> co = m_caller->wrap();
         v8::Local<v8::Object> o = wrap();
         v8::Local<v8::Context> context = co->GetCreationContextChecked();
@@ -156,11 +163,32 @@ result_t JSFiber::get_stack_usage(int32_t& retVal)
     return 0;
 }
 
+result_t JSFiber::get_deadline(double& retVal)
+{
+    retVal = m_deadline;
+    return 0;
+}
+
+result_t JSFiber::set_deadline(double newVal)
+{
+    if (newVal < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    m_deadline = newVal;
+    return 0;
+}
+
 JSFiber* JSFiber::current()
 {
     return s_current;
 }
 
+double current_deadline()
+{
+    JSFiber* fb = s_current;
+    return fb ? fb->m_deadline : 0;
+}
+
 result_t JSFiber::js_invoke()
 {
     EnterJsScope s(this);
@@ -0,0 +1,394 @@
+/*
+ * WorkerPool.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "WorkerPool.h"
+#include "SandBox.h"
+#include "Fiber.h"
+#include "path.h"
+#include "ifs/os.h"
+#include <uv/include/uv.h>
+
+namespace fibjs {
+
+result_t WorkerPool_base::_new(exlib::string path, v8::Local<v8::Object> opts,
+    obj_ptr<WorkerPool_base>& retVal, v8::Local<v8::Object> This)
+{
+    Isolate* isolate = Isolate::current();
+    bool isAbs = false;
+    path_base::isAbsolute(path, isAbs);
+    if (!isAbs)
+        return CHECK_ERROR(Runtime::setError("WorkerPool: only accept absolute path."));
+
+    result_t hr;
+    int32_t size = 0;
+
+    hr = GetConfigValue(isolate, opts, "size", size, true);
+    if (hr == CALL_E_PARAMNOTOPTIONAL)
+        os_base::cpuNumbers(size);
+    else if (hr < 0)
+        return CHECK_ERROR(hr);
+
+    if (size < 1)
+        return CHECK_ERROR(Runtime::setError("WorkerPool: size must be greater than 0."));
+
+    bool file_system = true;
+    GetConfigValue(isolate, opts, "file_system", file_system, false);
+
+    bool safe_buffer = false;
+    GetConfigValue(isolate, opts, "safe_buffer", safe_buffer, false);
+
+    obj_ptr<WorkerPool> pool = new WorkerPool(path, size, file_system, safe_buffer);
+    pool->wrap(This);
+
+    retVal = pool;
+    return 0;
+}
+
+WorkerPool::WorkerPool(exlib::string path, int32_t size, bool file_system, bool safe_buffer)
+{
+    int32_t i;
+
+    m_core = new Core(path);
+    m_core->m_slots.resize(size);
+
+    for (i = 0; i < size; i++)
+        m_core->m_slots[i] = new Slot(m_core, i);
+
+    for (i = 0; i < size; i++)
+        m_core->m_slots[i]->start(file_system, safe_buffer);
+}
+
+WorkerPool::~WorkerPool()
+{
+    m_core->close();
+}
+
+void WorkerPool::Slot::start(bool file_system, bool safe_buffer)
+{
+    m_isolate = new Isolate(m_core->m_path);
+    m_isolate->m_enable_FileSystem = file_system;
+    m_isolate->m_safe_buffer = safe_buffer;
+
+    syncCall(m_isolate, worker_fiber, this);
+}
+
+result_t WorkerPool::Slot::worker_fiber(Slot* slot)
+{
+    slot->_main();
+    return 0;
+}
+
+void WorkerPool::Slot::_main()
+{
+    obj_ptr<Core> core = m_core;
+    JSFiber::EnterJsScope s;
+    Isolate* isolate = m_isolate;
+    v8::Local<v8::Object> exports;
+
+    isolate->start_profiler();
+
+    isolate->m_topSandbox = new SandBox();
+    isolate->m_topSandbox->addBuiltinModules();
+
+    v8::Local<v8::Value> mod;
+    s.m_hr = isolate->m_topSandbox->require(core->m_path, "/", mod);
+    if (s.m_hr < 0)
+        m_error = GetException(s.try_catch, s.m_hr);
+    else if (!mod->IsObject())
+        m_error = "WorkerPool: module '" + core->m_path + "' has no exports.";
+    else
+        exports = v8::Local<v8::Object>::Cast(mod);
+
+    s.try_catch.Reset();
+    s.m_hr = 0;
+
+    while (true) {
+        obj_ptr<Task> task;
+        bool stolen = false;
+
+        if (!core->next(this, task, stolen)) {
+            if (core->m_closed.value())
+                break;
+
+            // an idle pool must not keep the process alive
+            Isolate::LeaveJsScope _rt(isolate);
+            isolate->Unref();
+            m_sem.wait();
+            isolate->Ref();
+
+            continue;
+        }
+
+        uint64_t tm_start = uv_hrtime();
+        result_t hr;
+
+        m_busy.xchg(1);
+        core->m_pending.dec();
+        core->m_running.inc();
+
+        {
+            v8::HandleScope handle_scope(isolate->m_isolate);
+            hr = invoke(exports, task);
+        }
+
+        core->m_running.dec();
+        m_busy.xchg(0);
+
+        core->record(tm_start - task->m_queued, uv_hrtime() - tm_start, stolen, hr >= 0);
+
+        AsyncEvent* ac = task->m_ac;
+        if (hr >= 0)
+            ac->setPost();
+        ac->post(hr);
+    }
+}
+
+result_t WorkerPool::Slot::invoke(v8::Local<v8::Object> exports, Task* task)
+{
+    if (exports.IsEmpty())
+        return CHECK_ERROR(Runtime::setError(m_error));
+
+    Isolate* isolate = m_isolate;
+    v8::Local<v8::Context> context = isolate->context();
+    TryCatch try_catch;
+
+    JSValue v = exports->Get(context, isolate->NewString(task->m_fn));
+    if (v.IsEmpty() || !v->IsFunction())
+        return CHECK_ERROR(Runtime::setError("WorkerPool: function '" + task->m_fn + "' not found."));
+    v8::Local<v8::Function> func = v8::Local<v8::Function>::Cast(v);
+
+    v8::Local<v8::Value> a;
+    task->m_args->get_data(a);
+
+    v8::Local<v8::Array> args = v8::Local<v8::Array>::Cast(a);
+    int32_t len = args->Length();
+    std::vector<v8::Local<v8::Value>> argv(len);
+    int32_t i;
+
+    for (i = 0; i < len; i++)
+        argv[i] = JSValue(args->Get(context, i));
+
+    v8::Local<v8::Value> result = func->Call(context, exports, len, argv.data()).FromMaybe(v8::Local<v8::Value>());
+    if (!result.IsEmpty() && result->IsPromise())
+        result = isolate->WaitPromise(result);
+
+    if (result.IsEmpty())
+        return CHECK_ERROR(Runtime::setError(GetException(try_catch, CALL_E_JAVASCRIPT)));
+
+    task->m_result = new WorkerMessage(result);
+    return task->m_result->unbind();
+}
+
+void WorkerPool::Core::post(Task* task)
+{
+    int32_t cnt = (int32_t)m_slots.size();
+    int32_t a = (int32_t)((uint32_t)m_cursor.inc() % cnt);
+    int32_t b = (a + 1) % cnt;
+    Slot* slot = m_slots[a];
+    int32_t i;
+
+    // power of two choices: queue on the shorter of two neighbouring slots
+    if (m_slots[b]->depth() + m_slots[b]->m_busy.value() < slot->depth() + slot->m_busy.value())
+        slot = m_slots[b];
+
+    task->m_queued = uv_hrtime();
+    m_pending.inc();
+
+    slot->push(task);
+    slot->m_sem.post();
+
+    // the chosen worker is busy, wake an idle one so it can steal the task
+    if (slot->m_busy.value())
+        for (i = 0; i < cnt; i++)
+            if (!m_slots[i]->m_busy.value() && m_slots[i]->m_sem.count() == 0) {
+                m_slots[i]->m_sem.post();
+                break;
+            }
+}
+
+bool WorkerPool::Core::next(Slot* self, obj_ptr<Task>& task, bool& stolen)
+{
+    int32_t cnt = (int32_t)m_slots.size();
+    int32_t i;
+
+    stolen = false;
+    if (self->pop_front(task))
+        return true;
+
+    for (i = 1; i < cnt; i++)
+        if (m_slots[(self->m_index + i) % cnt]->pop_back(task)) {
+            stolen = true;
+            return true;
+        }
+
+    return false;
+}
+
+int32_t WorkerPool::Core::cancel()
+{
+    int32_t cnt = 0;
+    size_t i;
+
+    for (i = 0; i < m_slots.size(); i++) {
+        std::deque<obj_ptr<Task>> tasks;
+
+        m_slots[i]->drain(tasks);
+        while (!tasks.empty()) {
+            obj_ptr<Task> task = tasks.front();
+            tasks.pop_front();
+
+            m_pending.dec();
+            m_cancelled.inc();
+            cnt++;
+
+            task->m_ac->post(Runtime::setError("WorkerPool: task cancelled."));
+        }
+    }
+
+    return cnt;
+}
+
+void WorkerPool::Core::close()
+{
+    size_t i;
+
+    if (m_closed.xchg(1))
+        return;
+
+    cancel();
+
+    for (i = 0; i < m_slots.size(); i++)
+        m_slots[i]->m_sem.post();
+}
+
+void WorkerPool::Core::record(uint64_t wait, uint64_t run, bool stolen, bool ok)
+{
+    if (ok)
+        m_completed.inc();
+    else
+        m_failed.inc();
+
+    if (stolen)
+        m_stolen.inc();
+
+    m_statLock.lock();
+    m_samples++;
+    m_waitTotal += wait;
+    if (wait > m_waitMax)
+        m_waitMax = wait;
+    m_runTotal += run;
+    if (run > m_runMax)
+        m_runMax = run;
+    m_statLock.unlock();
+}
+
+result_t WorkerPool::run(exlib::string fn, v8::Local<v8::Array> args, Variant& retVal, AsyncEvent* ac)
+{
+    if (ac->isSync()) {
+        if (m_core->m_closed.value())
+            return CHECK_ERROR(Runtime::setError("WorkerPool: pool is closed."));
+
+        obj_ptr<Task> task = new Task(fn, args);
+        result_t hr = task->m_args->unbind();
+        if (hr < 0)
+            return hr;
+
+        ac->m_ctx.resize(1);
+        ac->m_ctx[0] = task;
+
+        return CHECK_ERROR(CALL_E_NOSYNC);
+    }
+
+    Task* task = (Task*)ac->m_ctx[0].object();
+
+    if (ac->isPost()) {
+        v8::Local<v8::Value> v;
+
+        task->m_result->get_data(v);
+        retVal = v;
+
+        return 0;
+    }
+
+    if (m_core->m_closed.value())
+        return CHECK_ERROR(Runtime::setError("WorkerPool: pool is closed."));
+
+    task->m_ac = ac;
+    m_core->post(task);
+
+    return CALL_E_PENDDING;
+}
+
+result_t WorkerPool::cancel(int32_t& retVal)
+{
+    retVal = m_core->cancel();
+    return 0;
+}
+
+result_t WorkerPool::close()
+{
+    m_core->close();
+    return 0;
+}
+
+result_t WorkerPool::get_size(int32_t& retVal)
+{
+    retVal = (int32_t)m_core->m_slots.size();
+    return 0;
+}
+
+result_t WorkerPool::get_pending(int32_t& retVal)
+{
+    retVal = (int32_t)m_core->m_pending.value();
+    return 0;
+}
+
+result_t WorkerPool::get_stats(v8::Local<v8::Object>& retVal)
+{
+    Isolate* isolate = holder();
+    v8::Local<v8::Context> context = isolate->context();
+    v8::Local<v8::Object> o = v8::Object::New(isolate->m_isolate);
+    Core* core = m_core;
+    int32_t cnt = (int32_t)core->m_slots.size();
+    int32_t i;
+
+    o->Set(context, isolate->NewString("workers"), v8::Int32::New(isolate->m_isolate, cnt)).IsJust();
+    o->Set(context, isolate->NewString("pending"), v8::Number::New(isolate->m_isolate, (double)core->m_pending.value())).IsJust();
+    o->Set(context, isolate->NewString("running"), v8::Number::New(isolate->m_isolate, (double)core->m_running.value())).IsJust();
+    o->Set(context, isolate->NewString("completed"), v8::Number::New(isolate->m_isolate, (double)core->m_completed.value())).IsJust();
+    o->Set(context, isolate->NewString("failed"), v8::Number::New(isolate->m_isolate, (double)core->m_failed.value())).IsJust();
+    o->Set(context, isolate->NewString("cancelled"), v8::Number::New(isolate->m_isolate, (double)core->m_cancelled.value())).IsJust();
+    o->Set(context, isolate->NewString("stolen"), v8::Number::New(isolate->m_isolate, (double)core->m_stolen.value())).IsJust();
+
+    v8::Local<v8::Array> queues = v8::Array::New(isolate->m_isolate, cnt);
+    for (i = 0; i < cnt; i++)
+        queues->Set(context, i, v8::Int32::New(isolate->m_isolate, core->m_slots[i]->depth())).IsJust();
+    o->Set(context, isolate->NewString("queues"), queues).IsJust();
+
+    core->m_statLock.lock();
+    int64_t samples = core->m_samples;
+    double waitAvg = samples ? (double)core->m_waitTotal / samples / 1000000.0 : 0;
+    double waitMax = (double)core->m_waitMax / 1000000.0;
+    double runAvg = samples ? (double)core->m_runTotal / samples / 1000000.0 : 0;
+    double runMax = (double)core->m_runMax / 1000000.0;
+    core->m_statLock.unlock();
+
+    v8::Local<v8::Object> wait = v8::Object::New(isolate->m_isolate);
+    wait->Set(context, isolate->NewString("avg"), v8::Number::New(isolate->m_isolate, waitAvg)).IsJust();
+    wait->Set(context, isolate->NewString("max"), v8::Number::New(isolate->m_isolate, waitMax)).IsJust();
+    o->Set(context, isolate->NewString("wait"), wait).IsJust();
+
+    v8::Local<v8::Object> run = v8::Object::New(isolate->m_isolate);
+    run->Set(context, isolate->NewString("avg"), v8::Number::New(isolate->m_isolate, runAvg)).IsJust();
+    run->Set(context, isolate->NewString("max"), v8::Number::New(isolate->m_isolate, runMax)).IsJust();
+    o->Set(context, isolate->NewString("run"), run).IsJust();
+
+    retVal = o;
+    return 0;
+}
+}
@@ -453,13 +453,13 @@ result_t Cipher::setAutoPadding(bool autoPadding, obj_ptr<Cipher_base>& retVal)
     return 0;
 }
 
-result_t Cipher::get_result(Buffer* out, exlib::string outputEncoding, v8::Local<v8::Value>& retVal, bool final)
+result_t Cipher::get_result(Buffer* out, exlib::string outputEncoding, Variant& retVal, bool final)
 {
     if (outputEncoding == "buffer") {
         if (m_decoder)
             return CHECK_ERROR(Runtime::setError("Cipher: Inconsistent encoding"));
 
-        retVal = out->wrap(holder());
+        retVal = out;
         return 0;
     }
 
@@ -487,12 +487,12 @@ result_t Cipher::get_result(Buffer* out, exlib::string outputEncoding, v8::Local
     if (hr < 0)
         return hr;
 
-    retVal = holder()->NewString(str);
+    retVal = str;
 
     return 0;
 }
 
-result_t Cipher::update(const unsigned char* data, size_t len, exlib::string outputEncoding, v8::Local<v8::Value>& retVal)
+result_t Cipher::update(const unsigned char* data, size_t len, exlib::string outputEncoding, Variant& retVal)
 {
     const int mode = EVP_CIPHER_CTX_mode(m_ctx);
     if (mode == EVP_CIPH_CCM_MODE && !CheckCCMMessageLength(len))
@@ -520,23 +520,58 @@ result_t Cipher::update(const unsigned char* data, size_t len, exlib::string out
     return get_result(out, outputEncoding, retVal, false);
 }
 
-result_t Cipher::update(Buffer_base* data, exlib::string inputEncoding, exlib::string outputEncoding, v8::Local<v8::Value>& retVal)
+result_t Cipher::update(Buffer_base* data, exlib::string inputEncoding, exlib::string outputEncoding,
+    Variant& retVal, AsyncEvent* ac)
 {
     Buffer* buf = Buffer::Cast(data);
-    return update(buf->data(), buf->length(), outputEncoding, retVal);
+
+    if (ac->isSync()) {
+        if (m_busy.CompareAndSwap(0, 1) != 0)
+            return CHECK_ERROR(CALL_E_REENTRANT);
+
+        if (buf->length() >= CRYPTO_ASYNC_THRESHOLD)
+            return CHECK_ERROR(CALL_E_NOSYNC);
+    }
+
+    result_t hr = update(buf->data(), buf->length(), outputEncoding, retVal);
+    m_busy.xchg(0);
+
+    return hr;
 }
 
-result_t Cipher::update(exlib::string data, exlib::string inputEncoding, exlib::string outputEncoding, v8::Local<v8::Value>& retVal)
+result_t Cipher::update(exlib::string data, exlib::string inputEncoding, exlib::string outputEncoding,
+    Variant& retVal, AsyncEvent* ac)
 {
-    result_t hr = commonDecode(inputEncoding, data, data);
-    if (hr < 0)
-        return hr;
+    if (ac->isSync()) {
+        result_t hr = commonDecode(inputEncoding, data, data);
+        if (hr < 0)
+            return hr;
+
+        if (data.length() < CRYPTO_ASYNC_THRESHOLD) {
+            if (m_busy.CompareAndSwap(0, 1) != 0)
+                return CHECK_ERROR(CALL_E_REENTRANT);
+
+            hr = update((const unsigned char*)data.c_str(), data.length(), outputEncoding, retVal);
+            m_busy.xchg(0);
 
-    return update((const unsigned char*)data.c_str(), data.length(), outputEncoding, retVal);
+            return hr;
+        }
+
+        obj_ptr<Buffer_base> buf = new Buffer(data.c_str(), data.length());
+        ac->m_ctx.resize(1);
+        ac->m_ctx[0] = buf;
+
+        return update(buf, inputEncoding, outputEncoding, retVal, ac);
+    }
+
+    return update((Buffer_base*)ac->m_ctx[0].object(), inputEncoding, outputEncoding, retVal, ac);
 }
 
 result_t Cipher::final(exlib::string outputEncoding, v8::Local<v8::Value>& retVal)
 {
+    if (m_busy.value())
+        return CHECK_ERROR(CALL_E_REENTRANT);
+
     const int mode = EVP_CIPHER_CTX_mode(m_ctx);
 
     if (kind_ == kDecipher && IsSupportedAuthenticatedMode(m_ctx))
@@ -569,7 +604,13 @@ result_t Cipher::final(exlib::string outputEncoding, v8::Local<v8::Value>& retVa
 
     auth_tag_state_ = kAuthTagFinalized;
 
-    return get_result(out, outputEncoding, retVal, true);
+    Variant v;
+    result_t hr = get_result(out, outputEncoding, v, true);
+    if (hr < 0)
+        return hr;
+
+    retVal = v;
+    return 0;
 }
 
 }
@@ -36,35 +36,64 @@ Digest::Digest(const EVP_MD* md, const char* key, int32_t sz)
     EVP_DigestSignInit(m_ctx, NULL, md, NULL, pkey);
 }
 
-result_t Digest::update(Buffer_base* data, obj_ptr<Digest_base>& retVal)
+result_t Digest::update(const unsigned char* data, size_t len)
 {
-    Buffer* buf = Buffer::Cast(data);
-
     if (m_bMac)
-        EVP_DigestSignUpdate(m_ctx, buf->data(), buf->length());
+        EVP_DigestSignUpdate(m_ctx, data, len);
     else
-        EVP_DigestUpdate(m_ctx, buf->data(), buf->length());
-    retVal = this;
+        EVP_DigestUpdate(m_ctx, data, len);
 
     return 0;
 }
 
-result_t Digest::update(exlib::string data, exlib::string codec, obj_ptr<Digest_base>& retVal)
+result_t Digest::update(Buffer_base* data, obj_ptr<Digest_base>& retVal, AsyncEvent* ac)
 {
-    exlib::string _data;
-    result_t hr = commonDecode(codec, data, _data);
-    if (hr < 0)
-        return hr;
+    Buffer* buf = Buffer::Cast(data);
 
-    if (m_bMac)
-        EVP_DigestSignUpdate(m_ctx, (const unsigned char*)_data.c_str(), _data.length());
-    else
-        EVP_DigestUpdate(m_ctx, (const unsigned char*)_data.c_str(), _data.length());
+    if (ac->isSync()) {
+        if (m_busy.CompareAndSwap(0, 1) != 0)
+            return CHECK_ERROR(CALL_E_REENTRANT);
+
+        if (buf->length() >= CRYPTO_ASYNC_THRESHOLD)
+            return CHECK_ERROR(CALL_E_NOSYNC);
+    }
+
+    update(buf->data(), buf->length());
+    m_busy.xchg(0);
     retVal = this;
 
     return 0;
 }
 
+result_t Digest::update(exlib::string data, exlib::string codec, obj_ptr<Digest_base>& retVal, AsyncEvent* ac)
+{
+    if (ac->isSync()) {
+        exlib::string _data;
+        result_t hr = commonDecode(codec, data, _data);
+        if (hr < 0)
+            return hr;
+
+        if (_data.length() < CRYPTO_ASYNC_THRESHOLD) {
+            if (m_busy.CompareAndSwap(0, 1) != 0)
+                return CHECK_ERROR(CALL_E_REENTRANT);
+
+            update((const unsigned char*)_data.c_str(), _data.length());
+            m_busy.xchg(0);
+            retVal = this;
+
+            return 0;
+        }
+
+        obj_ptr<Buffer_base> buf = new Buffer(_data.c_str(), _data.length());
+        ac->m_ctx.resize(1);
+        ac->m_ctx[0] = buf;
+
+        return update(buf, retVal, ac);
+    }
+
+    return update((Buffer_base*)ac->m_ctx[0].object(), retVal, ac);
+}
+
 result_t Digest::digest(obj_ptr<Buffer>& retVal)
 {
     obj_ptr<Buffer> buf = new Buffer(NULL, EVP_MD_size(EVP_MD_CTX_md(m_ctx)));
@@ -85,6 +114,9 @@ result_t Digest::digest(obj_ptr<Buffer>& retVal)
 
 result_t Digest::digest(exlib::string codec, v8::Local<v8::Value>& retVal)
 {
+    if (m_busy.value())
+        return CHECK_ERROR(CALL_E_REENTRANT);
+
     obj_ptr<Buffer> buf;
     result_t hr = digest(buf);
     if (hr < 0)
@@ -98,13 +98,16 @@ result_t crypto_base::createHmac(exlib::string algo, Buffer_base* key,
 }
 
 result_t crypto_base::hash(exlib::string algorithm, Buffer_base* data,
-    exlib::string outputEncoding, v8::Local<v8::Value>& retVal)
+    exlib::string outputEncoding, Variant& retVal, AsyncEvent* ac)
 {
     const EVP_MD* md = _evp_md_type(algorithm.c_str());
     if (!md)
         return CHECK_ERROR(CALL_E_INVALIDARG);
 
     Buffer* buf = Buffer::Cast(data);
+    if (ac->isSync() && buf->length() >= CRYPTO_ASYNC_THRESHOLD)
+        return CHECK_ERROR(CALL_E_NOSYNC);
+
     obj_ptr<Buffer> ret = new Buffer(NULL, EVP_MD_size(md));
 
     EVP_Digest((const unsigned char*)buf->data(), buf->length(), (unsigned char*)ret->data(), NULL, md, NULL);
@@ -112,6 +115,131 @@ result_t crypto_base::hash(exlib::string algorithm, Buffer_base* data,
     return ret->toValue(outputEncoding, retVal);
 }
 
+#define MAX_BATCH_TASKS 8
+
+class HashBatch : public CryptoBatch {
+public:
+    HashBatch(const EVP_MD* md, exlib::string codec, std::vector<Variant>& datas,
+        obj_ptr<NArray>& retVal, AsyncEvent* ac)
+        : CryptoBatch(ac)
+        , m_md(md)
+        , m_codec(codec)
+        , m_retVal(retVal)
+    {
+        size_t i;
+
+        m_datas.resize(datas.size());
+        for (i = 0; i < datas.size(); i++)
+            m_datas[i] = Buffer::Cast((Buffer_base*)datas[i].object());
+
+        m_results.resize(m_datas.size());
+    }
+
+public:
+    virtual void process(size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++) {
+            Buffer* buf = m_datas[i];
+            obj_ptr<Buffer> ret = new Buffer(NULL, EVP_MD_size(m_md));
+
+            EVP_Digest((const unsigned char*)buf->data(), buf->length(), (unsigned char*)ret->data(), NULL, m_md, NULL);
+            m_results[i] = ret;
+        }
+    }
+
+    virtual result_t result()
+    {
+        obj_ptr<NArray> ret = new NArray();
+
+        for (size_t i = 0; i < m_results.size(); i++) {
+            Variant v;
+            result_t hr = m_results[i]->toValue(m_codec, v);
+            if (hr < 0)
+                return hr;
+
+            ret->append(v);
+        }
+
+        m_retVal = ret;
+        return 0;
+    }
+
+    result_t run()
+    {
+        size_t total = 0;
+        size_t i;
+
+        for (i = 0; i < m_datas.size(); i++)
+            total += m_datas[i]->length();
+
+        size_t tasks = total / CRYPTO_ASYNC_THRESHOLD;
+        if (tasks > MAX_BATCH_TASKS)
+            tasks = MAX_BATCH_TASKS;
+        if (tasks < 1)
+            tasks = 1;
+
+        // split the batch into ranges of roughly equal byte counts
+        std::vector<size_t> bounds;
+        size_t part = total / tasks;
+        size_t sum = 0;
+
+        bounds.push_back(0);
+        for (i = 0; i < m_datas.size() && bounds.size() < tasks; i++) {
+            sum += m_datas[i]->length();
+            if (sum >= part * bounds.size())
+                bounds.push_back(i + 1);
+        }
+        if (bounds.back() < m_datas.size())
+            bounds.push_back(m_datas.size());
+
+        return CryptoBatch::run(bounds);
+    }
+
+private:
+    const EVP_MD* m_md;
+    exlib::string m_codec;
+    std::vector<obj_ptr<Buffer>> m_datas;
+    std::vector<obj_ptr<Buffer>> m_results;
+    obj_ptr<NArray>& m_retVal;
+};
+
+result_t crypto_base::hashBatch(exlib::string algorithm, v8::Local<v8::Array> datas,
+    exlib::string outputEncoding, obj_ptr<NArray>& retVal, AsyncEvent* ac)
+{
+    const EVP_MD* md = _evp_md_type(algorithm.c_str());
+    if (!md)
+        return CHECK_ERROR(CALL_E_INVALIDARG);
+
+    if (ac->isSync()) {
+        Isolate* isolate = ac->isolate();
+        v8::Local<v8::Context> context = isolate->context();
+        int32_t len = datas->Length();
+        size_t total = 0;
+        int32_t i;
+
+        ac->m_ctx.resize(len);
+        for (i = 0; i < len; i++) {
+            obj_ptr<Buffer_base> buf;
+            result_t hr = GetArgumentValue(isolate, JSValue(datas->Get(context, i)), buf);
+            if (hr < 0)
+                return CHECK_ERROR(hr);
+
+            ac->m_ctx[i] = buf;
+            total += Buffer::Cast(buf)->length();
+        }
+
+        if (total >= CRYPTO_ASYNC_THRESHOLD)
+            return CHECK_ERROR(CALL_E_NOSYNC);
+
+        obj_ptr<HashBatch> batch = new HashBatch(md, outputEncoding, ac->m_ctx, retVal, ac);
+        batch->process(0, len);
+        return batch->result();
+    }
+
+    obj_ptr<HashBatch> batch = new HashBatch(md, outputEncoding, ac->m_ctx, retVal, ac);
+    return batch->run();
+}
+
 result_t crypto_base::hkdf(exlib::string algoName, Buffer_base* password, Buffer_base* salt, Buffer_base* info,
     int32_t size, obj_ptr<Buffer_base>& retVal, AsyncEvent* ac)
 {
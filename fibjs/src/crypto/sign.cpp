@@ -11,6 +11,7 @@
 #include "ifs/crypto.h"
 #include "Buffer.h"
 #include "KeyObject.h"
+#include <unordered_map>
 
 namespace fibjs {
 
@@ -547,6 +548,46 @@ result_t crypto_base::sign(v8::Local<v8::Value> algorithm, Buffer_base* data, v8
     return _sign(algo, data, key_, enc, padding, salt_len, retVal);
 }
 
+#define MAX_CACHED_KEYS 4096
+
+// parsed public keys shared by all workers, keyed by the raw key bytes, so that
+// services verifying many signatures against a few keys decode each key once
+class PublicKeyCache {
+public:
+    result_t get(Buffer_base* key, obj_ptr<KeyObject_base>& retVal)
+    {
+        Buffer* buf = Buffer::Cast(key);
+        exlib::string k((const char*)buf->data(), buf->length());
+
+        m_lock.lock();
+        auto it = m_keys.find(k);
+        if (it != m_keys.end()) {
+            retVal = it->second;
+            m_lock.unlock();
+            return 0;
+        }
+        m_lock.unlock();
+
+        result_t hr = crypto_base::createPublicKey(key, retVal);
+        if (hr < 0)
+            return hr;
+
+        m_lock.lock();
+        if (m_keys.size() >= MAX_CACHED_KEYS)
+            m_keys.erase(m_keys.begin());
+        m_keys.emplace(k, retVal);
+        m_lock.unlock();
+
+        return 0;
+    }
+
+private:
+    exlib::spinlock m_lock;
+    std::unordered_map<exlib::string, obj_ptr<KeyObject_base>> m_keys;
+};
+
+static PublicKeyCache* s_keyCache = new PublicKeyCache();
+
 result_t _verify(exlib::string algorithm, Buffer_base* data, KeyObject_base* publicKey, Buffer_base* signature,
     DSASigEnc enc, int padding, int salt_len, bool& retVal)
 {
@@ -599,7 +640,7 @@ result_t crypto_base::verify(v8::Local<v8::Value> algorithm, Buffer_base* data,
 
     exlib::string algo = ac->m_ctx[0].string();
     obj_ptr<KeyObject_base> key_;
-    result_t hr = crypto_base::createPublicKey(publicKey, key_);
+    result_t hr = s_keyCache->get(publicKey, key_);
     if (hr != 0)
         return hr;
 
@@ -663,4 +704,199 @@ result_t crypto_base::verify(v8::Local<v8::Value> algorithm, Buffer_base* data,
     return _verify(algo, data, key_, signature, enc, padding, salt_len, retVal);
 }
 
+#define VERIFY_BATCH_CHUNK 32
+#define MAX_VERIFY_TASKS 16
+
+class VerifyBatch : public CryptoBatch {
+public:
+    enum {
+        kData = 0,
+        kSignature,
+        kKey,
+        kKeyIsObject,
+        kEncoding,
+        kPadding,
+        kSaltLength,
+        kStride
+    };
+
+public:
+    VerifyBatch(std::vector<Variant>& ctx, obj_ptr<NArray>& retVal, AsyncEvent* ac)
+        : CryptoBatch(ac)
+        , m_ctx(ctx)
+        , m_retVal(retVal)
+    {
+        m_algo = m_ctx[0].string();
+        m_results.resize((m_ctx.size() - 1) / kStride);
+    }
+
+public:
+    virtual void process(size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++) {
+            Variant* item = m_ctx.data() + 1 + i * kStride;
+            obj_ptr<KeyObject_base> key;
+            bool ok = false;
+            result_t hr;
+
+            if (item[kKeyIsObject].boolVal())
+                key = (KeyObject_base*)item[kKey].object();
+            else {
+                hr = s_keyCache->get((Buffer_base*)item[kKey].object(), key);
+                if (hr < 0) {
+                    m_results[i] = false;
+                    continue;
+                }
+            }
+
+            hr = _verify(m_algo, (Buffer_base*)item[kData].object(), key,
+                (Buffer_base*)item[kSignature].object(), (DSASigEnc)item[kEncoding].intVal(),
+                item[kPadding].intVal(), item[kSaltLength].intVal(), ok);
+            m_results[i] = hr >= 0 && ok;
+        }
+
+        ERR_clear_error();
+    }
+
+    virtual result_t result()
+    {
+        obj_ptr<NArray> ret = new NArray();
+
+        for (size_t i = 0; i < m_results.size(); i++)
+            ret->append(m_results[i] != 0);
+
+        m_retVal = ret;
+        return 0;
+    }
+
+    result_t run()
+    {
+        size_t count = m_results.size();
+        size_t tasks = (count + VERIFY_BATCH_CHUNK - 1) / VERIFY_BATCH_CHUNK;
+        if (tasks > MAX_VERIFY_TASKS)
+            tasks = MAX_VERIFY_TASKS;
+
+        std::vector<size_t> bounds;
+        for (size_t i = 0; i < tasks; i++)
+            bounds.push_back(count * i / tasks);
+        bounds.push_back(count);
+
+        return CryptoBatch::run(bounds);
+    }
+
+private:
+    std::vector<Variant>& m_ctx;
+    obj_ptr<NArray>& m_retVal;
+    exlib::string m_algo;
+    std::vector<uint8_t> m_results;
+};
+
+result_t crypto_base::verifyBatch(v8::Local<v8::Value> algorithm, v8::Local<v8::Array> items,
+    obj_ptr<NArray>& retVal, AsyncEvent* ac)
+{
+    if (ac->isSync()) {
+        Isolate* isolate = ac->isolate();
+        v8::Local<v8::Context> context = isolate->context();
+        int32_t len = items->Length();
+        int32_t i;
+
+        exlib::string algo;
+        result_t hr = get_algorithm(isolate, algorithm, algo);
+        if (hr < 0)
+            return hr;
+
+        ac->m_ctx.resize(1 + len * VerifyBatch::kStride);
+        ac->m_ctx[0] = algo;
+
+        // keys passed as option objects are decoded here once per object
+        std::unordered_map<int, std::vector<std::pair<v8::Local<v8::Object>, int32_t>>> seen;
+
+        for (i = 0; i < len; i++) {
+            Variant* item = ac->m_ctx.data() + 1 + i * VerifyBatch::kStride;
+            v8::Local<v8::Object> o;
+
+            hr = GetArgumentValue(isolate, JSValue(items->Get(context, i)), o, true);
+            if (hr < 0)
+                return CHECK_ERROR(hr);
+
+            obj_ptr<Buffer_base> buf;
+            hr = GetConfigValue(isolate, o, "data", buf);
+            if (hr < 0)
+                return CHECK_ERROR(hr);
+            item[VerifyBatch::kData] = buf;
+
+            hr = GetConfigValue(isolate, o, "signature", buf);
+            if (hr < 0)
+                return CHECK_ERROR(hr);
+            item[VerifyBatch::kSignature] = buf;
+
+            item[VerifyBatch::kEncoding] = (int)kSigEncDER;
+            item[VerifyBatch::kPadding] = DEFAULT_PADDING;
+            item[VerifyBatch::kSaltLength] = NO_SALTLEN;
+
+            v8::Local<v8::Value> v;
+            hr = GetConfigValue(isolate, o, "key", v, true);
+            if (hr < 0)
+                return CHECK_ERROR(hr);
+
+            obj_ptr<KeyObject_base> key = KeyObject_base::getInstance(v);
+            if (key) {
+                item[VerifyBatch::kKey] = key;
+                item[VerifyBatch::kKeyIsObject] = true;
+                continue;
+            }
+
+            if (v->IsObject() && !Buffer_base::getInstance(v)) {
+                v8::Local<v8::Object> ko = v8::Local<v8::Object>::Cast(v);
+                std::vector<std::pair<v8::Local<v8::Object>, int32_t>>& list = seen[ko->GetIdentityHash()];
+                size_t j;
+
+                for (j = 0; j < list.size(); j++)
+                    if (list[j].first == ko)
+                        break;
+
+                if (j < list.size()) {
+                    Variant* prev = ac->m_ctx.data() + 1 + list[j].second * VerifyBatch::kStride;
+                    item[VerifyBatch::kKey] = prev[VerifyBatch::kKey];
+                    item[VerifyBatch::kEncoding] = prev[VerifyBatch::kEncoding];
+                    item[VerifyBatch::kPadding] = prev[VerifyBatch::kPadding];
+                    item[VerifyBatch::kSaltLength] = prev[VerifyBatch::kSaltLength];
+                } else {
+                    hr = crypto_base::createPublicKey(ko, key);
+                    if (hr < 0)
+                        return hr;
+
+                    DSASigEnc enc = kSigEncDER;
+                    int padding = DEFAULT_PADDING;
+                    int salt_len = NO_SALTLEN;
+                    hr = get_sig_opt(isolate, ko, enc, padding, salt_len);
+                    if (hr < 0)
+                        return hr;
+
+                    item[VerifyBatch::kKey] = key;
+                    item[VerifyBatch::kEncoding] = (int)enc;
+                    item[VerifyBatch::kPadding] = padding;
+                    item[VerifyBatch::kSaltLength] = salt_len;
+
+                    list.push_back(std::make_pair(ko, i));
+                }
+
+                item[VerifyBatch::kKeyIsObject] = true;
+                continue;
+            }
+
+            hr = GetArgumentValue(isolate, v, buf);
+            if (hr < 0)
+                return CHECK_ERROR(hr);
+            item[VerifyBatch::kKey] = buf;
+            item[VerifyBatch::kKeyIsObject] = false;
+        }
+
+        return CHECK_ERROR(CALL_E_NOSYNC);
+    }
+
+    obj_ptr<VerifyBatch> batch = new VerifyBatch(ac->m_ctx, retVal, ac);
+    return batch->run();
+}
+
 }
@@ -10,6 +10,7 @@
 #include "object.h"
 #include "ifs/db.h"
 #include "db_format.h"
+#include "Metrics.h"
 
 namespace fibjs {
 
@@ -157,7 +158,7 @@ public:
         }
 
         exlib::string str = ac->m_ctx[0].string();
-        return execute(str, retVal, ac);
+        return timed_execute(str, retVal, ac);
     }
 
     typedef result_t (*formater)(v8::Local<v8::Object> opts, exlib::string& retVal);
@@ -181,7 +182,30 @@ public:
         }
 
         exlib::string str = ac->m_ctx[0].string();
-        return execute(str, retVal, ac);
+        return timed_execute(str, retVal, ac);
+    }
+
+    result_t timed_execute(exlib::string& sql, obj_ptr<NArray>& retVal, AsyncEvent* ac)
+    {
+        // a running query can not be interrupted, but one queued past the
+        // deadline of its caller is not started at all
+        int32_t timeout = 0;
+        result_t hr = ac->clip_timeout(timeout);
+        if (hr < 0) {
+            metrics_db_errors()->inc();
+            return hr;
+        }
+
+        int64_t start = Metric::now();
+        hr = execute(sql, retVal, ac);
+
+        if (hr != CALL_E_PENDDING) {
+            metrics_db_query()->observe(Metric::now() - start);
+            if (hr < 0)
+                metrics_db_errors()->inc();
+        }
+
+        return hr;
     }
 
     result_t createTable(v8::Local<v8::Object> opts, AsyncEvent* ac)
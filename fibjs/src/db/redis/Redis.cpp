@@ -92,6 +92,14 @@ result_t Redis::_command(exlib::string& req, Variant& retVal, AsyncEvent* ac)
 
         ON_STATE(asyncCommand, send)
         {
+            // replies come back in order on a connection shared by every
+            // fiber, so a command is never cut off once it is sent; it only
+            // fails fast when the deadline has already passed
+            int32_t timeout = 0;
+            result_t hr = clip_timeout(timeout);
+            if (hr < 0)
+                return hr;
+
             m_buffer = new Buffer(m_req.c_str(), m_req.length());
             return m_stmBuffered->write(m_buffer, next(read));
         }
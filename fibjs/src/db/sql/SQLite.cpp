@@ -9,6 +9,7 @@
 #include "SQLite.h"
 #include "ifs/db.h"
 #include "DBResult.h"
+#include "DBColumns.h"
 #include "Buffer.h"
 #include "ifs/coroutine.h"
 
@@ -269,6 +270,188 @@ result_t SQLite::execute(exlib::string sql, obj_ptr<NArray>& retVal, AsyncEvent*
     return 0;
 }
 
+// column type from the declared type, following the sqlite affinity rules.
+// columns without a declared type, or with numeric affinity, take the type
+// of their first value.
+static int32_t columnar_type(const char* type)
+{
+    if (!type)
+        return DBColumns::C_NULL;
+
+    if (!qstricmp(type, "blob", 4) || !qstricmp(type, "tinyblob", 8)
+        || !qstricmp(type, "mediumblob", 10) || !qstricmp(type, "longblob", 8)
+        || !qstricmp(type, "binary", 6) || !qstricmp(type, "varbinary", 9))
+        return DBColumns::C_BLOB;
+
+    if (!qstricmp(type, "datetime") || !qstricmp(type, "timestamp")
+        || !qstricmp(type, "date") || !qstricmp(type, "time"))
+        return DBColumns::C_DATE;
+
+    if (qstristr(type, "int"))
+        return DBColumns::C_INTEGER;
+
+    if (qstristr(type, "char") || qstristr(type, "clob") || qstristr(type, "text"))
+        return DBColumns::C_TEXT;
+
+    if (qstristr(type, "real") || qstristr(type, "floa") || qstristr(type, "doub"))
+        return DBColumns::C_FLOAT;
+
+    return DBColumns::C_NULL;
+}
+
+result_t SQLite::executeColumnar(exlib::string sql, OptArgs args, obj_ptr<NObject>& retVal, AsyncEvent* ac)
+{
+    if (!m_conn)
+        return CHECK_ERROR(CALL_E_INVALID_CALL);
+
+    if (ac->isSync()) {
+        exlib::string str;
+        result_t hr = format(sql, args, str);
+        if (hr < 0)
+            return hr;
+
+        ac->m_ctx.resize(1);
+        ac->m_ctx[0] = str;
+
+        return CHECK_ERROR(CALL_E_LONGSYNC);
+    }
+
+    int32_t timeout = 0;
+    result_t hr = ac->clip_timeout(timeout);
+    if (hr < 0) {
+        metrics_db_errors()->inc();
+        return hr;
+    }
+
+    exlib::string str = ac->m_ctx[0].string();
+    obj_ptr<DBColumns> res;
+    int64_t start = Metric::now();
+
+    hr = execute_columnar(str, res);
+
+    metrics_db_query()->observe(Metric::now() - start);
+    if (hr < 0) {
+        metrics_db_errors()->inc();
+        return hr;
+    }
+
+    retVal = res;
+    return 0;
+}
+
+result_t SQLite::execute_columnar(exlib::string& sql, obj_ptr<DBColumns>& retVal)
+{
+    sqlite3_stmt* stmt = 0;
+    const char* pStr1;
+    result_t hr = 0;
+
+    if (sqlite3_prepare_sleep((sqlite3*)m_conn, sql.c_str(), (int32_t)sql.length(), &stmt, &pStr1, m_nCmdTimeout)) {
+        hr = CHECK_ERROR(Runtime::setError(sqlite3_errmsg((sqlite3*)m_conn)));
+        if (stmt)
+            sqlite3_finalize(stmt);
+        return hr;
+    }
+
+    if (!stmt)
+        return CHECK_ERROR(Runtime::setError("SQLite: Query was empty"));
+
+    while (qisspace(*pStr1) || *pStr1 == ';')
+        pStr1++;
+
+    if (*pStr1) {
+        sqlite3_finalize(stmt);
+        return CHECK_ERROR(Runtime::setError("SQLite: executeColumnar accepts only one statement"));
+    }
+
+    int32_t columns = sqlite3_column_count(stmt);
+    obj_ptr<DBColumns> res;
+
+    if (columns > 0) {
+        int32_t i;
+        res = new DBColumns(columns);
+
+        for (i = 0; i < columns; i++)
+            res->setField(i, sqlite3_column_name(stmt, i), columnar_type(sqlite3_column_decltype(stmt, i)));
+
+        while (hr >= 0) {
+            int32_t r = sqlite3_step_sleep(stmt, m_nCmdTimeout);
+            if (r == SQLITE_DONE)
+                break;
+
+            if (r != SQLITE_ROW) {
+                hr = CHECK_ERROR(Runtime::setError(sqlite3_errmsg((sqlite3*)m_conn)));
+                break;
+            }
+
+            res->beginRow();
+            for (i = 0; i < columns && hr >= 0; i++) {
+                int32_t t = sqlite3_column_type(stmt, i);
+
+                if (t == SQLITE_NULL) {
+                    res->setNull(i);
+                    continue;
+                }
+
+                if (res->type(i) == DBColumns::C_NULL)
+                    res->setType(i, t == SQLITE_INTEGER ? DBColumns::C_INTEGER
+                            : t == SQLITE_FLOAT         ? DBColumns::C_FLOAT
+                            : t == SQLITE_BLOB          ? DBColumns::C_BLOB
+                                                        : DBColumns::C_TEXT);
+                else if (res->type(i) == DBColumns::C_INTEGER && t == SQLITE_FLOAT)
+                    res->toFloat(i);
+                else if ((res->type(i) == DBColumns::C_INTEGER || res->type(i) == DBColumns::C_FLOAT)
+                    && (t == SQLITE_TEXT || t == SQLITE_BLOB))
+                    res->toBytes(i, t == SQLITE_BLOB ? DBColumns::C_BLOB : DBColumns::C_TEXT);
+
+                switch (res->type(i)) {
+                case DBColumns::C_INTEGER:
+                    res->setInteger(i, sqlite3_column_int64(stmt, i));
+                    break;
+                case DBColumns::C_FLOAT:
+                    res->setDouble(i, sqlite3_column_double(stmt, i));
+                    break;
+                case DBColumns::C_DATE:
+                    if (t == SQLITE_INTEGER || t == SQLITE_FLOAT)
+                        res->setDouble(i, sqlite3_column_double(stmt, i));
+                    else {
+                        date_t d;
+                        d.parse((const char*)sqlite3_column_text(stmt, i), sqlite3_column_bytes(stmt, i));
+                        res->setDouble(i, d.date());
+                    }
+                    break;
+                case DBColumns::C_TEXT: {
+                    const char* data = (const char*)sqlite3_column_text(stmt, i);
+                    hr = res->setBytes(i, data, sqlite3_column_bytes(stmt, i));
+                    break;
+                }
+                case DBColumns::C_BLOB: {
+                    const char* data = (const char*)sqlite3_column_blob(stmt, i);
+                    hr = res->setBytes(i, data, sqlite3_column_bytes(stmt, i));
+                    break;
+                }
+                }
+            }
+            res->endRow();
+        }
+
+        res->finish();
+    } else {
+        int32_t r = sqlite3_step_sleep(stmt, m_nCmdTimeout);
+        if (r == SQLITE_DONE)
+            res = new DBColumns(0, sqlite3_changes((sqlite3*)m_conn),
+                sqlite3_last_insert_rowid((sqlite3*)m_conn));
+        else
+            hr = CHECK_ERROR(Runtime::setError(sqlite3_errmsg((sqlite3*)m_conn)));
+    }
+
+    sqlite3_finalize(stmt);
+    if (hr < 0)
+        return hr;
+
+    retVal = res;
+    return 0;
+}
+
 result_t SQLite::get_fileName(exlib::string& retVal)
 {
     if (!m_conn)
@@ -10,6 +10,7 @@
 #include "ifs/SQLite.h"
 #include <sqlite/sqlite3.h>
 #include "../db_tmpl.h"
+#include "DBColumns.h"
 
 namespace fibjs {
 
@@ -34,11 +35,15 @@ public:
     virtual result_t get_timeout(int32_t& retVal);
     virtual result_t set_timeout(int32_t newVal);
     virtual result_t backup(exlib::string fileName, AsyncEvent* ac);
+    virtual result_t executeColumnar(exlib::string sql, OptArgs args, obj_ptr<NObject>& retVal, AsyncEvent* ac);
 
 public:
     result_t open(const char* file);
     int vec_init();
 
+private:
+    result_t execute_columnar(exlib::string& sql, obj_ptr<DBColumns>& retVal);
+
 private:
     exlib::string m_file;
     int32_t m_nCmdTimeout;
@@ -0,0 +1,84 @@
+/*
+ * RecordSchema.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "RecordSchema.h"
+
+namespace fibjs {
+
+#define MAX_SCHEMA_DEPTH 32
+
+result_t RecordSchema::create(v8::Local<v8::Object> schema, obj_ptr<RecordSchema>& retVal)
+{
+    Isolate* isolate = Isolate::current();
+    obj_ptr<RecordSchema> rs = new RecordSchema();
+    int32_t id = 0;
+
+    if (!is_record(schema))
+        return CHECK_ERROR(Runtime::setError("schema must be a plain object."));
+
+    result_t hr = rs->parse(isolate, schema, id, 0);
+    if (hr < 0)
+        return hr;
+
+    rs->m_count = id;
+    retVal = rs;
+
+    return 0;
+}
+
+result_t RecordSchema::parse(Isolate* isolate, v8::Local<v8::Object> o, int32_t& id, int32_t depth)
+{
+    v8::Local<v8::Context> context = isolate->context();
+    result_t hr;
+
+    if (depth >= MAX_SCHEMA_DEPTH)
+        return CHECK_ERROR(Runtime::setError("schema is nested too deeply."));
+
+    JSArray ks = o->GetPropertyNames(context);
+    int32_t len = ks->Length();
+
+    for (int32_t i = 0; i < len; i++) {
+        JSValue k = ks->Get(context, i);
+        JSValue v = o->Get(context, k);
+        field f;
+
+        hr = GetArgumentValue(isolate, k, f.m_name);
+        if (hr < 0)
+            return hr;
+
+        json_quote(f.m_json, f.m_name.c_str(), f.m_name.length());
+        f.m_json.append(1, ':');
+        f.m_id = id++;
+        f.m_array = false;
+
+        if (v->IsArray()) {
+            v8::Local<v8::Array> a = v8::Local<v8::Array>::Cast(v);
+            if (a->Length() == 1) {
+                JSValue e = a->Get(context, 0);
+                if (is_record(e)) {
+                    v = e;
+                    f.m_array = true;
+                }
+            }
+        }
+
+        if (is_record(v)) {
+            f.m_record = new RecordSchema();
+            hr = f.m_record->parse(isolate, v8::Local<v8::Object>::Cast(v), id, depth + 1);
+            if (hr < 0)
+                return hr;
+        } else
+            f.m_array = false;
+
+        m_fields.push_back(f);
+    }
+
+    return 0;
+}
+
+} /* namespace fibjs */
@@ -10,6 +10,7 @@
 #include "encoding_iconv.h"
 #include "Url.h"
 #include "libbase58.h"
+#include "simd.h"
 #include <math.h>
 
 namespace fibjs {
@@ -24,12 +25,43 @@ DECLARE_MODULE(multibase);
 static void hexEncode(const char* data, size_t sz, bool upper, exlib::string& retVal)
 {
     const char* HexChar = upper ? "0123456789ABCDEF" : "0123456789abcdef";
-    size_t i;
+    size_t i = 0;
 
     retVal.resize(sz * 2);
     char* _retVal = retVal.data();
 
-    for (i = 0; i < sz; i++) {
+#if defined(FIBJS_SIMD_SSE2)
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i alpha = _mm_set1_epi8(upper ? 'A' - '0' - 10 : 'a' - '0' - 10);
+
+    for (; i + 16 <= sz; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+        __m128i lo = _mm_and_si128(v, mask);
+
+        hi = _mm_add_epi8(_mm_add_epi8(hi, zero), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), alpha));
+        lo = _mm_add_epi8(_mm_add_epi8(lo, zero), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), alpha));
+
+        _mm_storeu_si128((__m128i*)(_retVal + i * 2), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*)(_retVal + i * 2 + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+#elif defined(FIBJS_SIMD_NEON)
+    const uint8x16_t table = vld1q_u8((const uint8_t*)HexChar);
+    const uint8x16_t mask = vdupq_n_u8(0x0f);
+
+    for (; i + 16 <= sz; i += 16) {
+        uint8x16_t v = vld1q_u8((const uint8_t*)data + i);
+        uint8x16x2_t out;
+
+        out.val[0] = vqtbl1q_u8(table, vshrq_n_u8(v, 4));
+        out.val[1] = vqtbl1q_u8(table, vandq_u8(v, mask));
+        vst2q_u8((uint8_t*)_retVal + i * 2, out);
+    }
+#endif
+
+    for (; i < sz; i++) {
         unsigned char ch = (unsigned char)data[i];
 
         _retVal[i * 2] = HexChar[ch >> 4];
@@ -97,10 +129,42 @@ result_t hex_base::decode(exlib::string data, obj_ptr<Buffer_base>& retVal)
     return 0;
 }
 
+#if defined(FIBJS_SIMD_SSSE3_DISPATCH)
+// encode 12 bytes into 16 base64 chars per round, see Wojciech Mula's base64 sse notes.
+FIBJS_TARGET_SSSE3 static size_t base64Encode_ssse3(const char* pEncodingTable,
+    const char* data, size_t sz, char* out)
+{
+    const __m128i shuf = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i shift = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, pEncodingTable[62] - 62,
+        pEncodingTable[63] - 63, 'A', 0, 0);
+    size_t i = 0;
+
+    for (; i + 16 <= sz; i += 12, out += 16) {
+        __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i)), shuf);
+
+        __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)),
+            _mm_set1_epi32(0x04000040));
+        __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)),
+            _mm_set1_epi32(0x01000010));
+        __m128i idx = _mm_or_si128(t0, t1);
+
+        __m128i r = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+        __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), idx);
+        r = _mm_or_si128(r, _mm_and_si128(less, _mm_set1_epi8(13)));
+        r = _mm_add_epi8(_mm_shuffle_epi8(shift, r), idx);
+
+        _mm_storeu_si128((__m128i*)out, r);
+    }
+
+    return i;
+}
+#endif
+
 static void baseEncode(const char* pEncodingTable, size_t dwBits,
     const char* data, size_t sz, exlib::string& retVal, bool fill)
 {
-    size_t i, len = 0, bits = 0;
+    size_t i = 0, len = 0, bits = 0;
     size_t dwData = 0;
     size_t dwSize = 0;
     char bMask = 0xff >> (8 - dwBits);
@@ -113,7 +177,39 @@ static void baseEncode(const char* pEncodingTable, size_t dwBits,
     retVal.resize(dwSize);
     char* _retVal = retVal.data();
 
-    for (i = 0; i < sz; i++) {
+    if (dwBits == 6) {
+#if defined(FIBJS_SIMD_SSSE3_DISPATCH)
+        if (cpu_has_ssse3()) {
+            i = base64Encode_ssse3(pEncodingTable, data, sz, _retVal);
+            len = i / 3 * 4;
+        }
+#endif
+
+        for (; i + 3 <= sz; i += 3) {
+            uint32_t v = ((unsigned char)data[i] << 16) | ((unsigned char)data[i + 1] << 8)
+                | (unsigned char)data[i + 2];
+
+            _retVal[len] = pEncodingTable[v >> 18];
+            _retVal[len + 1] = pEncodingTable[(v >> 12) & 0x3f];
+            _retVal[len + 2] = pEncodingTable[(v >> 6) & 0x3f];
+            _retVal[len + 3] = pEncodingTable[v & 0x3f];
+            len += 4;
+        }
+    } else if (dwBits == 5) {
+        for (; i + 5 <= sz; i += 5) {
+            uint64_t v = ((uint64_t)(unsigned char)data[i] << 32) | ((uint64_t)(unsigned char)data[i + 1] << 24)
+                | ((uint64_t)(unsigned char)data[i + 2] << 16) | ((uint64_t)(unsigned char)data[i + 3] << 8)
+                | (uint64_t)(unsigned char)data[i + 4];
+
+            for (int32_t j = 7; j >= 0; j--) {
+                _retVal[len + j] = pEncodingTable[v & 0x1f];
+                v >>= 5;
+            }
+            len += 8;
+        }
+    }
+
+    for (; i < sz; i++) {
         dwData <<= 8;
         dwData |= (unsigned char)data[i];
         bits += 8;
@@ -147,7 +243,44 @@ static void baseDecode(const char* pdecodeTable, size_t dwBits,
     size_t nBits = 0;
     unsigned char ch;
 
-    while ((_baseString < end) && (ch = (unsigned char)*_baseString++)) {
+    // a full group of valid chars maps to whole bytes: 4 chars -> 3 bytes for base64,
+    // 8 chars -> 5 bytes for base32. anything else falls back to the bit loop below.
+    const size_t nGroup = dwBits == 6 ? 4 : 8;
+    const size_t nBytes = nGroup * dwBits / 8;
+
+    while (_baseString < end) {
+        if (nBits == 0) {
+            while (_baseString + nGroup <= end) {
+                uint64_t v = 0;
+                size_t i;
+
+                for (i = 0; i < nGroup; i++) {
+                    ch = (unsigned char)_baseString[i];
+                    int32_t nCh = (ch > 0x20 && ch < 0x80) ? pdecodeTable[ch - 0x20] : -1;
+                    if (nCh == -1)
+                        break;
+                    v = (v << dwBits) | nCh;
+                }
+
+                if (i < nGroup)
+                    break;
+
+                for (i = nBytes; i > 0; i--) {
+                    _retVal[nWritten + i - 1] = (char)v;
+                    v >>= 8;
+                }
+
+                nWritten += nBytes;
+                _baseString += nGroup;
+            }
+
+            if (_baseString >= end)
+                break;
+        }
+
+        if (!(ch = (unsigned char)*_baseString++))
+            break;
+
         int32_t nCh = (ch > 0x20 && ch < 0x80) ? pdecodeTable[ch - 0x20] : -1;
 
         if (nCh != -1) {
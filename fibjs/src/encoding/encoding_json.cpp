@@ -10,7 +10,9 @@
 #include "qstring.h"
 #include "Buffer.h"
 #include "utf8.h"
+#include "RecordSchema.h"
 #include <stdlib.h>
+#include <math.h>
 
 #include "v8.h"
 #include "v8/src/api/api-inl.h"
@@ -68,7 +70,7 @@ inline int32_t qstrcmp(const char16_t* s1, const char* s2, ssize_t sz = -1)
 }
 
 inline result_t _jsonDecode(exlib::string data,
-    v8::Local<v8::Value>& retVal)
+    v8::Local<v8::Value>& retVal, RecordSchema* schema = NULL)
 {
     class json_parser {
     public:
@@ -81,6 +83,8 @@ inline result_t _jsonDecode(exlib::string data,
             , source_(source.c_str())
             , source_length_(source.length())
             , position_(-1)
+            , fields_(&zone_)
+            , slots_(&zone_)
         {
         }
 
@@ -268,7 +272,72 @@ inline result_t _jsonDecode(exlib::string data,
             return 0;
         }
 
-        result_t ParseJsonArray(i::MaybeHandle<i::Object>& retVal)
+        // a key without escapes is looked up by its source bytes, so a key
+        // seen before costs neither a conversion nor an allocation
+        result_t ParseJsonKey(const char*& key, size_t& len, exlib::string& escaped)
+        {
+            ssize_t pos = position_ + 1;
+
+            while (pos < source_length_) {
+                char ch = source_[pos];
+                if (ch == '"' || ch == '\\' || ch == '\r' || ch == '\n' || ch == 0)
+                    break;
+                pos++;
+            }
+
+            if (pos < source_length_ && source_[pos] == '"') {
+                key = source_ + position_ + 1;
+                len = pos - position_ - 1;
+                position_ = pos;
+                AdvanceSkipWhitespace();
+                return 0;
+            }
+
+            exlib::wstring str;
+            i::MaybeHandle<i::Object> k;
+
+            result_t hr = ParseJsonString(k, str);
+            if (hr < 0)
+                return hr;
+
+            escaped = utf16to8String(str);
+            key = escaped.c_str();
+            len = escaped.length();
+            return 0;
+        }
+
+        i::Handle<i::String> InternalizeKey(const char* key, size_t len)
+        {
+            return keys_.get(key, len, [this](const char* k, size_t n) {
+                return factory()->InternalizeUtf8String(base::Vector<const char>(k, n));
+            });
+        }
+
+        i::Handle<i::String> FieldKey(const RecordSchema::field& f)
+        {
+            i::Handle<i::String> name;
+
+            if (!fields_[f.m_id].ToHandle(&name)) {
+                name = factory()->InternalizeUtf8String(base::Vector<const char>(f.m_name.c_str(), f.m_name.length()));
+                fields_[f.m_id] = name;
+            }
+
+            return name;
+        }
+
+        result_t ParseJsonField(i::MaybeHandle<i::Object>& retVal, const RecordSchema::field& f)
+        {
+            if (f.m_record) {
+                if (f.m_array && c0_ == '[')
+                    return ParseJsonArray(retVal, f.m_record);
+                if (!f.m_array && c0_ == '{')
+                    return ParseJsonObject(retVal, f.m_record);
+            }
+
+            return ParseJsonValue(retVal);
+        }
+
+        result_t ParseJsonArray(i::MaybeHandle<i::Object>& retVal, RecordSchema* schema = NULL)
         {
             i::ZoneVector<i::Handle<i::Object>> els(&zone_);
             result_t hr;
@@ -280,7 +349,10 @@ inline result_t _jsonDecode(exlib::string data,
                     i::MaybeHandle<i::Object> el;
                     i::Handle<i::Object> el1;
 
-                    hr = ParseJsonValue(el);
+                    if (schema && c0_ == '{')
+                        hr = ParseJsonObject(el, schema);
+                    else
+                        hr = ParseJsonValue(el);
                     if (hr < 0)
                         return hr;
 
@@ -305,12 +377,18 @@ inline result_t _jsonDecode(exlib::string data,
             return 0;
         }
 
-        result_t ParseJsonObject(i::MaybeHandle<i::Object>& retVal)
+        // with a schema the values are matched to the fields by their key
+        // bytes and the object is built in schema order, so every record of
+        // the layout gets the same hidden class. unknown keys are dropped.
+        result_t ParseJsonObject(i::MaybeHandle<i::Object>& retVal, RecordSchema* schema = NULL)
         {
             i::Handle<i::JSObject> json_object = factory()->NewJSObject(object_constructor_);
             result_t hr;
-            i::Handle<i::String> type;
-            i::Handle<i::Object> data;
+            size_t base = slots_.size();
+            int32_t n = 0;
+
+            if (schema)
+                slots_.resize(base + schema->m_fields.size());
 
             AdvanceSkipWhitespace();
             if (c0_ != '}') {
@@ -318,11 +396,12 @@ inline result_t _jsonDecode(exlib::string data,
                     if (c0_ != '"')
                         return ReportUnexpectedCharacter();
 
-                    exlib::wstring str;
-                    i::MaybeHandle<i::Object> key;
+                    const char* key;
+                    size_t len;
+                    exlib::string escaped;
                     i::MaybeHandle<i::Object> value;
 
-                    hr = ParseJsonString(key, str);
+                    hr = ParseJsonKey(key, len, escaped);
                     if (hr < 0)
                         return hr;
 
@@ -331,12 +410,28 @@ inline result_t _jsonDecode(exlib::string data,
 
                     AdvanceSkipWhitespace();
 
+                    if (schema) {
+                        int32_t idx = schema->find(key, len, n++);
+                        if (idx < 0)
+                            hr = ParseJsonValue(value);
+                        else {
+                            hr = ParseJsonField(value, schema->m_fields[idx]);
+                            slots_[base + idx] = value;
+                        }
+                        if (hr < 0)
+                            return hr;
+
+                        continue;
+                    }
+
+                    i::Handle<i::String> name = escaped.empty()
+                        ? InternalizeKey(key, len)
+                        : factory()->InternalizeUtf8String(base::Vector<const char>(key, len));
+
                     hr = ParseJsonValue(value);
                     if (hr < 0)
                         return hr;
 
-                    i::Handle<i::String> name = i::Object::ToString(v8_isolate, key.ToHandleChecked()).ToHandleChecked();
-
                     i::JSObject::DefinePropertyOrElementIgnoreAttributes(json_object,
                         name, value.ToHandleChecked())
                         .Check();
@@ -348,6 +443,19 @@ inline result_t _jsonDecode(exlib::string data,
 
             AdvanceSkipWhitespace();
 
+            if (schema) {
+                for (size_t i = 0; i < schema->m_fields.size(); i++) {
+                    i::Handle<i::Object> value;
+
+                    if (slots_[base + i].ToHandle(&value))
+                        i::JSObject::DefinePropertyOrElementIgnoreAttributes(json_object,
+                            FieldKey(schema->m_fields[i]), value)
+                            .Check();
+                }
+
+                slots_.resize(base);
+            }
+
             retVal = json_object;
             return 0;
         }
@@ -418,6 +526,27 @@ inline result_t _jsonDecode(exlib::string data,
             return ParseJsonValue(retVal);
         }
 
+        result_t ParseJson(v8::Local<v8::Value>& retVal, RecordSchema* schema)
+        {
+            i::MaybeHandle<i::Object> maybe;
+            result_t hr;
+
+            fields_.resize(schema->m_count);
+
+            AdvanceSkipWhitespace();
+            if (c0_ == '[')
+                hr = ParseJsonArray(maybe, schema);
+            else if (c0_ == '{')
+                hr = ParseJsonObject(maybe, schema);
+            else
+                hr = ParseJsonValue(maybe);
+            if (hr < 0)
+                return hr;
+
+            v8::ToLocal(maybe, &retVal);
+            return 0;
+        }
+
         i::Factory* factory()
         {
             return v8_isolate->factory();
@@ -432,9 +561,14 @@ inline result_t _jsonDecode(exlib::string data,
         ssize_t source_length_;
         ssize_t position_;
         char c0_;
+        KeyCache<i::Handle<i::String>> keys_;
+        i::ZoneVector<i::MaybeHandle<i::String>> fields_;
+        i::ZoneVector<i::MaybeHandle<i::Object>> slots_;
     };
 
     json_parser jp(data);
+    if (schema)
+        return jp.ParseJson(retVal, schema);
     return jp.ParseJson(retVal);
 }
 
@@ -450,6 +584,229 @@ result_t json_base::decode(exlib::string data, v8::Local<v8::Value>& retVal)
     return _jsonDecode(data, retVal);
 }
 
+void json_quote(exlib::string& out, const char* s, size_t len)
+{
+    static const char* s_hex = "0123456789abcdef";
+    size_t i, p = 0;
+
+    out.append(1, '"');
+    for (i = 0; i < len; i++) {
+        unsigned char ch = (unsigned char)s[i];
+
+        if (ch >= 0x20 && ch != '"' && ch != '\\')
+            continue;
+
+        out.append(s + p, i - p);
+        p = i + 1;
+
+        switch (ch) {
+        case '"':
+            out.append("\\\"");
+            break;
+        case '\\':
+            out.append("\\\\");
+            break;
+        case '\b':
+            out.append("\\b");
+            break;
+        case '\f':
+            out.append("\\f");
+            break;
+        case '\n':
+            out.append("\\n");
+            break;
+        case '\r':
+            out.append("\\r");
+            break;
+        case '\t':
+            out.append("\\t");
+            break;
+        default:
+            out.append("\\u00");
+            out.append(1, s_hex[ch >> 4]);
+            out.append(1, s_hex[ch & 15]);
+            break;
+        }
+    }
+    out.append(s + p, len - p);
+    out.append(1, '"');
+}
+
+class JsonWriter {
+public:
+    JsonWriter(RecordSchema* schema)
+        : isolate(Isolate::current())
+        , m_keys(schema->m_count)
+    {
+    }
+
+public:
+    result_t write(v8::Local<v8::Value> element, RecordSchema* schema)
+    {
+        if (element->IsArray())
+            return write_records(element, schema);
+
+        return write_record(element, schema);
+    }
+
+private:
+    v8::Local<v8::String> key(const RecordSchema::field& f)
+    {
+        v8::Local<v8::String>& k = m_keys[f.m_id];
+
+        if (k.IsEmpty())
+            k = v8::String::NewFromUtf8(isolate->m_isolate, f.m_name.c_str(),
+                v8::NewStringType::kInternalized, (int32_t)f.m_name.length())
+                    .ToLocalChecked();
+
+        return k;
+    }
+
+    result_t write_value(v8::Local<v8::Value> element)
+    {
+        if (element->IsString()) {
+            v8::String::Utf8Value v(isolate->m_isolate, element);
+            json_quote(m_buf, *v, v.length());
+        } else if (element->IsNumber()) {
+            double num = element.As<v8::Number>()->Value();
+
+            if (!isfinite(num))
+                m_buf.append("null");
+            else if (num < 9007199254740992.0 && num > -9007199254740992.0 && num == (double)(int64_t)num) {
+                char buf[32];
+                m_buf.append(buf, snprintf(buf, sizeof(buf), "%lld", (long long)num));
+            } else {
+                v8::String::Utf8Value v(isolate->m_isolate, element);
+                m_buf.append(*v, v.length());
+            }
+        } else if (element->IsTrue())
+            m_buf.append("true");
+        else if (element->IsFalse())
+            m_buf.append("false");
+        else if (element->IsNull() || element->IsUndefined() || element->IsFunction())
+            m_buf.append("null");
+        else {
+            v8::Local<v8::String> str;
+            if (!v8::JSON::Stringify(isolate->context(), element).ToLocal(&str))
+                return CALL_E_JAVASCRIPT;
+
+            v8::String::Utf8Value v(isolate->m_isolate, str);
+            if (!qstrcmp(*v, "undefined"))
+                m_buf.append("null");
+            else
+                m_buf.append(*v, v.length());
+        }
+
+        return 0;
+    }
+
+    result_t write_records(v8::Local<v8::Value> element, RecordSchema* schema)
+    {
+        if (!element->IsArray())
+            return write_value(element);
+
+        v8::Local<v8::Context> context = isolate->context();
+        v8::Local<v8::Array> arr = v8::Local<v8::Array>::Cast(element);
+        int32_t len = arr->Length();
+        int32_t i;
+        result_t hr;
+
+        m_buf.append(1, '[');
+        for (i = 0; i < len; i++) {
+            JSValue v = arr->Get(context, i);
+            if (v.IsEmpty())
+                return CALL_E_JAVASCRIPT;
+
+            if (i)
+                m_buf.append(1, ',');
+
+            hr = write_record(v, schema);
+            if (hr < 0)
+                return hr;
+        }
+        m_buf.append(1, ']');
+
+        return 0;
+    }
+
+    // names come pre-quoted from the schema, properties the schema does not
+    // know are not written.
+    result_t write_record(v8::Local<v8::Value> element, RecordSchema* schema)
+    {
+        if (!RecordSchema::is_record(element))
+            return write_value(element);
+
+        v8::Local<v8::Context> context = isolate->context();
+        v8::Local<v8::Object> o = v8::Local<v8::Object>::Cast(element);
+        bool first = true;
+        result_t hr;
+
+        m_buf.append(1, '{');
+        for (size_t i = 0; i < schema->m_fields.size(); i++) {
+            const RecordSchema::field& f = schema->m_fields[i];
+
+            JSValue v = o->Get(context, key(f));
+            if (v.IsEmpty())
+                return CALL_E_JAVASCRIPT;
+
+            if (v->IsUndefined() || v->IsFunction())
+                continue;
+
+            if (!first)
+                m_buf.append(1, ',');
+            first = false;
+
+            m_buf.append(f.m_json);
+
+            if (!f.m_record)
+                hr = write_value(v);
+            else if (f.m_array)
+                hr = write_records(v, f.m_record);
+            else
+                hr = write_record(v, f.m_record);
+            if (hr < 0)
+                return hr;
+        }
+        m_buf.append(1, '}');
+
+        return 0;
+    }
+
+public:
+    exlib::string m_buf;
+
+private:
+    Isolate* isolate;
+    std::vector<v8::Local<v8::String>> m_keys;
+};
+
+result_t json_base::compile(v8::Local<v8::Object> schema, obj_ptr<JsonSchema_base>& retVal)
+{
+    obj_ptr<RecordSchema> rs;
+    result_t hr = RecordSchema::create(schema, rs);
+    if (hr < 0)
+        return hr;
+
+    retVal = new JsonSchema(rs);
+    return 0;
+}
+
+result_t JsonSchema::encode(v8::Local<v8::Value> data, exlib::string& retVal)
+{
+    JsonWriter jw(m_schema);
+    result_t hr = jw.write(data, m_schema);
+    if (hr < 0)
+        return hr;
+
+    retVal = jw.m_buf;
+    return 0;
+}
+
+result_t JsonSchema::decode(exlib::string data, v8::Local<v8::Value>& retVal)
+{
+    return _jsonDecode(data, retVal, m_schema);
+}
+
 result_t encoding_base::jsstr(exlib::string str, bool json, exlib::string& retVal)
 {
     const char* p;
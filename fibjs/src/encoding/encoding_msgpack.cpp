@@ -8,185 +8,511 @@
 #include "object.h"
 #include "ifs/encoding.h"
 #include "Buffer.h"
+#include "RecordSchema.h"
 #include <msgpack.h>
 
 namespace fibjs {
 
 DECLARE_MODULE(msgpack);
 
-result_t msgpack_base::encode(v8::Local<v8::Value> data, obj_ptr<Buffer_base>& retVal)
-{
-    class MsgpackPacker {
-    public:
-        MsgpackPacker()
-        {
-            isolate = Isolate::current();
-            msgpack_sbuffer_init(&sbuf);
-            msgpack_packer_init(&pk, &sbuf, msgpack_sbuffer_write);
+class MsgpackPacker {
+public:
+    MsgpackPacker()
+    {
+        isolate = Isolate::current();
+        msgpack_sbuffer_init(&sbuf);
+        msgpack_packer_init(&pk, &sbuf, msgpack_sbuffer_write);
+    }
+
+    ~MsgpackPacker()
+    {
+        msgpack_sbuffer_destroy(&sbuf);
+    }
+
+    result_t pack(v8::Local<v8::Value> element)
+    {
+        if (element.IsEmpty() || element->IsFunction())
+            return CHECK_ERROR(CALL_E_BADVARTYPE);
+        else if (element->IsNull() || element->IsUndefined())
+            msgpack_pack_nil(&pk);
+        else if (element->IsBoolean() || element->IsBooleanObject()) {
+            if (isolate->toBoolean(element))
+                msgpack_pack_true(&pk);
+            else
+                msgpack_pack_false(&pk);
+        } else if (element->IsNumber() || element->IsNumberObject()) {
+            double num = isolate->toNumber(element);
+            if (static_cast<double>(static_cast<int64_t>(num)) == num) {
+                msgpack_pack_int64(&pk, (int64_t)num);
+            } else {
+                msgpack_pack_double(&pk, num);
+            }
+        } else if (element->IsBigInt() || element->IsBigIntObject()) {
+            v8::Local<v8::BigInt> mv;
+            bool less;
+
+            mv = element->ToBigInt(isolate->context()).FromMaybe(v8::Local<v8::BigInt>());
+            msgpack_pack_int64(&pk, mv->Int64Value(&less));
+        } else if (element->IsDate()) {
+            date_t d = isolate->toNumber(element);
+            msgpack_timestamp _d;
+
+            d.get_timestamp(_d);
+            msgpack_pack_timestamp(&pk, &_d);
+        } else if (element->IsArray()) {
+            return pack(v8::Local<v8::Array>::Cast(element));
+        } else if (element->IsSet()) {
+            return pack(v8::Local<v8::Set>::Cast(element)->AsArray());
+        } else if (element->IsMap()) {
+            return pack(v8::Local<v8::Map>::Cast(element));
+        } else if (element->IsObject() && !element->IsStringObject()) {
+            return pack(v8::Local<v8::Object>::Cast(element));
+        } else {
+            v8::String::Utf8Value v(isolate->m_isolate, element);
+
+            msgpack_pack_str(&pk, v.length());
+            msgpack_pack_str_body(&pk, ToCString(v), v.length());
         }
 
-        ~MsgpackPacker()
-        {
-            msgpack_sbuffer_destroy(&sbuf);
-        }
+        return 0;
+    }
 
-        result_t pack(v8::Local<v8::Value> element)
-        {
-            if (element.IsEmpty() || element->IsFunction())
-                return CHECK_ERROR(CALL_E_BADVARTYPE);
-            else if (element->IsNull() || element->IsUndefined())
-                msgpack_pack_nil(&pk);
-            else if (element->IsBoolean() || element->IsBooleanObject()) {
-                if (isolate->toBoolean(element))
-                    msgpack_pack_true(&pk);
-                else
-                    msgpack_pack_false(&pk);
-            } else if (element->IsNumber() || element->IsNumberObject()) {
-                double num = isolate->toNumber(element);
-                if (static_cast<double>(static_cast<int64_t>(num)) == num) {
-                    msgpack_pack_int64(&pk, (int64_t)num);
-                } else {
-                    msgpack_pack_double(&pk, num);
-                }
-            } else if (element->IsBigInt() || element->IsBigIntObject()) {
-                v8::Local<v8::BigInt> mv;
-                bool less;
-
-                mv = element->ToBigInt(isolate->context()).FromMaybe(v8::Local<v8::BigInt>());
-                msgpack_pack_int64(&pk, mv->Int64Value(&less));
-            } else if (element->IsDate()) {
-                date_t d = isolate->toNumber(element);
-                msgpack_timestamp _d;
-
-                d.get_timestamp(_d);
-                msgpack_pack_timestamp(&pk, &_d);
-            } else if (element->IsArray()) {
-                return pack(v8::Local<v8::Array>::Cast(element));
-            } else if (element->IsSet()) {
-                return pack(v8::Local<v8::Set>::Cast(element)->AsArray());
-            } else if (element->IsMap()) {
-                return pack(v8::Local<v8::Map>::Cast(element));
-            } else if (element->IsObject() && !element->IsStringObject()) {
-                return pack(v8::Local<v8::Object>::Cast(element));
-            } else {
-                v8::String::Utf8Value v(isolate->m_isolate, element);
+    result_t pack(v8::Local<v8::Object> element)
+    {
+        obj_ptr<Buffer> buf;
+        v8::Local<v8::Context> context = isolate->context();
 
-                msgpack_pack_str(&pk, v.length());
-                msgpack_pack_str_body(&pk, ToCString(v), v.length());
-            }
+        if (element->IsUint8Array())
+            buf = new Buffer(element.As<v8::Uint8Array>());
+        else
+            buf = Buffer::getInstance(element);
+
+        if (buf) {
+            msgpack_pack_bin(&pk, buf->length());
+            msgpack_pack_bin_body(&pk, buf->data(), buf->length());
 
             return 0;
         }
 
-        result_t pack(v8::Local<v8::Object> element)
-        {
-            obj_ptr<Buffer> buf;
-            v8::Local<v8::Context> context = isolate->context();
+        JSValue jsonFun = element->Get(context, isolate->NewString("toJSON", 6));
+        if (!IsEmpty(jsonFun) && jsonFun->IsFunction()) {
+            JSValue p = isolate->NewString("");
+            JSValue element1 = v8::Local<v8::Function>::Cast(jsonFun)->Call(context, element, 1, &p);
 
-            if (element->IsUint8Array())
-                buf = new Buffer(element.As<v8::Uint8Array>());
-            else
-                buf = Buffer::getInstance(element);
+            if (!IsEmpty(element1)) {
+                if (element1->IsArray())
+                    return pack(v8::Local<v8::Array>::Cast(element1));
 
-            if (buf) {
-                msgpack_pack_bin(&pk, buf->length());
-                msgpack_pack_bin_body(&pk, buf->data(), buf->length());
+                if (!element1->IsObject())
+                    return pack(element1);
 
-                return 0;
+                element = v8::Local<v8::Object>::Cast(element1);
             }
+        }
 
-            JSValue jsonFun = element->Get(context, isolate->NewString("toJSON", 6));
-            if (!IsEmpty(jsonFun) && jsonFun->IsFunction()) {
-                JSValue p = isolate->NewString("");
-                JSValue element1 = v8::Local<v8::Function>::Cast(jsonFun)->Call(context, element, 1, &p);
+        JSArray ks = element->GetPropertyNames(context);
+        int32_t len = ks->Length();
+        int32_t i;
+        result_t hr;
 
-                if (!IsEmpty(element1)) {
-                    if (element1->IsArray())
-                        return pack(v8::Local<v8::Array>::Cast(element1));
+        std::vector<JSValue> ka;
+        std::vector<JSValue> va;
 
-                    if (!element1->IsObject())
-                        return pack(element1);
+        for (i = 0; i < len; i++) {
+            JSValue k = ks->Get(context, i);
+            JSValue v = element->Get(context, k);
 
-                    element = v8::Local<v8::Object>::Cast(element1);
-                }
+            if (!v->IsFunction()) {
+                ka.push_back(k);
+                va.push_back(v);
             }
+        }
 
-            JSArray ks = element->GetPropertyNames(context);
-            int32_t len = ks->Length();
-            int32_t i;
-            result_t hr;
+        msgpack_pack_map(&pk, ka.size());
+        for (i = 0; i < (int32_t)ka.size(); i++) {
+            hr = pack(ka[i]);
+            if (hr < 0)
+                return hr;
 
-            std::vector<JSValue> ka;
-            std::vector<JSValue> va;
+            hr = pack(va[i]);
+            if (hr < 0)
+                return hr;
+        }
 
-            for (i = 0; i < len; i++) {
-                JSValue k = ks->Get(context, i);
-                JSValue v = element->Get(context, k);
+        return 0;
+    }
+
+    result_t pack(v8::Local<v8::Array> element)
+    {
+        v8::Local<v8::Context> context = isolate->context();
+        int32_t len = element->Length();
+        int32_t i;
+        result_t hr;
+
+        msgpack_pack_array(&pk, len);
+        for (i = 0; i < len; i++) {
+            hr = pack((JSValue)element->Get(context, i));
+            if (hr < 0)
+                return hr;
+        }
 
-                if (!v->IsFunction()) {
-                    ka.push_back(k);
-                    va.push_back(v);
-                }
-            }
+        return 0;
+    }
 
-            msgpack_pack_map(&pk, ka.size());
-            for (i = 0; i < (int32_t)ka.size(); i++) {
-                hr = pack(ka[i]);
-                if (hr < 0)
-                    return hr;
+    result_t pack(v8::Local<v8::Map> element)
+    {
+        v8::Local<v8::Context> context = isolate->context();
 
-                hr = pack(va[i]);
-                if (hr < 0)
-                    return hr;
-            }
+        v8::Local<v8::Array> arr = element->AsArray();
+        uint32_t size = element->Size();
+        uint32_t len = arr->Length();
 
-            return 0;
+        uint32_t i;
+        result_t hr;
+
+        msgpack_pack_map(&pk, size);
+        for (i = 0; i < len; i++) {
+            hr = pack((JSValue)arr->Get(context, i));
+            if (hr < 0)
+                return hr;
         }
 
-        result_t pack(v8::Local<v8::Array> element)
-        {
-            v8::Local<v8::Context> context = isolate->context();
-            int32_t len = element->Length();
-            int32_t i;
-            result_t hr;
+        return 0;
+    }
+
+    result_t pack(v8::Local<v8::Value> element, RecordSchema* schema)
+    {
+        m_keys.resize(schema->m_count);
+
+        if (element->IsArray())
+            return pack_records(element, schema);
+
+        return pack_record(element, schema);
+    }
+
+private:
+    v8::Local<v8::String> key(const RecordSchema::field& f)
+    {
+        v8::Local<v8::String>& k = m_keys[f.m_id];
+
+        if (k.IsEmpty())
+            k = v8::String::NewFromUtf8(isolate->m_isolate, f.m_name.c_str(),
+                v8::NewStringType::kInternalized, (int32_t)f.m_name.length())
+                    .ToLocalChecked();
+
+        return k;
+    }
+
+    result_t pack_records(v8::Local<v8::Value> element, RecordSchema* schema)
+    {
+        if (!element->IsArray())
+            return pack(element);
+
+        v8::Local<v8::Context> context = isolate->context();
+        v8::Local<v8::Array> arr = v8::Local<v8::Array>::Cast(element);
+        int32_t len = arr->Length();
+        int32_t i;
+        result_t hr;
+
+        msgpack_pack_array(&pk, len);
+        for (i = 0; i < len; i++) {
+            JSValue v = arr->Get(context, i);
+            if (v.IsEmpty())
+                return CALL_E_JAVASCRIPT;
+
+            hr = pack_record(v, schema);
+            if (hr < 0)
+                return hr;
+        }
 
-            msgpack_pack_array(&pk, len);
-            for (i = 0; i < len; i++) {
-                hr = pack((JSValue)element->Get(context, i));
-                if (hr < 0)
-                    return hr;
+        return 0;
+    }
+
+    // fields are read with cached internalized keys and written in schema
+    // order with their names packed from the schema, properties the schema
+    // does not know are not written.
+    result_t pack_record(v8::Local<v8::Value> element, RecordSchema* schema)
+    {
+        if (!RecordSchema::is_record(element))
+            return pack(element);
+
+        v8::Local<v8::Context> context = isolate->context();
+        v8::Local<v8::Object> o = v8::Local<v8::Object>::Cast(element);
+        int32_t cnt = (int32_t)schema->m_fields.size();
+        size_t base = m_values.size();
+        int32_t n = 0;
+        int32_t i;
+        result_t hr = 0;
+
+        m_values.resize(base + cnt);
+        for (i = 0; i < cnt; i++) {
+            JSValue v = o->Get(context, key(schema->m_fields[i]));
+            if (v.IsEmpty()) {
+                m_values.resize(base);
+                return CALL_E_JAVASCRIPT;
             }
 
-            return 0;
+            if (!v->IsUndefined() && !v->IsFunction()) {
+                m_values[base + i] = v;
+                n++;
+            }
         }
 
-        result_t pack(v8::Local<v8::Map> element)
-        {
-            v8::Local<v8::Context> context = isolate->context();
+        msgpack_pack_map(&pk, n);
+        for (i = 0; i < cnt && hr >= 0; i++) {
+            v8::Local<v8::Value> v = m_values[base + i];
+            if (v.IsEmpty())
+                continue;
+
+            const RecordSchema::field& f = schema->m_fields[i];
+            msgpack_pack_str(&pk, f.m_name.length());
+            msgpack_pack_str_body(&pk, f.m_name.c_str(), f.m_name.length());
+
+            if (!f.m_record)
+                hr = pack(v);
+            else if (f.m_array)
+                hr = pack_records(v, f.m_record);
+            else
+                hr = pack_record(v, f.m_record);
+        }
 
-            v8::Local<v8::Array> arr = element->AsArray();
-            uint32_t size = element->Size();
-            uint32_t len = arr->Length();
+        m_values.resize(base);
+        return hr;
+    }
+
+public:
+    Isolate* isolate;
+    msgpack_sbuffer sbuf;
+    msgpack_packer pk;
+
+private:
+    std::vector<v8::Local<v8::String>> m_keys;
+    std::vector<v8::Local<v8::Value>> m_values;
+};
+
+class MsgpackUnPacker {
+public:
+    MsgpackUnPacker()
+    {
+        isolate = Isolate::current();
+        msgpack_zone_init(&mempool, 2048);
+    }
+
+    ~MsgpackUnPacker()
+    {
+        msgpack_zone_destroy(&mempool);
+    }
+
+    result_t unpack(Buffer_base* data)
+    {
+        Buffer* buf = Buffer::Cast(data);
+        msgpack_unpack_return ret = msgpack_unpack((const char*)buf->data(), buf->length(), NULL, &mempool, &deserialized);
+        if (ret != 2)
+            return -1;
 
-            uint32_t i;
-            result_t hr;
+        return 0;
+    }
+
+    v8::Local<v8::Value> map_js_value(msgpack_object* o)
+    {
+        v8::Local<v8::Context> context = isolate->context();
+        v8::Local<v8::Value> v;
+
+        switch (o->type) {
+        case MSGPACK_OBJECT_NIL:
+            v = v8::Null(isolate->m_isolate);
+            break;
+        case MSGPACK_OBJECT_BOOLEAN:
+            v = o->via.boolean ? v8::True(isolate->m_isolate) : v8::False(isolate->m_isolate);
+            break;
+        case MSGPACK_OBJECT_FLOAT32:
+        case MSGPACK_OBJECT_FLOAT64:
+            v = v8::Number::New(isolate->m_isolate, o->via.f64);
+            break;
+        case MSGPACK_OBJECT_NEGATIVE_INTEGER:
+            if (o->via.i64 <= 9007199254740992 && o->via.i64 >= -9007199254740992)
+                v = v8::Number::New(isolate->m_isolate, (double)o->via.i64);
+            else
+                v = v8::BigInt::New(isolate->m_isolate, o->via.i64);
+            break;
+        case MSGPACK_OBJECT_POSITIVE_INTEGER:
+            if (o->via.u64 <= 9007199254740992)
+                v = v8::Number::New(isolate->m_isolate, (double)o->via.u64);
+            else
+                v = v8::BigInt::New(isolate->m_isolate, o->via.u64);
+            break;
+        case MSGPACK_OBJECT_STR:
+            v = isolate->NewString(o->via.str.ptr, (int32_t)o->via.str.size);
+            break;
+        case MSGPACK_OBJECT_BIN: {
+            obj_ptr<Buffer_base> buf = new Buffer(o->via.bin.ptr, (int32_t)o->via.bin.size);
+            v = buf->wrap();
+            break;
+        }
+        case MSGPACK_OBJECT_ARRAY: {
+            v8::Local<v8::Array> arr = v8::Array::New(isolate->m_isolate, (int32_t)o->via.array.size);
+            int32_t i;
+
+            for (i = 0; i < (int32_t)o->via.array.size; i++)
+                arr->Set(context, i, map_js_value(o->via.array.ptr + i)).IsJust();
+            v = arr;
+            break;
+        }
+        case MSGPACK_OBJECT_MAP: {
+            v8::Local<v8::Object> obj = v8::Object::New(isolate->m_isolate);
+            int32_t i;
+
+            for (i = 0; i < (int32_t)o->via.map.size; i++) {
+                msgpack_object_kv* p = o->via.map.ptr + i;
+
+                if (p->key.type == MSGPACK_OBJECT_STR)
+                    obj->CreateDataProperty(context, key(p->key.via.str.ptr, p->key.via.str.size),
+                           map_js_value(&p->val))
+                        .IsJust();
+            }
+            v = obj;
+            break;
+        }
+        case MSGPACK_OBJECT_EXT: {
+            if (o->via.ext.type == -1) {
+                msgpack_timestamp _d = { 0 };
+                date_t d;
+
+                msgpack_object_to_timestamp(o, &_d);
+                d.set_timestamp(_d);
+                v = d.value(isolate->m_isolate);
+            } else {
+                obj_ptr<Buffer_base> buf = new Buffer(o->via.ext.ptr, (int32_t)o->via.ext.size);
+                v = buf->wrap();
+            }
+            break;
+        }
+        default:
+            v = v8::Null(isolate->m_isolate);
+            break;
+        }
 
-            msgpack_pack_map(&pk, size);
-            for (i = 0; i < len; i++) {
-                hr = pack((JSValue)arr->Get(context, i));
-                if (hr < 0)
-                    return hr;
+        return v;
+    }
+
+    v8::Local<v8::Value> jsValue()
+    {
+        return map_js_value(&deserialized);
+    }
+
+    v8::Local<v8::Value> jsValue(RecordSchema* schema)
+    {
+        m_fields.resize(schema->m_count);
+
+        if (deserialized.type == MSGPACK_OBJECT_ARRAY)
+            return map_records(&deserialized, schema);
+
+        return map_record(&deserialized, schema);
+    }
+
+private:
+    v8::Local<v8::String> key(const char* s, size_t len)
+    {
+        Isolate* isolate = this->isolate;
+
+        return m_keys.get(s, len, [isolate](const char* k, size_t n) {
+            return v8::String::NewFromUtf8(isolate->m_isolate, k,
+                n > KeyCache<v8::Local<v8::String>>::kMaxKeyLength
+                    ? v8::NewStringType::kNormal
+                    : v8::NewStringType::kInternalized,
+                (int32_t)n)
+                .ToLocalChecked();
+        });
+    }
+
+    v8::Local<v8::String> key(const RecordSchema::field& f)
+    {
+        v8::Local<v8::String>& k = m_fields[f.m_id];
+
+        if (k.IsEmpty())
+            k = v8::String::NewFromUtf8(isolate->m_isolate, f.m_name.c_str(),
+                v8::NewStringType::kInternalized, (int32_t)f.m_name.length())
+                    .ToLocalChecked();
+
+        return k;
+    }
+
+    v8::Local<v8::Value> map_records(msgpack_object* o, RecordSchema* schema)
+    {
+        if (o->type != MSGPACK_OBJECT_ARRAY)
+            return map_js_value(o);
+
+        v8::Local<v8::Context> context = isolate->context();
+        v8::Local<v8::Array> arr = v8::Array::New(isolate->m_isolate, (int32_t)o->via.array.size);
+        int32_t i;
+
+        for (i = 0; i < (int32_t)o->via.array.size; i++)
+            arr->Set(context, i, map_record(o->via.array.ptr + i, schema)).IsJust();
+
+        return arr;
+    }
+
+    // values are matched to the schema by comparing the key bytes, the field
+    // at the same position is tried first. the object is always built in
+    // schema order so every record of the layout ends up with the same
+    // hidden class, keys the schema does not know are dropped.
+    v8::Local<v8::Value> map_record(msgpack_object* o, RecordSchema* schema)
+    {
+        if (o->type != MSGPACK_OBJECT_MAP)
+            return map_js_value(o);
+
+        v8::Local<v8::Context> context = isolate->context();
+        v8::Local<v8::Object> obj = v8::Object::New(isolate->m_isolate);
+        int32_t cnt = (int32_t)schema->m_fields.size();
+        size_t base = m_slots.size();
+        int32_t i;
+
+        m_slots.resize(base + cnt, (msgpack_object*)NULL);
+        for (i = 0; i < (int32_t)o->via.map.size; i++) {
+            msgpack_object_kv* p = o->via.map.ptr + i;
+
+            if (p->key.type == MSGPACK_OBJECT_STR) {
+                int32_t idx = schema->find(p->key.via.str.ptr, p->key.via.str.size, i);
+                if (idx >= 0)
+                    m_slots[base + idx] = &p->val;
             }
+        }
 
-            return 0;
+        for (i = 0; i < cnt; i++) {
+            msgpack_object* v = m_slots[base + i];
+            if (!v)
+                continue;
+
+            const RecordSchema::field& f = schema->m_fields[i];
+            v8::Local<v8::Value> jv;
+
+            if (!f.m_record)
+                jv = map_js_value(v);
+            else if (f.m_array)
+                jv = map_records(v, f.m_record);
+            else
+                jv = map_record(v, f.m_record);
+
+            obj->CreateDataProperty(context, key(f), jv).IsJust();
         }
 
-    public:
-        Isolate* isolate;
-        msgpack_sbuffer sbuf;
-        msgpack_packer pk;
-    };
+        m_slots.resize(base);
+        return obj;
+    }
 
+public:
+    Isolate* isolate;
+    msgpack_zone mempool;
+    msgpack_object deserialized;
+
+private:
+    KeyCache<v8::Local<v8::String>> m_keys;
+    std::vector<v8::Local<v8::String>> m_fields;
+    std::vector<msgpack_object*> m_slots;
+};
+
+result_t msgpack_base::encode(v8::Local<v8::Value> data, obj_ptr<Buffer_base>& retVal)
+{
     MsgpackPacker mp;
     result_t hr = mp.pack(data);
     if (hr < 0)
@@ -199,130 +525,49 @@ result_t msgpack_base::encode(v8::Local<v8::Value> data, obj_ptr<Buffer_base>& r
 
 result_t msgpack_base::decode(Buffer_base* data, v8::Local<v8::Value>& retVal)
 {
-    class MsgpackUnPacker {
-    public:
-        MsgpackUnPacker()
-        {
-            isolate = Isolate::current();
-            msgpack_zone_init(&mempool, 2048);
-        }
+    MsgpackUnPacker mu;
 
-        ~MsgpackUnPacker()
-        {
-            msgpack_zone_destroy(&mempool);
-        }
+    result_t hr = mu.unpack(data);
+    if (hr < 0)
+        return 0;
 
-        result_t unpack(Buffer_base* data)
-        {
-            Buffer* buf = Buffer::Cast(data);
-            msgpack_unpack_return ret = msgpack_unpack((const char*)buf->data(), buf->length(), NULL, &mempool, &deserialized);
-            if (ret != 2)
-                return -1;
+    retVal = mu.jsValue();
 
-            return 0;
-        }
+    return 0;
+}
 
-        v8::Local<v8::Value> map_js_value(msgpack_object* o)
-        {
-            v8::Local<v8::Context> context = isolate->context();
-            v8::Local<v8::Value> v;
-
-            switch (o->type) {
-            case MSGPACK_OBJECT_NIL:
-                v = v8::Null(isolate->m_isolate);
-                break;
-            case MSGPACK_OBJECT_BOOLEAN:
-                v = o->via.boolean ? v8::True(isolate->m_isolate) : v8::False(isolate->m_isolate);
-                break;
-            case MSGPACK_OBJECT_FLOAT32:
-            case MSGPACK_OBJECT_FLOAT64:
-                v = v8::Number::New(isolate->m_isolate, o->via.f64);
-                break;
-            case MSGPACK_OBJECT_NEGATIVE_INTEGER:
-                if (o->via.i64 <= 9007199254740992 && o->via.i64 >= -9007199254740992)
-                    v = v8::Number::New(isolate->m_isolate, (double)o->via.i64);
-                else
-                    v = v8::BigInt::New(isolate->m_isolate, o->via.i64);
-                break;
-            case MSGPACK_OBJECT_POSITIVE_INTEGER:
-                if (o->via.u64 <= 9007199254740992)
-                    v = v8::Number::New(isolate->m_isolate, (double)o->via.u64);
-                else
-                    v = v8::BigInt::New(isolate->m_isolate, o->via.u64);
-                break;
-            case MSGPACK_OBJECT_STR:
-                v = isolate->NewString(o->via.str.ptr, (int32_t)o->via.str.size);
-                break;
-            case MSGPACK_OBJECT_BIN: {
-                obj_ptr<Buffer_base> buf = new Buffer(o->via.bin.ptr, (int32_t)o->via.bin.size);
-                v = buf->wrap();
-                break;
-            }
-            case MSGPACK_OBJECT_ARRAY: {
-                v8::Local<v8::Array> arr = v8::Array::New(isolate->m_isolate, (int32_t)o->via.array.size);
-                int32_t i;
-
-                for (i = 0; i < (int32_t)o->via.array.size; i++)
-                    arr->Set(context, i, map_js_value(o->via.array.ptr + i)).IsJust();
-                v = arr;
-                break;
-            }
-            case MSGPACK_OBJECT_MAP: {
-                v8::Local<v8::Object> obj = v8::Object::New(isolate->m_isolate);
-                int32_t i;
-
-                for (i = 0; i < (int32_t)o->via.map.size; i++) {
-                    msgpack_object_kv* p = o->via.map.ptr + i;
-
-                    if (p->key.type == MSGPACK_OBJECT_STR) {
-                        obj->Set(context, isolate->NewString(p->key.via.str.ptr, (int32_t)p->key.via.str.size),
-                               map_js_value(&p->val))
-                            .IsJust();
-                    }
-                }
-                v = obj;
-                break;
-            }
-            case MSGPACK_OBJECT_EXT: {
-                if (o->via.ext.type == -1) {
-                    msgpack_timestamp _d = { 0 };
-                    date_t d;
-
-                    msgpack_object_to_timestamp(o, &_d);
-                    d.set_timestamp(_d);
-                    v = d.value(isolate->m_isolate);
-                } else {
-                    obj_ptr<Buffer_base> buf = new Buffer(o->via.ext.ptr, (int32_t)o->via.ext.size);
-                    v = buf->wrap();
-                }
-                break;
-            }
-            default:
-                v = v8::Null(isolate->m_isolate);
-                break;
-            }
+result_t msgpack_base::compile(v8::Local<v8::Object> schema, obj_ptr<MsgpackSchema_base>& retVal)
+{
+    obj_ptr<RecordSchema> rs;
+    result_t hr = RecordSchema::create(schema, rs);
+    if (hr < 0)
+        return hr;
 
-            return v;
-        }
+    retVal = new MsgpackSchema(rs);
+    return 0;
+}
 
-        v8::Local<v8::Value> jsValue()
-        {
-            return map_js_value(&deserialized);
-        }
+result_t MsgpackSchema::encode(v8::Local<v8::Value> data, obj_ptr<Buffer_base>& retVal)
+{
+    MsgpackPacker mp;
+    result_t hr = mp.pack(data, m_schema);
+    if (hr < 0)
+        return hr;
 
-    public:
-        Isolate* isolate;
-        msgpack_zone mempool;
-        msgpack_object deserialized;
-    };
+    retVal = new Buffer(mp.sbuf.data, mp.sbuf.size);
 
+    return 0;
+}
+
+result_t MsgpackSchema::decode(Buffer_base* data, v8::Local<v8::Value>& retVal)
+{
     MsgpackUnPacker mu;
 
     result_t hr = mu.unpack(data);
     if (hr < 0)
         return 0;
 
-    retVal = mu.jsValue();
+    retVal = mu.jsValue(m_schema);
 
     return 0;
 }
@@ -37,8 +37,6 @@ result_t File::read(int32_t bytes, obj_ptr<Buffer_base>& retVal,
     if (ac->isSync())
         return CHECK_ERROR(CALL_E_NOSYNC);
 
-    exlib::string strBuf;
-
     if (bytes < 0) {
         int64_t p = _lseeki64(m_fd, 0, SEEK_CUR);
         if (p < 0)
@@ -59,31 +57,7 @@ result_t File::read(int32_t bytes, obj_ptr<Buffer_base>& retVal,
         bytes = (int32_t)sz;
     }
 
-    if (bytes > 0) {
-        strBuf.resize(bytes);
-        int32_t sz = bytes;
-        char* p = strBuf.data();
-
-        while (sz) {
-            int32_t n = (int32_t)::_read(m_fd, p, sz > STREAM_BUFF_SIZE ? STREAM_BUFF_SIZE : sz);
-            if (n < 0)
-                return CHECK_ERROR(LastError());
-            if (n == 0)
-                break;
-
-            sz -= n;
-            p += n;
-        }
-
-        strBuf.resize(bytes - sz);
-    }
-
-    if (strBuf.length() == 0)
-        return CALL_RETURN_NULL;
-
-    retVal = new Buffer(strBuf.c_str(), strBuf.length());
-
-    return 0;
+    return Read(bytes, retVal);
 }
 
 result_t File::readAll(obj_ptr<Buffer_base>& retVal, AsyncEvent* ac)
@@ -94,9 +68,6 @@ result_t File::readAll(obj_ptr<Buffer_base>& retVal, AsyncEvent* ac)
     if (ac->isSync())
         return CHECK_ERROR(CALL_E_NOSYNC);
 
-    exlib::string strBuf;
-
-    int32_t bytes;
     int64_t p = _lseeki64(m_fd, 0, SEEK_CUR);
     if (p < 0)
         return CHECK_ERROR(LastError());
@@ -109,32 +80,29 @@ result_t File::readAll(obj_ptr<Buffer_base>& retVal, AsyncEvent* ac)
         return CHECK_ERROR(LastError());
 
     sz -= p;
+    if (sz > INT32_MAX)
+        return CHECK_ERROR(CALL_E_OVERFLOW);
 
-    bytes = (int32_t)sz;
-
-    if (bytes > 0) {
-        strBuf.resize(bytes);
-        int32_t sz = bytes;
-        char* p = strBuf.data();
+    return Read((int32_t)sz, retVal);
+}
 
-        while (sz) {
-            int32_t n = (int32_t)::_read(m_fd, p, sz > STREAM_BUFF_SIZE ? STREAM_BUFF_SIZE : sz);
-            if (n < 0)
-                return CHECK_ERROR(LastError());
-            if (n == 0)
-                break;
+result_t File::Read(int32_t bytes, obj_ptr<Buffer_base>& retVal)
+{
+    if (bytes <= 0)
+        return CALL_RETURN_NULL;
 
-            sz -= n;
-            p += n;
-        }
+    obj_ptr<Buffer> buf = new Buffer(NULL, bytes);
+    int32_t n;
 
-        strBuf.resize(bytes - sz);
-    }
+    result_t hr = file_read(m_fd, buf->data(), bytes, n);
+    if (hr < 0)
+        return hr;
 
-    if (strBuf.length() == 0)
+    if (n == 0)
         return CALL_RETURN_NULL;
 
-    retVal = new Buffer(strBuf.c_str(), strBuf.length());
+    buf->resize(n);
+    retVal = buf;
 
     return 0;
 }
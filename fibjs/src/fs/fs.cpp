@@ -45,6 +45,11 @@ result_t FileHandle::read(Buffer_base* buffer, int32_t offset, int32_t length, i
     return fs_base::read(this, buffer, offset, length, position, retVal, ac);
 }
 
+result_t FileHandle::readv(v8::Local<v8::Array> buffers, int32_t position, int32_t& retVal, AsyncEvent* ac)
+{
+    return fs_base::readv(this, buffers, position, retVal, ac);
+}
+
 result_t FileHandle::write(Buffer_base* buffer, int32_t offset, int32_t length, int32_t position, int32_t& retVal, AsyncEvent* ac)
 {
     return fs_base::write(this, buffer, offset, length, position, retVal, ac);
@@ -328,32 +333,52 @@ result_t fs_base::read(FileHandle_base* fd, Buffer_base* buffer, int32_t offset,
             return CHECK_ERROR(LastError());
     }
 
-    exlib::string strBuf;
-    if (length > 0) {
-        strBuf.resize(length);
-        int32_t sz = length;
-        char* p = strBuf.data();
+    return file_read(_fd, Buffer::Cast(buffer)->data() + offset, length, retVal);
+}
 
-        while (sz) {
-            int32_t n = (int32_t)::_read(_fd, p, sz > STREAM_BUFF_SIZE ? STREAM_BUFF_SIZE : sz);
-            if (n < 0)
-                return CHECK_ERROR(LastError());
-            if (n == 0)
-                break;
+result_t fs_base::readv(FileHandle_base* fd, v8::Local<v8::Array> buffers, int32_t position,
+    int32_t& retVal, AsyncEvent* ac)
+{
+    int32_t _fd;
+    fd->get_fd(_fd);
 
-            sz -= n;
-            p += n;
+    if (_fd < 0)
+        return CHECK_ERROR(CALL_E_INVALID_CALL);
+
+    if (ac->isSync()) {
+        Isolate* isolate = Isolate::current(buffers);
+        v8::Local<v8::Context> context = isolate->context();
+        int32_t len = buffers->Length();
+        int64_t total = 0;
+
+        ac->m_ctx.resize(len);
+        for (int32_t i = 0; i < len; i++) {
+            JSValue v = buffers->Get(context, i);
+            obj_ptr<Buffer> buf = Buffer::getInstance(v);
+            if (!buf)
+                return CHECK_ERROR(Runtime::setError("fs: buffers must be an array of Buffer"));
+
+            total += buf->length();
+            if (total > INT32_MAX)
+                return CHECK_ERROR(Runtime::setError("fs: total length of buffers is too large"));
+
+            ac->m_ctx[i] = buf;
         }
 
-        strBuf.resize(length - sz);
+        return CHECK_ERROR(CALL_E_NOSYNC);
     }
 
-    if (strBuf.length() == 0) {
-        retVal = 0;
-        return 0;
+    std::vector<obj_ptr<Buffer>> bufs;
+    bufs.resize(ac->m_ctx.size());
+    for (size_t i = 0; i < bufs.size(); i++)
+        bufs[i] = (Buffer*)ac->m_ctx[i].object();
+
+    if (position > -1) {
+        if (_lseeki64(_fd, position, SEEK_SET) < 0)
+            return CHECK_ERROR(LastError());
     }
 
-    return buffer->write(strBuf, offset, (int32_t)strBuf.length(), "utf8", retVal);
+    return file_readv(_fd, bufs, retVal);
 }
 
 result_t fs_base::write(FileHandle_base* fd, Buffer_base* buffer, int32_t offset, int32_t length,
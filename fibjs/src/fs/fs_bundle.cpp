@@ -0,0 +1,243 @@
+/*
+ * fs_bundle.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "Bundle.h"
+#include "utf8.h"
+#include "AsyncUV.h"
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace fibjs {
+
+const char Bundle::magic[8] = { 'F', 'I', 'B', 'J', 'S', 'B', 'N', 'D' };
+
+static std::unordered_map<exlib::string, obj_ptr<Bundle>> s_bundles;
+static exlib::spinlock s_bundlelock;
+
+uint64_t Bundle::hash(const char* name, size_t len)
+{
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)name[i];
+        h *= 0x100000001b3ull;
+    }
+
+    return h;
+}
+
+Bundle::~Bundle()
+{
+    if (m_map == NULL)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_map);
+    CloseHandle(m_hMap);
+#else
+    munmap(m_map, m_map_size);
+#endif
+}
+
+// the mapping is read only, so a module can not be changed for the loads
+// after it by whoever got its buffer
+bool Bundle::map(exlib::string fname)
+{
+#ifdef _WIN32
+    HANDLE hFile = CreateFileW(UTF8_W(fname), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER sz;
+    if (!GetFileSizeEx(hFile, &sz) || sz.QuadPart < (LONGLONG)sizeof(Trailer)) {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    m_map_size = (size_t)sz.QuadPart;
+
+    m_hMap = CreateFileMappingW(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(hFile);
+    if (m_hMap == NULL)
+        return false;
+
+    m_map = (char*)MapViewOfFile(m_hMap, FILE_MAP_READ, 0, 0, 0);
+    if (m_map == NULL) {
+        CloseHandle(m_hMap);
+        return false;
+    }
+#else
+    int32_t fd = ::open(fname.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size < (off_t)sizeof(Trailer)) {
+        ::close(fd);
+        return false;
+    }
+
+    m_map_size = (size_t)st.st_size;
+
+    void* p = mmap(NULL, m_map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+        return false;
+
+    m_map = (char*)p;
+#endif
+
+    const Trailer* t = (const Trailer*)(m_map + m_map_size - sizeof(Trailer));
+
+    if (memcmp(t->magic, magic, sizeof(magic)) || t->version != version
+        || t->size < sizeof(Trailer) || t->size > m_map_size
+        || t->slots == 0 || (t->slots & (t->slots - 1))
+        || t->index_offset > t->size - sizeof(Trailer)
+        || (uint64_t)t->slots * sizeof(Slot) > t->size - sizeof(Trailer) - t->index_offset)
+        return false;
+
+    m_base = m_map + m_map_size - t->size;
+    m_size = t->size;
+    m_data_size = t->index_offset;
+    m_slots = (const Slot*)(m_base + t->index_offset);
+    m_slot_count = t->slots;
+
+    return true;
+}
+
+obj_ptr<Bundle> Bundle::open(exlib::string fname)
+{
+    obj_ptr<Bundle> b;
+    date_t _now;
+
+    _now.now();
+
+    s_bundlelock.lock();
+    auto it = s_bundles.find(fname);
+    if (it != s_bundles.end()) {
+        b = it->second;
+        if (_now.diff(b->m_date) <= 3000) {
+            s_bundlelock.unlock();
+            return b->m_base ? b : NULL;
+        }
+    }
+    s_bundlelock.unlock();
+
+    // like the zip cache, a file is checked at most every three seconds, and
+    // looked at again when its size or mtime has changed
+    AutoReq req;
+    if (uv_fs_stat(NULL, &req, fname.c_str(), NULL) < 0) {
+        erase(fname);
+        return NULL;
+    }
+
+    date_t _mtime = req.statbuf.st_mtim.tv_sec * 1000.0 + (req.statbuf.st_mtim.tv_nsec / 1000000.0);
+
+    if (b && b->m_map_size == req.statbuf.st_size && _mtime.diff(b->m_mtime) == 0) {
+        s_bundlelock.lock();
+        b->m_date = _now;
+        s_bundlelock.unlock();
+        return b->m_base ? b : NULL;
+    }
+
+    // a file that is not a bundle, most likely a zip, is remembered too, as
+    // an empty entry with the size and mtime of the file
+    b = new Bundle();
+    if (!b->map(fname)) {
+        b = new Bundle();
+        b->m_map_size = (size_t)req.statbuf.st_size;
+    }
+
+    b->m_mtime = _mtime;
+    b->m_date = _now;
+
+    s_bundlelock.lock();
+    s_bundles.insert_or_assign(fname, b);
+    s_bundlelock.unlock();
+
+    return b->m_base ? b : NULL;
+}
+
+bool Bundle::is_bundle(exlib::string fname)
+{
+    return open(fname) != NULL;
+}
+
+void Bundle::erase(exlib::string fname)
+{
+    s_bundlelock.lock();
+    if (fname.empty())
+        s_bundles.clear();
+    else
+        s_bundles.erase(fname);
+    s_bundlelock.unlock();
+}
+
+bool Bundle::find(exlib::string fname, obj_ptr<Bundle>& bundle, exlib::string& member)
+{
+    size_t pos = fname.find('$');
+    if (pos == exlib::string::npos || fname.c_str()[pos + 1] != PATH_SLASH)
+        return false;
+
+    bundle = open(fname.substr(0, pos));
+    if (!bundle)
+        return false;
+
+    member = fname.substr(pos + 2);
+#ifdef _WIN32
+    char* p = member.data();
+    for (size_t i = 0; i < member.length(); i++)
+        if (p[i] == PATH_SLASH)
+            p[i] = '/';
+#endif
+
+    return true;
+}
+
+const Bundle::Slot* Bundle::lookup(exlib::string member, int32_t kind) const
+{
+    uint64_t h = hash(member.c_str(), member.length());
+    uint32_t mask = m_slot_count - 1;
+
+    for (uint32_t i = 0; i < m_slot_count; i++) {
+        const Slot* s = m_slots + ((h + i) & mask);
+
+        if (s->kind == kEmpty)
+            return NULL;
+
+        if (s->hash == h && s->kind == kind && s->name_length == member.length()
+            && s->offset <= m_data_size && s->size <= m_data_size - s->offset
+            && (uint64_t)s->name_offset + s->name_length <= m_size
+            && !memcmp(m_base + s->name_offset, member.c_str(), member.length()))
+            return s;
+    }
+
+    return NULL;
+}
+
+obj_ptr<Buffer> Bundle::buffer(const Slot* slot)
+{
+    Ref();
+
+    std::shared_ptr<v8::BackingStore> store = v8::ArrayBuffer::NewBackingStore((void*)data(slot), (size_t)slot->size,
+        [](void* data, size_t length, void* deleter_data) {
+            ((Bundle*)deleter_data)->Unref();
+        },
+        this);
+
+    return new Buffer(store, 0, (size_t)slot->size);
+}
+
+} /* namespace fibjs */
@@ -12,6 +12,7 @@
 #include "File.h"
 #include "MemoryStream.h"
 #include "ZipFile.h"
+#include "Bundle.h"
 #include "AsyncUV.h"
 #include <list>
 
@@ -39,6 +40,8 @@ void cache_node::erase(exlib::string name)
         s_cachelock.lock();
         s_cache_map.clear();
         s_cachelock.unlock();
+
+        Bundle::erase("");
     } else {
         std::list<obj_ptr<cache_node>>::iterator it;
 
@@ -48,6 +51,8 @@ void cache_node::erase(exlib::string name)
         s_cachelock.lock();
         s_cache_map.erase(safe_name);
         s_cachelock.unlock();
+
+        Bundle::erase(safe_name);
     }
 }
 
@@ -230,6 +235,28 @@ static result_t resolve_zip_file(exlib::string fname, obj_ptr<ZipFile::Info>& re
 
 static result_t zip_stat(exlib::string path, obj_ptr<Stat_base>& retVal, AsyncEvent* ac)
 {
+    obj_ptr<Bundle> bundle;
+    exlib::string member;
+    if (Bundle::find(path, bundle, member)) {
+        const Bundle::Slot* slot = bundle->lookup(member, Bundle::kFile);
+        if (!slot)
+            return CALL_E_FILE_NOT_FOUND;
+
+        obj_ptr<Stat> pStat = new Stat();
+        pStat->init();
+
+        path_base::basename(path, "", pStat->name);
+
+        pStat->m_mode = S_IRUSR;
+        pStat->size = (int64_t)slot->size;
+        pStat->mtime = pStat->atime = pStat->ctime = pStat->birthtime = bundle->m_mtime;
+        pStat->m_isMemory = true;
+
+        retVal = pStat;
+
+        return 0;
+    }
+
     obj_ptr<ZipFile::Info> zi;
     result_t hr = resolve_zip_file(path, zi, ac);
     if (hr >= 0) {
@@ -316,6 +343,17 @@ result_t fs_base::openFile(exlib::string fname, exlib::string flags,
     exlib::string safe_name;
     path_base::normalize(fname, safe_name);
 
+    obj_ptr<Bundle> bundle;
+    exlib::string member;
+    if (Bundle::find(safe_name, bundle, member)) {
+        const Bundle::Slot* slot = bundle->lookup(member, Bundle::kFile);
+        if (!slot)
+            return CALL_E_FILE_NOT_FOUND;
+
+        retVal = new MemoryStream::CloneStream(exlib::string(bundle->data(slot), (size_t)slot->size), bundle->m_mtime);
+        return 0;
+    }
+
     obj_ptr<ZipFile::Info> zi;
     result_t hr = resolve_zip_file(safe_name, zi, ac);
     if (hr >= 0) {
@@ -0,0 +1,406 @@
+/*
+ * AccessLog.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "AccessLog.h"
+#include "ifs/console.h"
+#include <thread>
+
+namespace fibjs {
+
+enum {
+    T_TEXT = 0,
+    T_REMOTE_ADDR,
+    T_TIME_LOCAL,
+    T_TIME_ISO,
+    T_REQUEST,
+    T_METHOD,
+    T_URI,
+    T_PATH,
+    T_QUERY,
+    T_PROTOCOL,
+    T_STATUS,
+    T_BYTES,
+    T_LATENCY,
+    T_REQUEST_TIME,
+    T_HEADER
+};
+
+static const struct {
+    const char* name;
+    int32_t type;
+} s_vars[] = {
+    { "remote_addr", T_REMOTE_ADDR },
+    { "time_local", T_TIME_LOCAL },
+    { "time_iso", T_TIME_ISO },
+    { "request", T_REQUEST },
+    { "method", T_METHOD },
+    { "uri", T_URI },
+    { "path", T_PATH },
+    { "query", T_QUERY },
+    { "protocol", T_PROTOCOL },
+    { "status", T_STATUS },
+    { "bytes", T_BYTES },
+    { "latency", T_LATENCY },
+    { "request_time", T_REQUEST_TIME }
+};
+
+static const char* s_common = "$remote_addr - - [$time_local] \"$request\" $status $bytes";
+static const char* s_combined = "$remote_addr - - [$time_local] \"$request\" $status $bytes \"$http_referer\" \"$http_user_agent\"";
+
+static bool is_token(const exlib::string& name)
+{
+    const char* s = name.c_str();
+
+    if (!*s)
+        return false;
+
+    for (; *s; s++)
+        if (!(qisdigit(*s) || qisupper(*s) || qislower(*s) || *s == '-' || *s == '_'))
+            return false;
+
+    return true;
+}
+
+result_t AccessLog::compile(exlib::string format)
+{
+    const char* s = format.c_str();
+    exlib::string text;
+
+    while (*s) {
+        if (*s != '$') {
+            text.append(1, *s++);
+            continue;
+        }
+
+        s++;
+
+        bool braced = *s == '{';
+        if (braced)
+            s++;
+
+        const char* p = s;
+        while (qisdigit(*s) || qislower(*s) || qisupper(*s) || *s == '_')
+            s++;
+
+        exlib::string name(p, s - p);
+
+        if (braced) {
+            if (*s != '}')
+                return CHECK_ERROR(Runtime::setError("HttpHandler: unterminated variable in access log format."));
+            s++;
+        }
+
+        if (name.empty()) {
+            text.append(1, '$');
+            continue;
+        }
+
+        if (!text.empty()) {
+            m_tokens.push_back(token(T_TEXT, text));
+            text.clear();
+        }
+
+        if (!qstrcmp(name.c_str(), "http_", 5) && name.length() > 5) {
+            exlib::string hdr = name.substr(5);
+            for (size_t i = 0; i < hdr.length(); i++)
+                if (hdr[i] == '_')
+                    hdr[i] = '-';
+
+            m_tokens.push_back(token(T_HEADER, hdr));
+            continue;
+        }
+
+        int32_t i;
+        for (i = 0; i < (int32_t)ARRAYSIZE(s_vars); i++)
+            if (name == s_vars[i].name)
+                break;
+
+        if (i == (int32_t)ARRAYSIZE(s_vars))
+            return CHECK_ERROR(Runtime::setError("HttpHandler: unknown access log variable '$" + name + "'."));
+
+        m_tokens.push_back(token(s_vars[i].type));
+    }
+
+    if (!text.empty())
+        m_tokens.push_back(token(T_TEXT, text));
+
+    return 0;
+}
+
+result_t AccessLog::create(v8::Local<v8::Object> opts, obj_ptr<AccessLog>& retVal)
+{
+    Isolate* isolate = Isolate::current();
+    obj_ptr<AccessLog> log = new AccessLog();
+    result_t hr;
+
+    exlib::string format("combined");
+    hr = GetConfigValue(isolate, opts, "format", format, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    std::vector<exlib::string> headers;
+    v8::Local<v8::Array> a;
+    hr = GetConfigValue(isolate, opts, "headers", a, true);
+    if (hr >= 0) {
+        v8::Local<v8::Context> context = isolate->context();
+        int32_t len = a->Length();
+
+        for (int32_t i = 0; i < len; i++) {
+            exlib::string name;
+            hr = GetArgumentValue(isolate, JSValue(a->Get(context, i)), name);
+            if (hr < 0)
+                return hr;
+
+            if (!is_token(name))
+                return CHECK_ERROR(Runtime::setError("HttpHandler: invalid header name '" + name + "'."));
+
+            headers.push_back(name);
+        }
+    } else if (hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    if (format == "json") {
+        log->m_json = true;
+
+        log->m_tokens.push_back(token(T_TEXT, "{\"time\":\""));
+        log->m_tokens.push_back(token(T_TIME_ISO));
+        log->m_tokens.push_back(token(T_TEXT, "\",\"remote\":\""));
+        log->m_tokens.push_back(token(T_REMOTE_ADDR));
+        log->m_tokens.push_back(token(T_TEXT, "\",\"method\":\""));
+        log->m_tokens.push_back(token(T_METHOD));
+        log->m_tokens.push_back(token(T_TEXT, "\",\"uri\":\""));
+        log->m_tokens.push_back(token(T_URI));
+        log->m_tokens.push_back(token(T_TEXT, "\",\"protocol\":\""));
+        log->m_tokens.push_back(token(T_PROTOCOL));
+        log->m_tokens.push_back(token(T_TEXT, "\",\"status\":"));
+        log->m_tokens.push_back(token(T_STATUS));
+        log->m_tokens.push_back(token(T_TEXT, ",\"bytes\":"));
+        log->m_tokens.push_back(token(T_BYTES));
+        log->m_tokens.push_back(token(T_TEXT, ",\"latency\":"));
+        log->m_tokens.push_back(token(T_LATENCY));
+
+        if (headers.size()) {
+            for (size_t i = 0; i < headers.size(); i++) {
+                log->m_tokens.push_back(token(T_TEXT, (i ? "\",\"" : ",\"headers\":{\"") + headers[i] + "\":\""));
+                log->m_tokens.push_back(token(T_HEADER, headers[i]));
+            }
+            log->m_tokens.push_back(token(T_TEXT, "\"}}"));
+        } else
+            log->m_tokens.push_back(token(T_TEXT, "}"));
+    } else {
+        if (format == "combined")
+            format = s_combined;
+        else if (format == "common")
+            format = s_common;
+
+        for (size_t i = 0; i < headers.size(); i++)
+            format += " \"$http_" + headers[i] + "\"";
+
+        hr = log->compile(format);
+        if (hr < 0)
+            return hr;
+    }
+
+    exlib::string path;
+    hr = GetConfigValue(isolate, opts, "path", path, true);
+    if (hr >= 0) {
+        obj_ptr<File> f = new File();
+
+        hr = f->open(path, "a");
+        if (hr < 0)
+            return hr;
+
+        log->m_file = f;
+    } else if (hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    retVal = log;
+    return 0;
+}
+
+static void append_escaped(exlib::string& out, const exlib::string& v, bool json)
+{
+    static const char* s_hex = "0123456789abcdef";
+    const char* s = v.c_str();
+    size_t len = v.length();
+
+    for (size_t i = 0; i < len; i++) {
+        unsigned char ch = (unsigned char)s[i];
+
+        if (ch == '"' || ch == '\\') {
+            out.append(1, '\\');
+            out.append(1, ch);
+        } else if (ch < 0x20 || ch == 0x7f || (!json && ch > 0x7f)) {
+            out.append(json ? "\\u00" : "\\x");
+            out.append(1, s_hex[ch >> 4]);
+            out.append(1, s_hex[ch & 15]);
+        } else
+            out.append(1, ch);
+    }
+}
+
+void AccessLog::log(HttpRequest_base* req, HttpResponse_base* rep, exlib::string& remote,
+    date_t& d, int64_t latency)
+{
+    exlib::string line;
+    exlib::string v;
+    char buf[64];
+
+    line.reserve(256);
+
+    for (size_t i = 0; i < m_tokens.size(); i++) {
+        token& t = m_tokens[i];
+
+        switch (t.m_type) {
+        case T_TEXT:
+            line.append(t.m_text);
+            continue;
+        case T_STATUS: {
+            int32_t status;
+            rep->get_statusCode(status);
+            line.append(buf, snprintf(buf, sizeof(buf), "%d", status));
+            continue;
+        }
+        case T_BYTES: {
+            int64_t len;
+            rep->get_length(len);
+            line.append(buf, snprintf(buf, sizeof(buf), "%lld", (long long)len));
+            continue;
+        }
+        case T_LATENCY:
+            line.append(buf, snprintf(buf, sizeof(buf), "%lld", (long long)latency));
+            continue;
+        case T_REQUEST_TIME:
+            line.append(buf, snprintf(buf, sizeof(buf), "%.3f", (double)latency / 1000000));
+            continue;
+        case T_TIME_LOCAL:
+            d.clfString(v);
+            line.append(v);
+            continue;
+        case T_TIME_ISO:
+            d.isoString(v);
+            line.append(v);
+            continue;
+        }
+
+        v.clear();
+        switch (t.m_type) {
+        case T_REMOTE_ADDR:
+            v = remote;
+            break;
+        case T_METHOD:
+            req->get_method(v);
+            break;
+        case T_PATH:
+            req->get_address(v);
+            break;
+        case T_QUERY:
+            req->get_queryString(v);
+            break;
+        case T_PROTOCOL:
+            req->get_protocol(v);
+            break;
+        case T_URI:
+        case T_REQUEST: {
+            exlib::string s;
+
+            if (t.m_type == T_REQUEST) {
+                req->get_method(v);
+                v.append(1, ' ');
+            }
+
+            req->get_address(s);
+            v.append(s);
+
+            s.clear();
+            req->get_queryString(s);
+            if (!s.empty()) {
+                v.append(1, '?');
+                v.append(s);
+            }
+
+            if (t.m_type == T_REQUEST) {
+                req->get_protocol(s);
+                v.append(1, ' ');
+                v.append(s);
+            }
+            break;
+        }
+        case T_HEADER:
+            req->firstHeader(t.m_text, v);
+            break;
+        }
+
+        if (v.empty() && !m_json)
+            line.append(1, '-');
+        else
+            append_escaped(line, v, m_json);
+    }
+
+    line.append(1, '\n');
+
+    shard& sh = m_shards[std::hash<std::thread::id>()(std::this_thread::get_id()) % kShards];
+
+    sh.m_lock.lock();
+    sh.m_buf.append(line);
+    sh.m_lock.unlock();
+
+    m_dirty.xchg(1);
+    if (m_working.CompareAndSwap(0, 1) == 0) {
+        Ref();
+        asyncCall(
+            [](AccessLog* pThis) -> result_t {
+                pThis->flush();
+                pThis->Unref();
+                return 0;
+            },
+            this, CALL_E_LONGSYNC);
+    }
+}
+
+void AccessLog::flush()
+{
+    do {
+        while (m_dirty.xchg(0)) {
+            exlib::string data;
+
+            for (int32_t i = 0; i < kShards; i++) {
+                shard& sh = m_shards[i];
+
+                sh.m_lock.lock();
+                if (data.empty())
+                    data.swap(sh.m_buf);
+                else {
+                    data.append(sh.m_buf);
+                    sh.m_buf.clear();
+                }
+                sh.m_lock.unlock();
+            }
+
+            if (data.empty())
+                continue;
+
+            if (m_file)
+                m_file->Write(data);
+            else {
+                const char* s = data.c_str();
+                const char* e = s + data.length();
+
+                while (s < e) {
+                    const char* p = (const char*)memchr(s, '\n', e - s);
+                    outLog(console_base::C_INFO, exlib::string(s, p - s));
+                    s = p + 1;
+                }
+            }
+        }
+
+        m_working.xchg(0);
+    } while (m_dirty.value() && m_working.CompareAndSwap(0, 1) == 0);
+}
+
+} /* namespace fibjs */
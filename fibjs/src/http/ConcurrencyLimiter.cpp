@@ -0,0 +1,270 @@
+/*
+ * ConcurrencyLimiter.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "ConcurrencyLimiter.h"
+#include "Metrics.h"
+#include "Timer.h"
+#include <math.h>
+
+namespace fibjs {
+
+#define INITIAL_LIMIT 32
+
+result_t ConcurrencyLimiter::create(v8::Local<v8::Object> opts, obj_ptr<ConcurrencyLimiter>& retVal)
+{
+    Isolate* isolate = Isolate::current();
+    obj_ptr<ConcurrencyLimiter> limiter = new ConcurrencyLimiter();
+    result_t hr;
+
+    hr = GetConfigValue(isolate, opts, "maxConcurrency", limiter->m_max, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    hr = GetConfigValue(isolate, opts, "minConcurrency", limiter->m_min, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    hr = GetConfigValue(isolate, opts, "maxQueue", limiter->m_maxQueue, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    hr = GetConfigValue(isolate, opts, "queueTimeout", limiter->m_queueTimeout, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    hr = GetConfigValue(isolate, opts, "adaptive", limiter->m_adaptive, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    if (limiter->m_max < 0 || limiter->m_min < 1 || limiter->m_maxQueue < 0 || limiter->m_queueTimeout < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    if (limiter->m_max == 0) {
+        retVal.Release();
+        return 0;
+    }
+
+    if (limiter->m_min > limiter->m_max)
+        limiter->m_min = limiter->m_max;
+
+    limiter->m_queueTimeout *= 1000;
+    limiter->m_limit = limiter->m_max;
+    if (limiter->m_adaptive && limiter->m_limit > INITIAL_LIMIT)
+        limiter->m_limit = limiter->m_min > INITIAL_LIMIT ? limiter->m_min : INITIAL_LIMIT;
+
+    retVal = limiter;
+    return 0;
+}
+
+// drops the waiters that passed queueTimeout even while every slot is busy,
+// stalled requests are when shedding matters most
+class QueueTimer : public Timer {
+public:
+    QueueTimer(int32_t timeout, ConcurrencyLimiter* limiter)
+        : Timer(timeout)
+        , m_limiter(limiter)
+    {
+    }
+
+public:
+    virtual void on_timer()
+    {
+        m_limiter->expire();
+    }
+
+private:
+    obj_ptr<ConcurrencyLimiter> m_limiter;
+};
+
+static void resume(std::vector<AsyncState*>& admitted, std::vector<AsyncState*>& expired)
+{
+    for (size_t i = 0; i < expired.size(); i++) {
+        metrics_http_shed()->inc();
+        expired[i]->apost(CALL_RETURN_NULL);
+    }
+
+    for (size_t i = 0; i < admitted.size(); i++)
+        admitted[i]->apost(0);
+}
+
+// called with m_lock held. waiters past queueTimeout are dropped from the
+// head of the queue, the client has most likely given up on them already,
+// the others are admitted in order while there is room.
+void ConcurrencyLimiter::dispatch(int64_t now, std::vector<AsyncState*>& admitted, std::vector<AsyncState*>& expired)
+{
+    while (!m_waiters.empty()) {
+        waiter w = m_waiters.front();
+
+        if (m_queueTimeout > 0 && now - w.m_time > m_queueTimeout) {
+            m_waiters.pop_front();
+            m_timeouts++;
+            m_shed++;
+            expired.push_back(w.m_as);
+        } else if (m_inflight < (int32_t)m_limit) {
+            m_waiters.pop_front();
+            m_inflight++;
+            m_accepted++;
+            admitted.push_back(w.m_as);
+        } else
+            break;
+    }
+}
+
+// called with m_lock held. returns the delay in ms of the timer to start
+// once the lock is dropped, 0 when no timer is needed.
+int32_t ConcurrencyLimiter::arm(int64_t now)
+{
+    if (m_queueTimeout <= 0 || m_timer || m_waiters.empty())
+        return 0;
+
+    m_timer = true;
+    return (int32_t)((m_waiters.front().m_time + m_queueTimeout - now) / 1000) + 1;
+}
+
+result_t ConcurrencyLimiter::acquire(AsyncState* as)
+{
+    std::vector<AsyncState*> admitted;
+    std::vector<AsyncState*> expired;
+    int64_t now = Metric::now();
+    int32_t timeout = 0;
+    result_t hr;
+
+    m_lock.lock();
+
+    dispatch(now, admitted, expired);
+
+    // a new request never goes ahead of the ones already waiting
+    if (m_waiters.empty() && m_inflight < (int32_t)m_limit) {
+        m_inflight++;
+        m_accepted++;
+        hr = 0;
+    } else if ((int32_t)m_waiters.size() < m_maxQueue) {
+        m_waiters.push_back({ as, now });
+        m_queued++;
+        timeout = arm(now);
+        hr = CALL_E_PENDDING;
+    } else {
+        m_shed++;
+        hr = CALL_RETURN_NULL;
+    }
+
+    m_lock.unlock();
+
+    resume(admitted, expired);
+    if (timeout > 0)
+        (new QueueTimer(timeout, this))->sleep();
+
+    if (hr == CALL_RETURN_NULL)
+        metrics_http_shed()->inc();
+
+    return hr;
+}
+
+void ConcurrencyLimiter::release(int64_t latency)
+{
+    std::vector<AsyncState*> admitted;
+    std::vector<AsyncState*> expired;
+    int64_t now = m_queueTimeout > 0 ? Metric::now() : 0;
+
+    m_lock.lock();
+
+    m_inflight--;
+    if (m_adaptive)
+        update(latency);
+
+    dispatch(now, admitted, expired);
+
+    m_lock.unlock();
+
+    resume(admitted, expired);
+}
+
+void ConcurrencyLimiter::expire()
+{
+    std::vector<AsyncState*> admitted;
+    std::vector<AsyncState*> expired;
+    int64_t now = Metric::now();
+    int32_t timeout;
+
+    m_lock.lock();
+
+    m_timer = false;
+    dispatch(now, admitted, expired);
+    timeout = arm(now);
+
+    m_lock.unlock();
+
+    resume(admitted, expired);
+    if (timeout > 0)
+        (new QueueTimer(timeout, this))->sleep();
+}
+
+// gradient limiter: the long term latency average is the baseline, a sample
+// above twice the baseline shrinks the limit in proportion, otherwise the
+// limit grows by its square root, which stands for the queue we allow.
+void ConcurrencyLimiter::update(int64_t latency)
+{
+    if (latency <= 0)
+        latency = 1;
+
+    if (m_longLatency == 0)
+        m_longLatency = (double)latency;
+    else {
+        m_longLatency = m_longLatency * 0.99 + (double)latency * 0.01;
+
+        // let the baseline recover faster after a slow period
+        if (m_longLatency > (double)latency * 2)
+            m_longLatency *= 0.95;
+    }
+
+    double gradient = 2 * m_longLatency / (double)latency;
+    if (gradient > 1)
+        gradient = 1;
+    else if (gradient < 0.5)
+        gradient = 0.5;
+
+    double limit = m_limit * gradient + sqrt(m_limit);
+
+    // do not grow while the traffic does not use the current limit
+    if (limit > m_limit && m_inflight < m_limit / 2)
+        return;
+
+    m_limit = m_limit * 0.8 + limit * 0.2;
+    if (m_limit > m_max)
+        m_limit = m_max;
+    else if (m_limit < m_min)
+        m_limit = m_min;
+}
+
+void ConcurrencyLimiter::stats(Isolate* isolate, v8::Local<v8::Object>& retVal)
+{
+    v8::Local<v8::Context> context = isolate->context();
+    v8::Local<v8::Object> o = v8::Object::New(isolate->m_isolate);
+
+    m_lock.lock();
+    int32_t limit = (int32_t)m_limit;
+    int32_t inflight = m_inflight;
+    int32_t waiting = (int32_t)m_waiters.size();
+    int64_t accepted = m_accepted;
+    int64_t queued = m_queued;
+    int64_t shed = m_shed;
+    int64_t timeouts = m_timeouts;
+    m_lock.unlock();
+
+    o->Set(context, isolate->NewString("limit"), v8::Number::New(isolate->m_isolate, limit)).IsJust();
+    o->Set(context, isolate->NewString("inflight"), v8::Number::New(isolate->m_isolate, inflight)).IsJust();
+    o->Set(context, isolate->NewString("waiting"), v8::Number::New(isolate->m_isolate, waiting)).IsJust();
+    o->Set(context, isolate->NewString("accepted"), v8::Number::New(isolate->m_isolate, (double)accepted)).IsJust();
+    o->Set(context, isolate->NewString("queued"), v8::Number::New(isolate->m_isolate, (double)queued)).IsJust();
+    o->Set(context, isolate->NewString("shed"), v8::Number::New(isolate->m_isolate, (double)shed)).IsJust();
+    o->Set(context, isolate->NewString("timeouts"), v8::Number::New(isolate->m_isolate, (double)timeouts)).IsJust();
+
+    retVal = o;
+}
+
+} /* namespace fibjs */
@@ -18,6 +18,8 @@
 #include "ifs/json.h"
 #include "ifs/msgpack.h"
 #include "ifs/querystring.h"
+#include "Metrics.h"
+#include "Timer.h"
 #include <string.h>
 
 namespace fibjs {
@@ -491,6 +493,7 @@ result_t HttpClient::request(Stream_base* conn, HttpRequest_base* req, SeekableS
             , m_req(req)
             , m_response_body(response_body)
             , m_retVal(retVal)
+            , m_start(Metric::now())
         {
             next(send);
 
@@ -550,9 +553,16 @@ result_t HttpClient::request(Stream_base* conn, HttpRequest_base* req, SeekableS
                 m_retVal->set_body(m_unzip);
             }
 
+            metrics_http_client()->observe(Metric::now() - m_start);
             return next();
         }
 
+        virtual int32_t error(int32_t v)
+        {
+            metrics_http_client_errors()->inc();
+            return v;
+        }
+
     private:
         obj_ptr<HttpClient> m_hc;
         Stream_base* m_conn;
@@ -562,6 +572,7 @@ result_t HttpClient::request(Stream_base* conn, HttpRequest_base* req, SeekableS
         obj_ptr<SeekableStream_base> m_body;
         obj_ptr<SeekableStream_base> m_response_body;
         obj_ptr<HttpResponse_base>& m_retVal;
+        int64_t m_start;
         bool m_bNoBody;
     };
 
@@ -601,10 +612,21 @@ result_t HttpClient::request(exlib::string method, obj_ptr<Url>& u, SeekableStre
             next(prepare);
         }
 
+        ~asyncRequest()
+        {
+            if (m_timer)
+                m_timer->clear();
+        }
+
         ON_STATE(asyncRequest, prepare)
         {
             bool _domain = false;
 
+            m_timeout = m_hc->m_timeout;
+            result_t hr = clip_timeout(m_timeout);
+            if (hr < 0)
+                return hr;
+
             m_urls[m_url] = true;
 
             exlib::string path;
@@ -690,9 +712,9 @@ result_t HttpClient::request(exlib::string method, obj_ptr<Url>& u, SeekableStre
 
             if (m_http_proxy.empty()) {
                 if (m_ssl)
-                    return tls_base::connect(m_connUrl, m_hc->m_context, m_hc->m_timeout, m_conn, next(connected));
+                    return tls_base::connect(m_connUrl, m_hc->m_context, m_timeout, m_conn, next(connected));
                 else
-                    return net_base::connect(m_connUrl, m_hc->m_timeout, m_conn, next(connected));
+                    return net_base::connect(m_connUrl, m_timeout, m_conn, next(connected));
             } else {
                 bool socks = m_http_proxy.c_str()[0] == 's';
 
@@ -736,7 +758,7 @@ result_t HttpClient::request(exlib::string method, obj_ptr<Url>& u, SeekableStre
                 if (u->m_port.empty())
                     connUrl.append(def_port);
 
-                return net_base::connect(connUrl, m_hc->m_timeout, m_conn,
+                return net_base::connect(connUrl, m_timeout, m_conn,
                     next(socks
                             ? socks_hello
                             : m_ssl
@@ -749,7 +771,7 @@ result_t HttpClient::request(exlib::string method, obj_ptr<Url>& u, SeekableStre
         {
             obj_ptr<Buffer_base> buf = new Buffer("\5\1\0", 3);
 
-            m_conn.As<Socket_base>()->set_timeout(m_hc->m_timeout);
+            m_conn.As<Socket_base>()->set_timeout(m_timeout);
             return m_conn->write(buf, next(socks_hello_response));
         }
 
@@ -834,7 +856,7 @@ result_t HttpClient::request(exlib::string method, obj_ptr<Url>& u, SeekableStre
 
         ON_STATE(asyncRequest, ssl_connect)
         {
-            m_conn.As<Socket_base>()->set_timeout(m_hc->m_timeout);
+            m_conn.As<Socket_base>()->set_timeout(m_timeout);
             return m_hc->request(m_conn, m_reqConn, m_retVal, next(ssl_handshake));
         }
 
@@ -874,13 +896,32 @@ result_t HttpClient::request(exlib::string method, obj_ptr<Url>& u, SeekableStre
         ON_STATE(asyncRequest, connected)
         {
             if (!m_ssl)
-                m_conn.As<Socket_base>()->set_timeout(m_hc->m_timeout);
+                m_conn.As<Socket_base>()->set_timeout(m_timeout);
+
+            // socket timeouts bound each read, the deadline bounds the whole
+            // exchange, so the connection is dropped when it passes
+            if (deadline() > 0) {
+                int32_t timeout = 0;
+                result_t hr = clip_timeout(timeout);
+                if (hr < 0)
+                    return hr;
+
+                if (m_timer)
+                    m_timer->clear();
+                m_timer = new StreamTimer(timeout, m_conn);
+                m_timer->sleep();
+            }
 
             return m_hc->request(m_conn, m_req, m_response_body, m_retVal, next(requested));
         }
 
         ON_STATE(asyncRequest, requested)
         {
+            if (m_timer) {
+                m_timer->clear();
+                m_timer.Release();
+            }
+
             bool enableCookie;
             m_hc->get_enableCookie(enableCookie);
             if (enableCookie) {
@@ -942,6 +983,9 @@ result_t HttpClient::request(exlib::string method, obj_ptr<Url>& u, SeekableStre
 
         virtual int32_t error(int32_t v)
         {
+            if (m_timer && m_timer->fired())
+                return CHECK_ERROR(CALL_E_TIMEOUT);
+
             if (m_reuse && (at(ssl_connect) || at(connected))) {
                 m_reuse = false;
                 next(prepare);
@@ -970,6 +1014,8 @@ result_t HttpClient::request(exlib::string method, obj_ptr<Url>& u, SeekableStre
         exlib::string m_connUrl;
         obj_ptr<HttpClient> m_hc;
         obj_ptr<Buffer_base> m_buffer;
+        int32_t m_timeout;
+        obj_ptr<StreamTimer> m_timer;
         bool m_reuse;
     };
 
@@ -19,8 +19,8 @@ size_t HttpCollection::size()
     size_t i;
 
     for (i = 0; i < m_count; i++) {
-        pair& _pair = m_map[i];
-        sz += _pair.first.length() + _pair.second.length() + 4;
+        item& _item = m_map[i];
+        sz += name_len(_item) + value_len(_item) + 4;
     }
 
     return sz;
@@ -45,13 +45,11 @@ size_t HttpCollection::getData(char* buf, size_t sz)
     size_t i;
 
     for (i = 0; i < m_count; i++) {
-        pair& _pair = m_map[i];
-        exlib::string& n = _pair.first;
-        exlib::string& v = _pair.second;
+        item& _item = m_map[i];
 
-        cp(buf, sz, pos, n.c_str(), n.length());
+        cp(buf, sz, pos, name_ptr(_item), name_len(_item));
         cp(buf, sz, pos, ": ", 2);
-        cp(buf, sz, pos, v.c_str(), v.length());
+        cp(buf, sz, pos, value_ptr(_item), value_len(_item));
         cp(buf, sz, pos, "\r\n", 2);
     }
 
@@ -63,12 +61,14 @@ result_t HttpCollection::clear()
     size_t i;
 
     for (i = 0; i < m_count; i++) {
-        pair& _pair = m_map[i];
-        _pair.first.clear();
-        _pair.second.clear();
+        item& _item = m_map[i];
+        _item.m_name.clear();
+        _item.m_value.clear();
+        _item.m_view = false;
     }
 
     m_count = 0;
+    m_raw.clear();
 
     return 0;
 }
@@ -191,11 +191,12 @@ result_t HttpCollection::parseCookie(exlib::string& str)
 
 result_t HttpCollection::has(exlib::string name, bool& retVal)
 {
+    key _key(name);
     size_t i;
 
     retVal = false;
     for (i = 0; i < m_count; i++)
-        if (!qstricmp(m_map[i].first.c_str(), name.c_str())) {
+        if (match(m_map[i], _key)) {
             retVal = true;
             break;
         }
@@ -205,13 +206,14 @@ result_t HttpCollection::has(exlib::string name, bool& retVal)
 
 result_t HttpCollection::first(exlib::string name, Variant& retVal)
 {
+    key _key(name);
     size_t i;
 
     for (i = 0; i < m_count; i++) {
-        pair& _pair = m_map[i];
+        item& _item = m_map[i];
 
-        if (!qstricmp(_pair.first.c_str(), name.c_str())) {
-            retVal = _pair.second;
+        if (match(_item, _key)) {
+            retVal = value(_item);
             return 0;
         }
     }
@@ -326,15 +328,16 @@ result_t HttpCollection::set(exlib::string name, v8::Local<v8::Array> values)
 
 result_t HttpCollection::remove(exlib::string name)
 {
+    key _key(name);
     size_t i;
     int32_t p = 0;
 
     for (i = 0; i < m_count; i++) {
-        pair& _pair = m_map[i];
+        item& _item = m_map[i];
 
-        if (qstricmp(_pair.first.c_str(), name.c_str())) {
+        if (!match(_item, _key)) {
             if (i != p)
-                m_map[p] = _pair;
+                m_map[p] = _item;
 
             p++;
         }
@@ -353,8 +356,12 @@ result_t HttpCollection::_delete(exlib::string name)
 result_t HttpCollection::sort()
 {
     if (m_count)
-        std::sort(m_map.begin(), m_map.begin() + m_count, [](pair& a, pair& b) {
-            return a.first < b.first;
+        std::sort(m_map.begin(), m_map.begin() + m_count, [this](const item& a, const item& b) {
+            int32_t la = name_len(a);
+            int32_t lb = name_len(b);
+            int32_t n = memcmp(name_ptr(a), name_ptr(b), la < lb ? la : lb);
+
+            return n ? n < 0 : la < lb;
         });
 
     return 0;
@@ -366,7 +373,7 @@ result_t HttpCollection::keys(obj_ptr<NArray>& retVal)
     size_t i;
 
     for (i = 0; i < m_count; i++)
-        _keys->append(m_map[i].first);
+        _keys->append(name(m_map[i]));
 
     retVal = _keys;
 
@@ -379,7 +386,7 @@ result_t HttpCollection::values(obj_ptr<NArray>& retVal)
     size_t i;
 
     for (i = 0; i < m_count; i++)
-        _keys->append(m_map[i].second);
+        _keys->append(value(m_map[i]));
 
     retVal = _keys;
     return 0;
@@ -393,13 +400,14 @@ result_t HttpCollection::_named_getter(exlib::string property, Variant& retVal)
     v8::Local<v8::Array> a;
     Isolate* isolate = holder();
     v8::Local<v8::Context> context = isolate->context();
+    key _key(property);
 
     for (i = 0; i < m_count; i++) {
-        pair& _pair = m_map[i];
+        item& _item = m_map[i];
 
-        if (!qstricmp(_pair.first.c_str(), property.c_str())) {
+        if (match(_item, _key)) {
             if (n == 0) {
-                v = _pair.second;
+                v = value(_item);
                 n = 1;
             } else {
                 if (n == 1) {
@@ -408,7 +416,7 @@ result_t HttpCollection::_named_getter(exlib::string property, Variant& retVal)
                     v = a;
                 }
 
-                Variant t = _pair.second;
+                Variant t = value(_item);
                 a->Set(context, n++, t).IsJust();
             }
         }
@@ -432,9 +440,9 @@ result_t HttpCollection::_named_enumerator(v8::Local<v8::Array>& retVal)
 
     retVal = v8::Array::New(isolate->m_isolate);
     for (i = 0, n = 0; i < m_count; i++) {
-        exlib::string& name = m_map[i].first;
-        if (name_set.insert(name).second)
-            retVal->Set(context, n++, isolate->NewString(name)).IsJust();
+        exlib::string _name = name(m_map[i]);
+        if (name_set.insert(_name).second)
+            retVal->Set(context, n++, isolate->NewString(_name)).IsJust();
     }
 
     return 0;
@@ -16,6 +16,10 @@
 #include "version.h"
 #include "ifs/zlib.h"
 #include "ifs/console.h"
+#include "Metrics.h"
+#include "Timer.h"
+#include "ifs/Socket.h"
+#include "ifs/TLSSocket.h"
 
 namespace fibjs {
 
@@ -604,6 +608,10 @@ HttpHandler::HttpHandler()
     , m_maxHeaderSize(8192)
     , m_maxBodySize(64)
     , m_enableEncoding(false)
+    , m_headerTimeout(0)
+    , m_bodyTimeout(0)
+    , m_idleTimeout(0)
+    , m_handlerTimeout(0)
 {
     m_serverName = "fibjs/";
     m_serverName.append(fibjs_version);
@@ -618,7 +626,11 @@ result_t HttpHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
             : AsyncState(ac)
             , m_pThis(pThis)
             , m_stm(stm)
+            , m_start(0)
+            , m_deadline(0)
             , m_options(false)
+            , m_admitted(false)
+            , m_first(true)
         {
             m_stmBuffered = new BufferedStream(stm);
             m_stmBuffered->set_EOL("\r\n");
@@ -632,6 +644,62 @@ result_t HttpHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
             next(read);
         }
 
+        ~asyncInvoke()
+        {
+            disarm();
+            leave(Metric::now() - m_start);
+        }
+
+        virtual double deadline()
+        {
+            return m_deadline;
+        }
+
+        // one watchdog per connection phase, it closes the connection when
+        // the peer is too slow to finish the phase
+        void arm(int32_t timeout)
+        {
+            disarm();
+
+            if (timeout > 0) {
+                m_timer = new StreamTimer(timeout, m_stm);
+                m_timer->sleep();
+            }
+        }
+
+        void disarm()
+        {
+            if (m_timer) {
+                m_timer->clear();
+                m_timer.Release();
+            }
+        }
+
+        // read once per connection, and only when something is logged.
+        // HttpsServer hands over the TLSSocket on top of the socket.
+        exlib::string& remote()
+        {
+            if (m_remote.empty()) {
+                obj_ptr<Socket_base> sock = Socket_base::getInstance(m_stm);
+                obj_ptr<TLSSocket_base> tls;
+
+                if (sock)
+                    sock->get_remoteAddress(m_remote);
+                else if ((tls = TLSSocket_base::getInstance(m_stm)) != NULL)
+                    tls->get_remoteAddress(m_remote);
+            }
+
+            return m_remote;
+        }
+
+        void leave(int64_t latency)
+        {
+            if (m_admitted) {
+                m_admitted = false;
+                m_limiter->release(latency);
+            }
+        }
+
         ON_STATE(asyncInvoke, read)
         {
             bool bKeepAlive = false;
@@ -647,14 +715,36 @@ result_t HttpHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
             m_body.Release();
 
             m_req->clear();
-            return m_req->readFrom(m_stmBuffered, next(invoke));
+            m_deadline = 0;
+
+            if (m_first || m_pThis->m_idleTimeout <= 0)
+                return next(head);
+
+            arm(m_pThis->m_idleTimeout);
+            return m_stmBuffered->fill(next(head));
         }
 
-        ON_STATE(asyncInvoke, invoke)
+        ON_STATE(asyncInvoke, head)
         {
             if (n == CALL_RETURN_NULL)
                 return next(CALL_RETURN_NULL);
 
+            m_first = false;
+
+            arm(m_pThis->m_headerTimeout);
+            return m_req->readHead(m_stmBuffered, next(body));
+        }
+
+        ON_STATE(asyncInvoke, body)
+        {
+            arm(m_pThis->m_bodyTimeout);
+            return m_req->readBody(m_stmBuffered, next(invoke));
+        }
+
+        ON_STATE(asyncInvoke, invoke)
+        {
+            disarm();
+
             exlib::string str;
 
             m_req->get_protocol(str);
@@ -666,6 +756,30 @@ result_t HttpHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
             m_rep->set_keepAlive(bKeepAlive);
 
             m_d.now();
+            m_start = Metric::now();
+
+            if (m_pThis->m_handlerTimeout > 0)
+                m_deadline = m_d.date() + m_pThis->m_handlerTimeout;
+
+            m_limiter = m_pThis->m_limiter;
+            if (m_limiter)
+                return m_limiter->acquire(next(admit));
+
+            return next(admit);
+        }
+
+        ON_STATE(asyncInvoke, admit)
+        {
+            exlib::string str;
+
+            if (n == CALL_RETURN_NULL) {
+                m_rep->set_keepAlive(false);
+                m_rep->set_statusCode(503);
+                m_rep->setHeader("Retry-After", "1");
+                return next(send);
+            }
+
+            m_admitted = m_limiter != NULL;
 
             if (m_pThis->m_crossDomain) {
                 m_req->get_address(str);
@@ -781,6 +895,14 @@ result_t HttpHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
 
         ON_STATE(asyncInvoke, end)
         {
+            int64_t latency = Metric::now() - m_start;
+            metrics_http_server()->observe(latency);
+            leave(latency);
+
+            obj_ptr<AccessLog> log = m_pThis->accessLog();
+            if (log)
+                log->log(m_req, m_rep, remote(), m_d, latency);
+
             if (!m_body)
                 m_rep->get_body(m_body);
 
@@ -792,24 +914,32 @@ result_t HttpHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
 
         virtual int32_t error(int32_t v)
         {
-            if (at(invoke)) {
+            if (at(admit)) {
                 exlib::string err = getResultMessage(v);
 
                 m_req->set_lastError(err);
                 errorLog("HttpHandler: " + err);
 
-                m_rep->set_statusCode(500);
+                // the handler ran out of its time, most likely on a call that
+                // inherited the deadline
+                date_t d;
+                d.now();
+                m_rep->set_statusCode(m_deadline > 0 && d.date() >= m_deadline ? 504 : 500);
                 return 0;
             }
 
-            if (at(read)) {
-                if (v == CALL_E_CLOSED)
+            if (at(read) || at(head) || at(body)) {
+                bool timeout = m_timer && m_timer->fired();
+
+                disarm();
+                if (at(read) || timeout || v == CALL_E_CLOSED)
                     return next(CALL_RETURN_NULL);
 
                 m_rep->set_keepAlive(false);
                 m_rep->set_statusCode(400);
                 next(send);
                 m_d.now();
+                m_start = Metric::now();
                 return 0;
             }
 
@@ -819,13 +949,20 @@ result_t HttpHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
     private:
         obj_ptr<HttpHandler> m_pThis;
         obj_ptr<Stream_base> m_stm;
-        obj_ptr<BufferedStream_base> m_stmBuffered;
-        obj_ptr<HttpRequest_base> m_req;
+        obj_ptr<BufferedStream> m_stmBuffered;
+        obj_ptr<HttpRequest> m_req;
         obj_ptr<HttpResponse_base> m_rep;
         obj_ptr<MemoryStream> m_zip;
         obj_ptr<SeekableStream_base> m_body;
+        exlib::string m_remote;
         date_t m_d;
+        int64_t m_start;
+        double m_deadline;
+        obj_ptr<StreamTimer> m_timer;
+        obj_ptr<ConcurrencyLimiter> m_limiter;
         bool m_options;
+        bool m_admitted;
+        bool m_first;
     };
 
     if (ac->isSync())
@@ -851,6 +988,59 @@ result_t HttpHandler::enableCrossOrigin(exlib::string allowHeaders)
     return 0;
 }
 
+// the log is swapped from script while connections read it on I/O fibers,
+// the old one is released outside the lock
+obj_ptr<AccessLog> HttpHandler::accessLog()
+{
+    m_accessLogLock.lock();
+    obj_ptr<AccessLog> log = m_accessLog;
+    m_accessLogLock.unlock();
+
+    return log;
+}
+
+void HttpHandler::setAccessLog(AccessLog* log)
+{
+    obj_ptr<AccessLog> old;
+
+    m_accessLogLock.lock();
+    old = m_accessLog;
+    m_accessLog = log;
+    m_accessLogLock.unlock();
+}
+
+result_t HttpHandler::enableAccessLog(v8::Local<v8::Object> opts)
+{
+    obj_ptr<AccessLog> log;
+    result_t hr = AccessLog::create(opts, log);
+    if (hr < 0)
+        return hr;
+
+    setAccessLog(log);
+    return 0;
+}
+
+result_t HttpHandler::disableAccessLog()
+{
+    setAccessLog(NULL);
+    return 0;
+}
+
+result_t HttpHandler::limitConcurrency(v8::Local<v8::Object> opts)
+{
+    return ConcurrencyLimiter::create(opts, m_limiter);
+}
+
+result_t HttpHandler::get_loadStats(v8::Local<v8::Object>& retVal)
+{
+    obj_ptr<ConcurrencyLimiter> limiter = m_limiter;
+    if (!limiter)
+        return CALL_RETURN_NULL;
+
+    limiter->stats(holder(), retVal);
+    return 0;
+}
+
 result_t HttpHandler::get_maxHeadersCount(int32_t& retVal)
 {
     retVal = m_maxHeadersCount;
@@ -917,6 +1107,66 @@ result_t HttpHandler::set_serverName(exlib::string newVal)
     return 0;
 }
 
+result_t HttpHandler::get_headerTimeout(int32_t& retVal)
+{
+    retVal = m_headerTimeout;
+    return 0;
+}
+
+result_t HttpHandler::set_headerTimeout(int32_t newVal)
+{
+    if (newVal < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    m_headerTimeout = newVal;
+    return 0;
+}
+
+result_t HttpHandler::get_bodyTimeout(int32_t& retVal)
+{
+    retVal = m_bodyTimeout;
+    return 0;
+}
+
+result_t HttpHandler::set_bodyTimeout(int32_t newVal)
+{
+    if (newVal < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    m_bodyTimeout = newVal;
+    return 0;
+}
+
+result_t HttpHandler::get_idleTimeout(int32_t& retVal)
+{
+    retVal = m_idleTimeout;
+    return 0;
+}
+
+result_t HttpHandler::set_idleTimeout(int32_t newVal)
+{
+    if (newVal < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    m_idleTimeout = newVal;
+    return 0;
+}
+
+result_t HttpHandler::get_handlerTimeout(int32_t& retVal)
+{
+    retVal = m_handlerTimeout;
+    return 0;
+}
+
+result_t HttpHandler::set_handlerTimeout(int32_t newVal)
+{
+    if (newVal < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    m_handlerTimeout = newVal;
+    return 0;
+}
+
 result_t HttpHandler::get_handler(obj_ptr<Handler_base>& retVal)
 {
     retVal = m_hdlr;
@@ -8,6 +8,7 @@
 #include "object.h"
 #include "HttpMessage.h"
 #include "parse.h"
+#include "http_parser.h"
 #include "Buffer.h"
 #include <string.h>
 
@@ -185,69 +186,116 @@ result_t HttpMessage::sendHeader(Stream_base* stm, exlib::string& strCommand,
     return (new asyncSendTo(this, stm, strCommand, ac, true))->post(0);
 }
 
+result_t HttpMessage::readHead(BufferedStream_base* stm, AsyncEvent* ac)
+{
+    int32_t maxlen = -1;
+
+    stm->get_EOL(m_headEol);
+    if (m_maxHeaderSize > 0) {
+        int64_t sz = (int64_t)m_maxHeaderSize * ((int64_t)m_maxHeadersCount + 2);
+        maxlen = sz > INT32_MAX ? INT32_MAX : (int32_t)sz;
+    }
+
+    m_headPos = 0;
+    return stm->readUntil(m_headEol + m_headEol, maxlen, m_headers->reset_raw(), ac);
+}
+
+result_t HttpMessage::readStartLine(exlib::string& retVal)
+{
+    const exlib::string& head = m_headers->raw();
+    int32_t pos = m_headPos;
+    int32_t end;
+
+    http_next_line(head.c_str(), pos, (int32_t)head.length(), m_headEol, end, m_headPos);
+    if (m_maxHeaderSize > 0 && end - pos > m_maxHeaderSize)
+        return CHECK_ERROR(Runtime::setError("HttpMessage: header is too long."));
+
+    retVal.assign(head.c_str() + pos, end - pos);
+    return 0;
+}
+
+result_t HttpMessage::readHeaders(int64_t& contentLength, bool& bChunked)
+{
+    static const uint32_t s_content_length = http_name_hash("content-length", 14);
+    static const uint32_t s_transfer_encoding = http_name_hash("transfer-encoding", 17);
+    static const uint32_t s_connection = http_name_hash("connection", 10);
+
+    const exlib::string& head = m_headers->raw();
+    const char* buf = head.c_str();
+    int32_t len = (int32_t)head.length();
+    int32_t pos = m_headPos;
+    int32_t headCount = 0;
+
+    contentLength = -1;
+    bChunked = false;
+
+    while (pos < len) {
+        int32_t end, next;
+        int32_t name_len, value, value_len;
+
+        http_next_line(buf, pos, len, m_headEol, end, next);
+        if (m_maxHeaderSize > 0 && end - pos > m_maxHeaderSize)
+            return CHECK_ERROR(Runtime::setError("HttpMessage: header is too long."));
+
+        if (!http_split_header(buf, pos, end, name_len, value, value_len))
+            return CHECK_ERROR(Runtime::setError("HttpMessage: bad header: " + exlib::string(buf + pos, end - pos)));
+
+        const char* name = buf + pos;
+        uint32_t hash = http_name_hash(name, name_len);
+
+        if (name_len == 14 && hash == s_content_length && !qstricmp(name, "content-length", 14)) {
+            contentLength = atoi(buf + value);
+
+            if ((contentLength < 0)
+                || (m_maxBodySize >= 0
+                    && contentLength > (int64_t)m_maxBodySize * 1024 * 1024))
+                return CHECK_ERROR(Runtime::setError("HttpMessage: body is too huge."));
+
+            if (m_bNoBody) {
+                m_headers->add_view(pos, name_len, value, value_len);
+                headCount++;
+            }
+        } else if (name_len == 17 && hash == s_transfer_encoding && !qstricmp(name, "transfer-encoding", 17)) {
+            if (value_len != 7 || qstricmp(buf + value, "chunked", 7))
+                return CHECK_ERROR(Runtime::setError("HttpMessage: unknown transfer-encoding."));
+
+            bChunked = true;
+        } else if (name_len == 10 && hash == s_connection && !qstricmp(name, "connection", 10)) {
+            exlib::string v(buf + value, value_len);
+            addHeader(name, name_len, v.c_str(), value_len);
+            headCount++;
+        } else {
+            m_headers->add_view(pos, name_len, value, value_len);
+            headCount++;
+        }
+
+        if (headCount > m_maxHeadersCount)
+            return CHECK_ERROR(Runtime::setError("HttpMessage: too many headers."));
+
+        pos = next;
+    }
+
+    m_headPos = pos;
+    return 0;
+}
+
 result_t HttpMessage::readFrom(Stream_base* stm, AsyncEvent* ac)
 {
     class asyncReadFrom : public AsyncState {
     public:
         asyncReadFrom(HttpMessage* pThis, BufferedStream_base* stm,
-            AsyncEvent* ac)
+            int64_t contentLength, bool bChunked, AsyncEvent* ac)
             : AsyncState(ac)
             , m_pThis(pThis)
             , m_stm(stm)
-            , m_contentLength(-1)
-            , m_bChunked(false)
-            , m_headCount(0)
-        {
-            next(begin);
-        }
-
-        ON_STATE(asyncReadFrom, begin)
+            , m_contentLength(contentLength)
+            , m_bChunked(bChunked)
         {
-            return m_stm->readLine(m_pThis->m_maxHeaderSize, m_strLine, next(header));
+            next(header);
         }
 
         ON_STATE(asyncReadFrom, header)
         {
-            if (m_strLine.length() > 0) {
-                if (!qstricmp(m_strLine.c_str(), "content-length:", 15)) {
-                    m_contentLength = atoi(m_strLine.c_str() + 15);
-
-                    if ((m_contentLength < 0)
-                        || (m_pThis->m_maxBodySize >= 0
-                            && m_contentLength > (int64_t)m_pThis->m_maxBodySize * 1024 * 1024))
-                        return CHECK_ERROR(Runtime::setError("HttpMessage: body is too huge."));
-
-                    if (m_pThis->m_bNoBody) {
-                        result_t hr = m_pThis->addHeader(m_strLine);
-                        if (hr < 0)
-                            return hr;
-
-                        m_headCount++;
-                    }
-                } else if (!qstricmp(m_strLine.c_str(),
-                               "transfer-encoding:", 18)) {
-                    _parser p(m_strLine.c_str() + 18,
-                        (int32_t)m_strLine.length() - 18);
-
-                    p.skipSpace();
-                    if (qstricmp(p.now(), "chunked"))
-                        return CHECK_ERROR(Runtime::setError("HttpMessage: unknown transfer-encoding."));
-
-                    m_bChunked = true;
-                } else {
-                    result_t hr = m_pThis->addHeader(m_strLine);
-                    if (hr < 0)
-                        return hr;
-
-                    m_headCount++;
-                }
-
-                if (m_headCount > m_pThis->m_maxHeadersCount)
-                    return CHECK_ERROR(Runtime::setError("HttpMessage: too many headers."));
-
-                return m_stm->readLine(m_pThis->m_maxHeaderSize, m_strLine, this);
-            }
-
             if (m_bChunked) {
                 if (m_pThis->m_maxBodySize == 0)
                     return next();
@@ -327,7 +375,6 @@ result_t HttpMessage::readFrom(Stream_base* stm, AsyncEvent* ac)
         exlib::string m_strLine;
         int64_t m_contentLength;
         bool m_bChunked;
-        int32_t m_headCount;
         int64_t m_copySize;
     };
 
@@ -338,10 +385,16 @@ result_t HttpMessage::readFrom(Stream_base* stm, AsyncEvent* ac)
     if (!_stm)
         return CHECK_ERROR(Runtime::setError("HttpMessage: only accept BufferedStream object."));
 
+    int64_t contentLength;
+    bool bChunked;
+    result_t hr = readHeaders(contentLength, bChunked);
+    if (hr < 0)
+        return hr;
+
     _stm->get_stream(m_socket);
     m_stm = _stm;
 
-    return (new asyncReadFrom(this, _stm, ac))->post(0);
+    return (new asyncReadFrom(this, _stm, contentLength, bChunked, ac))->post(0);
 }
 
 void HttpMessage::addHeader(const char* name, int32_t szName, const char* value,
@@ -623,6 +676,7 @@ result_t HttpMessage::clear()
     m_encoding.clear();
 
     m_headers->clear();
+    m_headPos = 0;
 
     m_stm.Release();
     m_socket.Release();
@@ -288,21 +288,37 @@ result_t HttpRequest::sendTo(Stream_base* stm, AsyncEvent* ac)
 }
 
 result_t HttpRequest::readFrom(Stream_base* stm, AsyncEvent* ac)
+{
+    return readFrom(stm, false, ac);
+}
+
+result_t HttpRequest::readHead(Stream_base* stm, AsyncEvent* ac)
+{
+    return readFrom(stm, true, ac);
+}
+
+result_t HttpRequest::readBody(Stream_base* stm, AsyncEvent* ac)
+{
+    return m_message->readFrom(stm, ac);
+}
+
+result_t HttpRequest::readFrom(Stream_base* stm, bool headOnly, AsyncEvent* ac)
 {
     class asyncReadFrom : public AsyncState {
     public:
         asyncReadFrom(HttpRequest* pThis, BufferedStream_base* stm,
-            AsyncEvent* ac)
+            bool headOnly, AsyncEvent* ac)
             : AsyncState(ac)
             , m_pThis(pThis)
             , m_stm(stm)
+            , m_headOnly(headOnly)
         {
             next(begin);
         }
 
         ON_STATE(asyncReadFrom, begin)
         {
-            return m_stm->readLine(m_pThis->m_message->m_maxHeaderSize, m_strLine, next(command));
+            return m_pThis->m_message->readHead(m_stm, next(command));
         }
 
         ON_STATE(asyncReadFrom, command)
@@ -310,8 +326,11 @@ result_t HttpRequest::readFrom(Stream_base* stm, AsyncEvent* ac)
             if (n == CALL_RETURN_NULL)
                 return CHECK_ERROR(CALL_E_CLOSED);
 
+            result_t hr = m_pThis->m_message->readStartLine(m_strLine);
+            if (hr < 0)
+                return hr;
+
             _parser p(m_strLine);
-            result_t hr;
 
             if (!p.getWord(m_pThis->m_method))
                 return CHECK_ERROR(Runtime::setError("HttpRequest: bad method."));
@@ -342,6 +361,9 @@ result_t HttpRequest::readFrom(Stream_base* stm, AsyncEvent* ac)
             if (hr < 0)
                 return hr;
 
+            if (m_headOnly)
+                return next();
+
             return m_pThis->m_message->readFrom(m_stm, next());
         }
 
@@ -349,6 +371,7 @@ result_t HttpRequest::readFrom(Stream_base* stm, AsyncEvent* ac)
         obj_ptr<HttpRequest> m_pThis;
         obj_ptr<BufferedStream_base> m_stm;
         exlib::string m_strLine;
+        bool m_headOnly;
     };
 
     if (ac->isSync())
@@ -358,7 +381,7 @@ result_t HttpRequest::readFrom(Stream_base* stm, AsyncEvent* ac)
     if (!_stm)
         return CHECK_ERROR(Runtime::setError("HttpRequest: only accept BufferedStream object."));
 
-    return (new asyncReadFrom(this, _stm, ac))->post(0);
+    return (new asyncReadFrom(this, _stm, headOnly, ac))->post(0);
 }
 
 result_t HttpRequest::get_method(exlib::string& retVal)
@@ -390,7 +390,7 @@ result_t HttpResponse::readFrom(Stream_base* stm, AsyncEvent* ac)
 
         ON_STATE(asyncReadFrom, begin)
         {
-            return m_stm->readLine(m_pThis->m_message->m_maxHeaderSize, m_strLine, next(command));
+            return m_pThis->m_message->readHead(m_stm, next(command));
         }
 
         ON_STATE(asyncReadFrom, command)
@@ -398,7 +398,10 @@ result_t HttpResponse::readFrom(Stream_base* stm, AsyncEvent* ac)
             if (n == CALL_RETURN_NULL)
                 return CHECK_ERROR(CALL_E_CLOSED);
 
-            result_t hr;
+            result_t hr = m_pThis->m_message->readStartLine(m_strLine);
+            if (hr < 0)
+                return hr;
+
             const char* c_str = m_strLine.c_str();
             int32_t len = (int32_t)m_strLine.length();
 
@@ -79,6 +79,21 @@ result_t HttpServer::get_socket(obj_ptr<Socket_base>& retVal)
     return m_server->get_socket(retVal);
 }
 
+result_t HttpServer::get_maxConnections(int32_t& retVal)
+{
+    return m_server->get_maxConnections(retVal);
+}
+
+result_t HttpServer::set_maxConnections(int32_t newVal)
+{
+    return m_server->set_maxConnections(newVal);
+}
+
+result_t HttpServer::get_connections(int32_t& retVal)
+{
+    return m_server->get_connections(retVal);
+}
+
 result_t HttpServer::get_handler(obj_ptr<Handler_base>& retVal)
 {
     return m_hdlr->get_handler(retVal);
@@ -94,6 +109,21 @@ result_t HttpServer::enableCrossOrigin(exlib::string allowHeaders)
     return m_hdlr->enableCrossOrigin(allowHeaders);
 }
 
+result_t HttpServer::enableAccessLog(v8::Local<v8::Object> opts)
+{
+    return m_hdlr->enableAccessLog(opts);
+}
+
+result_t HttpServer::disableAccessLog()
+{
+    return m_hdlr->disableAccessLog();
+}
+
+result_t HttpServer::limitConcurrency(v8::Local<v8::Object> opts)
+{
+    return m_hdlr->limitConcurrency(opts);
+}
+
 result_t HttpServer::get_maxHeadersCount(int32_t& retVal)
 {
     return m_hdlr->get_maxHeadersCount(retVal);
@@ -144,4 +174,49 @@ result_t HttpServer::set_serverName(exlib::string newVal)
     return m_hdlr->set_serverName(newVal);
 }
 
+result_t HttpServer::get_headerTimeout(int32_t& retVal)
+{
+    return m_hdlr->get_headerTimeout(retVal);
+}
+
+result_t HttpServer::set_headerTimeout(int32_t newVal)
+{
+    return m_hdlr->set_headerTimeout(newVal);
+}
+
+result_t HttpServer::get_bodyTimeout(int32_t& retVal)
+{
+    return m_hdlr->get_bodyTimeout(retVal);
+}
+
+result_t HttpServer::set_bodyTimeout(int32_t newVal)
+{
+    return m_hdlr->set_bodyTimeout(newVal);
+}
+
+result_t HttpServer::get_idleTimeout(int32_t& retVal)
+{
+    return m_hdlr->get_idleTimeout(retVal);
+}
+
+result_t HttpServer::set_idleTimeout(int32_t newVal)
+{
+    return m_hdlr->set_idleTimeout(newVal);
+}
+
+result_t HttpServer::get_handlerTimeout(int32_t& retVal)
+{
+    return m_hdlr->get_handlerTimeout(retVal);
+}
+
+result_t HttpServer::set_handlerTimeout(int32_t newVal)
+{
+    return m_hdlr->set_handlerTimeout(newVal);
+}
+
+result_t HttpServer::get_loadStats(v8::Local<v8::Object>& retVal)
+{
+    return m_hdlr->get_loadStats(retVal);
+}
+
 } /* namespace fibjs */
@@ -94,6 +94,21 @@ result_t HttpsServer::get_socket(obj_ptr<Socket_base>& retVal)
     return m_server->get_socket(retVal);
 }
 
+result_t HttpsServer::get_maxConnections(int32_t& retVal)
+{
+    return m_server->get_maxConnections(retVal);
+}
+
+result_t HttpsServer::set_maxConnections(int32_t newVal)
+{
+    return m_server->set_maxConnections(newVal);
+}
+
+result_t HttpsServer::get_connections(int32_t& retVal)
+{
+    return m_server->get_connections(retVal);
+}
+
 result_t HttpsServer::get_handler(obj_ptr<Handler_base>& retVal)
 {
     return m_handler->get_handler(retVal);
@@ -109,6 +124,21 @@ result_t HttpsServer::enableCrossOrigin(exlib::string allowHeaders)
     return m_handler->enableCrossOrigin(allowHeaders);
 }
 
+result_t HttpsServer::enableAccessLog(v8::Local<v8::Object> opts)
+{
+    return m_handler->enableAccessLog(opts);
+}
+
+result_t HttpsServer::disableAccessLog()
+{
+    return m_handler->disableAccessLog();
+}
+
+result_t HttpsServer::limitConcurrency(v8::Local<v8::Object> opts)
+{
+    return m_handler->limitConcurrency(opts);
+}
+
 result_t HttpsServer::get_maxHeadersCount(int32_t& retVal)
 {
     return m_handler->get_maxHeadersCount(retVal);
@@ -159,4 +189,49 @@ result_t HttpsServer::set_serverName(exlib::string newVal)
     return m_handler->set_serverName(newVal);
 }
 
+result_t HttpsServer::get_headerTimeout(int32_t& retVal)
+{
+    return m_handler->get_headerTimeout(retVal);
+}
+
+result_t HttpsServer::set_headerTimeout(int32_t newVal)
+{
+    return m_handler->set_headerTimeout(newVal);
+}
+
+result_t HttpsServer::get_bodyTimeout(int32_t& retVal)
+{
+    return m_handler->get_bodyTimeout(retVal);
+}
+
+result_t HttpsServer::set_bodyTimeout(int32_t newVal)
+{
+    return m_handler->set_bodyTimeout(newVal);
+}
+
+result_t HttpsServer::get_idleTimeout(int32_t& retVal)
+{
+    return m_handler->get_idleTimeout(retVal);
+}
+
+result_t HttpsServer::set_idleTimeout(int32_t newVal)
+{
+    return m_handler->set_idleTimeout(newVal);
+}
+
+result_t HttpsServer::get_handlerTimeout(int32_t& retVal)
+{
+    return m_handler->get_handlerTimeout(retVal);
+}
+
+result_t HttpsServer::set_handlerTimeout(int32_t newVal)
+{
+    return m_handler->set_handlerTimeout(newVal);
+}
+
+result_t HttpsServer::get_loadStats(v8::Local<v8::Object>& retVal)
+{
+    return m_handler->get_loadStats(retVal);
+}
+
 } /* namespace fibjs */
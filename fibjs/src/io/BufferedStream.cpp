@@ -9,6 +9,7 @@
 #include "ifs/io.h"
 #include "BufferedStream.h"
 #include "Buffer.h"
+#include <string.h>
 
 namespace fibjs {
 
@@ -286,13 +287,15 @@ result_t BufferedStream::readUntil(exlib::string mk, int32_t maxlen,
             while ((pos < (int32_t)pThis->m_buf.length())
                 && (pThis->m_temp < mklen)) {
                 if (pThis->m_temp == 0) {
-                    char ch = mk.c_str()[0];
+                    const char* buf = pThis->m_buf.c_str();
+                    const char* p = (const char*)memchr(buf + pos, mk.c_str()[0],
+                        pThis->m_buf.length() - pos);
 
-                    while (pos < (int32_t)pThis->m_buf.length())
-                        if (pThis->m_buf.c_str()[pos++] == ch) {
-                            pThis->m_temp++;
-                            break;
-                        }
+                    if (p) {
+                        pos = (int32_t)(p - buf) + 1;
+                        pThis->m_temp++;
+                    } else
+                        pos = (int32_t)pThis->m_buf.length();
                 }
 
                 if (pThis->m_temp > 0) {
@@ -355,6 +358,33 @@ result_t BufferedStream::readUntil(exlib::string mk, int32_t maxlen,
     return (new asyncRead(this, mk, maxlen, retVal, ac))->post(0);
 }
 
+result_t BufferedStream::fill(AsyncEvent* ac)
+{
+    class asyncFill : public asyncBuffer {
+    public:
+        asyncFill(BufferedStream* pThis, AsyncEvent* ac)
+            : asyncBuffer(pThis, ac)
+        {
+        }
+
+        virtual result_t process(bool streamEnd)
+        {
+            if (m_pThis->m_pos < (int32_t)m_pThis->m_buf.length())
+                return 0;
+
+            return streamEnd ? CALL_RETURN_NULL : CALL_E_PENDDING;
+        }
+    };
+
+    if (m_pos < (int32_t)m_buf.length())
+        return 0;
+
+    if (ac->isSync())
+        return CHECK_ERROR(CALL_E_NOSYNC);
+
+    return (new asyncFill(this, ac))->post(0);
+}
+
 result_t BufferedStream::writeText(exlib::string txt, AsyncEvent* ac)
 {
     if (ac->isSync())
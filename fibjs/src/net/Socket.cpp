@@ -28,6 +28,8 @@ result_t Socket_base::_new(int32_t family, obj_ptr<Socket_base>& retVal,
 
 Socket::~Socket()
 {
+    metrics_sockets()->dec();
+
     if (m_aio.m_fd != INVALID_SOCKET)
         asyncCall(::closesocket, m_aio.m_fd);
 }
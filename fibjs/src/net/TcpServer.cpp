@@ -9,6 +9,7 @@
 #include "TcpServer.h"
 #include "ifs/mq.h"
 #include "ifs/console.h"
+#include "Metrics.h"
 
 namespace fibjs {
 
@@ -54,6 +55,7 @@ result_t TcpServer_base::_new(exlib::string addr, Handler_base* listener,
 TcpServer::TcpServer()
 {
     m_running = false;
+    m_maxConnections = 0;
 }
 
 result_t TcpServer::create(exlib::string addr, int32_t port,
@@ -99,9 +101,15 @@ result_t TcpServer::start()
             , m_sock(pSock)
             , m_holder(holder)
         {
+            m_pThis->m_connections.inc();
             next(invoke);
         }
 
+        ~asyncInvoke()
+        {
+            m_pThis->m_connections.dec();
+        }
+
     public:
         ON_STATE(asyncInvoke, invoke)
         {
@@ -151,7 +159,13 @@ result_t TcpServer::start()
         ON_STATE(asyncAccept, invoke)
         {
             if (m_accept) {
-                (new asyncInvoke(m_pThis, m_accept, m_holder))->apost(0);
+                // over the limit the connection is closed before any fiber
+                // is spent on it, the peer gets an early close, not a slow reply
+                int32_t max = m_pThis->m_maxConnections;
+                if (max > 0 && m_pThis->m_connections.value() >= max)
+                    metrics_rejected_connections()->inc();
+                else
+                    (new asyncInvoke(m_pThis, m_accept, m_holder))->apost(0);
                 m_accept.Release();
             }
 
@@ -219,4 +233,25 @@ result_t TcpServer::set_handler(Handler_base* newVal)
     return 0;
 }
 
+result_t TcpServer::get_maxConnections(int32_t& retVal)
+{
+    retVal = m_maxConnections;
+    return 0;
+}
+
+result_t TcpServer::set_maxConnections(int32_t newVal)
+{
+    if (newVal < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    m_maxConnections = newVal;
+    return 0;
+}
+
+result_t TcpServer::get_connections(int32_t& retVal)
+{
+    retVal = (int32_t)m_connections.value();
+    return 0;
+}
+
 } /* namespace fibjs */
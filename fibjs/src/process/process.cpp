@@ -18,6 +18,8 @@
 #include "ChildProcess.h"
 #include <vector>
 #include "options.h"
+#include "ResolveCache.h"
+#include "SandBox.h"
 
 #ifdef _WIN32
 #include <psapi.h>
@@ -276,6 +278,10 @@ result_t process_base::exit()
     t._emit("exit", &v, 1, r);
 
     flushLog();
+    ResolveCache::save();
+
+    if (g_trace_builtins && isolate->m_id == 1)
+        SandBox::traceBuiltins(isolate);
 
     if (g_cov != nullptr && isolate->m_id == 1) {
         WriteLcovData(isolate->m_isolate, g_cov);
@@ -0,0 +1,738 @@
+/*
+ * metrics.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "Metrics.h"
+#include "ifs/HttpRequest.h"
+#include "ifs/HttpResponse.h"
+#include "MemoryStream.h"
+#include "TLSSessionCache.h"
+#include "WebSocketDeflate.h"
+#include <math.h>
+#include <map>
+
+namespace fibjs {
+
+DECLARE_MODULE(metrics);
+
+void acPoolStats(bool longsync, int32_t& pending, int32_t& workers);
+
+class MetricFamily {
+public:
+    int32_t m_type;
+    exlib::string m_help;
+    std::map<exlib::string, obj_ptr<Metric>> m_series;
+};
+
+static exlib::spinlock s_lock;
+static std::map<exlib::string, MetricFamily>& s_families = *new std::map<exlib::string, MetricFamily>();
+
+static const char* s_types[] = { "counter", "gauge", "histogram" };
+
+static const double s_defaultBounds[] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000,
+    100000, 200000, 500000, 1000000, 2000000, 5000000, 10000000
+};
+
+static void append_number(exlib::string& out, double v)
+{
+    if (isnan(v))
+        out.append("NaN");
+    else if (isinf(v))
+        out.append(v > 0 ? "+Inf" : "-Inf");
+    else {
+        char buf[64];
+        int32_t n = snprintf(buf, sizeof(buf), "%.15g", v);
+        out.append(buf, n);
+    }
+}
+
+static void append_sample(exlib::string& out, const exlib::string& name, const char* suffix,
+    const exlib::string& labels, const char* extra, double v)
+{
+    out.append(name);
+    out.append(suffix);
+
+    if (!labels.empty() || extra) {
+        out.append(1, '{');
+        out.append(labels);
+        if (extra) {
+            if (!labels.empty())
+                out.append(1, ',');
+            out.append(extra);
+        }
+        out.append(1, '}');
+    }
+
+    out.append(1, ' ');
+    append_number(out, v);
+    out.append(1, '\n');
+}
+
+static bool valid_name(const exlib::string& name, bool label)
+{
+    const char* s = name.c_str();
+
+    if (!*s || qisdigit(*s))
+        return false;
+
+    for (; *s; s++)
+        if (!(qisdigit(*s) || qisupper(*s) || qislower(*s) || *s == '_' || (!label && *s == ':')))
+            return false;
+
+    return true;
+}
+
+static result_t render_labels(v8::Local<v8::Object> labels, exlib::string& retVal)
+{
+    Isolate* isolate = Isolate::current();
+    v8::Local<v8::Context> context = isolate->context();
+    JSArray ks = labels->GetPropertyNames(context);
+    int32_t len = ks->Length();
+    std::map<exlib::string, exlib::string> pairs;
+
+    for (int32_t i = 0; i < len; i++) {
+        JSValue k = ks->Get(context, i);
+        JSValue v = labels->Get(context, k);
+        if (v.IsEmpty())
+            return CALL_E_JAVASCRIPT;
+
+        exlib::string key = isolate->toString(k);
+        if (!valid_name(key, true) || !qstrcmp(key.c_str(), "__", 2))
+            return CHECK_ERROR(Runtime::setError("metrics: invalid label name '" + key + "'."));
+
+        pairs[key] = isolate->toString(v);
+    }
+
+    retVal.clear();
+    for (auto& it : pairs) {
+        if (!retVal.empty())
+            retVal.append(1, ',');
+
+        retVal.append(it.first);
+        retVal.append("=\"", 2);
+        for (const char* s = it.second.c_str(); *s; s++) {
+            if (*s == '\\')
+                retVal.append("\\\\", 2);
+            else if (*s == '"')
+                retVal.append("\\\"", 2);
+            else if (*s == '\n')
+                retVal.append("\\n", 2);
+            else
+                retVal.append(1, *s);
+        }
+        retVal.append(1, '"');
+    }
+
+    return 0;
+}
+
+template <typename T, typename F>
+static result_t find_metric(int32_t type, exlib::string name, exlib::string help,
+    exlib::string labels, F create, obj_ptr<T>& retVal)
+{
+    if (!valid_name(name, false))
+        return CHECK_ERROR(Runtime::setError("metrics: invalid metric name '" + name + "'."));
+
+    // counters are exposed as <name>_total, the family itself has no suffix
+    if (type == Metric::kCounter && name.length() > 6 && !qstrcmp(name.c_str() + name.length() - 6, "_total"))
+        name.resize(name.length() - 6);
+
+    s_lock.lock();
+
+    MetricFamily& family = s_families[name];
+    if (family.m_series.empty()) {
+        family.m_type = type;
+        family.m_help = help;
+    } else if (family.m_type != type) {
+        s_lock.unlock();
+        return CHECK_ERROR(Runtime::setError("metrics: '" + name + "' is already registered as a "
+            + s_types[family.m_type] + "."));
+    } else if (family.m_help.empty())
+        family.m_help = help;
+
+    obj_ptr<Metric>& m = family.m_series[labels];
+    if (!m)
+        m = create(name, labels);
+    retVal = (T*)(Metric*)m;
+
+    s_lock.unlock();
+
+    return 0;
+}
+
+CounterMetric* metrics_counter(exlib::string name, exlib::string help, exlib::string labels)
+{
+    obj_ptr<CounterMetric> m;
+
+    find_metric(
+        Metric::kCounter, name, help, labels,
+        [](exlib::string& name, exlib::string& labels) -> Metric* {
+            return new CounterMetric(name, labels);
+        },
+        m);
+
+    return m;
+}
+
+GaugeMetric* metrics_gauge(exlib::string name, exlib::string help, exlib::string labels,
+    GaugeMetric::sampler fn)
+{
+    obj_ptr<GaugeMetric> m;
+
+    find_metric(
+        Metric::kGauge, name, help, labels,
+        [fn](exlib::string& name, exlib::string& labels) -> Metric* {
+            return new GaugeMetric(name, labels, fn);
+        },
+        m);
+
+    return m;
+}
+
+HistogramMetric* metrics_histogram(exlib::string name, exlib::string help, exlib::string labels)
+{
+    obj_ptr<HistogramMetric> m;
+
+    find_metric(
+        Metric::kHistogram, name, help, labels,
+        [](exlib::string& name, exlib::string& labels) -> Metric* {
+            std::vector<double> bounds(s_defaultBounds, s_defaultBounds + ARRAYSIZE(s_defaultBounds));
+            return new HistogramMetric(name, labels, bounds);
+        },
+        m);
+
+    return m;
+}
+
+HistogramMetric* metrics_http_server()
+{
+    static HistogramMetric* s_metric = metrics_histogram("fibjs_http_server_request_duration_microseconds",
+        "Time spent serving HTTP requests.");
+    return s_metric;
+}
+
+HistogramMetric* metrics_http_client()
+{
+    static HistogramMetric* s_metric = metrics_histogram("fibjs_http_client_request_duration_microseconds",
+        "Time spent on outgoing HTTP requests.");
+    return s_metric;
+}
+
+CounterMetric* metrics_http_client_errors()
+{
+    static CounterMetric* s_metric = metrics_counter("fibjs_http_client_errors",
+        "Outgoing HTTP requests that failed.");
+    return s_metric;
+}
+
+HistogramMetric* metrics_db_query()
+{
+    static HistogramMetric* s_metric = metrics_histogram("fibjs_db_query_duration_microseconds",
+        "Time spent executing database queries.");
+    return s_metric;
+}
+
+CounterMetric* metrics_db_errors()
+{
+    static CounterMetric* s_metric = metrics_counter("fibjs_db_query_errors",
+        "Database queries that failed.");
+    return s_metric;
+}
+
+CounterMetric* metrics_http_shed()
+{
+    static CounterMetric* s_metric = metrics_counter("fibjs_http_server_shed_requests",
+        "Requests answered with 503 by the HttpHandler concurrency limiter.");
+    return s_metric;
+}
+
+CounterMetric* metrics_rejected_connections()
+{
+    static CounterMetric* s_metric = metrics_counter("fibjs_net_rejected_connections",
+        "Connections closed because TcpServer.maxConnections was reached.");
+    return s_metric;
+}
+
+GaugeMetric* metrics_sockets()
+{
+    static GaugeMetric* s_metric = metrics_gauge("fibjs_net_sockets",
+        "Socket objects currently alive.");
+    return s_metric;
+}
+
+HistogramMetric* metrics_loop_lag()
+{
+    static HistogramMetric* s_metric = metrics_histogram("fibjs_event_loop_lag_microseconds",
+        "Time JavaScript jobs wait in the isolate queue before they run.");
+    return s_metric;
+}
+
+CounterMetric* metrics_tls_handshakes(bool resumed)
+{
+    static CounterMetric* s_full = metrics_counter("fibjs_tls_client_handshakes",
+        "Outgoing TLS handshakes, by whether a cached session was resumed.", "resumed=\"false\"");
+    static CounterMetric* s_resumed = metrics_counter("fibjs_tls_client_handshakes", "", "resumed=\"true\"");
+    return resumed ? s_resumed : s_full;
+}
+
+CounterMetric* metrics_tls_session_lookups(bool hit)
+{
+    static CounterMetric* s_miss = metrics_counter("fibjs_tls_session_cache_lookups",
+        "Lookups of the client TLS session cache.", "result=\"miss\"");
+    static CounterMetric* s_hit = metrics_counter("fibjs_tls_session_cache_lookups", "", "result=\"hit\"");
+    return hit ? s_hit : s_miss;
+}
+
+CounterMetric* metrics_ws_compress_fallbacks()
+{
+    static CounterMetric* s_metric = metrics_counter("fibjs_ws_compress_fallbacks",
+        "WebSocket messages compressed without context takeover because ws.compressMemoryLimit was reached.");
+    return s_metric;
+}
+
+static bool init_builtin()
+{
+    metrics_gauge("fibjs_async_pool_pending", "Tasks waiting for an async pool worker.",
+        "pool=\"async\"", []() -> double {
+            int32_t pending, workers;
+            acPoolStats(false, pending, workers);
+            return pending;
+        });
+    metrics_gauge("fibjs_async_pool_pending", "", "pool=\"longsync\"", []() -> double {
+        int32_t pending, workers;
+        acPoolStats(true, pending, workers);
+        return pending;
+    });
+    metrics_gauge("fibjs_async_pool_workers", "Workers of the async pools.",
+        "pool=\"async\"", []() -> double {
+            int32_t pending, workers;
+            acPoolStats(false, pending, workers);
+            return workers;
+        });
+    metrics_gauge("fibjs_async_pool_workers", "", "pool=\"longsync\"", []() -> double {
+        int32_t pending, workers;
+        acPoolStats(true, pending, workers);
+        return workers;
+    });
+    metrics_gauge("fibjs_js_jobs_pending", "JavaScript jobs queued on all isolates.", "",
+        []() -> double {
+            return g_pendingJobs.value();
+        });
+
+    metrics_http_server();
+    metrics_http_client();
+    metrics_http_client_errors();
+    metrics_db_query();
+    metrics_db_errors();
+    metrics_sockets();
+    metrics_http_shed();
+    metrics_rejected_connections();
+    metrics_loop_lag();
+
+    metrics_gauge("fibjs_tls_session_cache_entries", "Client TLS sessions kept for resumption.", "",
+        []() -> double {
+            return TLSSessionCache::current()->count();
+        });
+    metrics_tls_handshakes(false);
+    metrics_tls_handshakes(true);
+    metrics_tls_session_lookups(false);
+    metrics_tls_session_lookups(true);
+
+    metrics_gauge("fibjs_ws_compress_memory_bytes", "Memory held by WebSocket permessage-deflate state.",
+        "kind=\"deflate\"", []() -> double {
+            return WebSocketZlib::s_deflate_memory;
+        });
+    metrics_gauge("fibjs_ws_compress_memory_bytes", "", "kind=\"inflate\"", []() -> double {
+        return WebSocketZlib::s_inflate_memory;
+    });
+    metrics_gauge("fibjs_ws_compress_pooled_streams", "Idle zlib streams kept for WebSocket messages without context takeover.", "",
+        []() -> double {
+            return WebSocketZlib::s_pooled;
+        });
+    metrics_ws_compress_fallbacks();
+
+    return true;
+}
+
+void CounterMetric::collect(exlib::string& out)
+{
+    append_sample(out, m_name, "_total", m_labels, NULL, value());
+}
+
+void GaugeMetric::collect(exlib::string& out)
+{
+    append_sample(out, m_name, "", m_labels, NULL, value());
+}
+
+HistogramMetric::HistogramMetric(exlib::string name, exlib::string labels, std::vector<double>& bounds)
+    : Metric(kHistogram, name, labels)
+    , m_count(0)
+    , m_sum(0)
+    , m_max(0)
+    , m_bounds(bounds)
+{
+    for (int32_t i = 0; i < kBucketCount; i++)
+        m_counts[i].store(0, std::memory_order_relaxed);
+}
+
+void HistogramMetric::collect(exlib::string& out)
+{
+    std::vector<int64_t> counts(kBucketCount);
+    int64_t total = 0;
+    int32_t i;
+
+    for (i = 0; i < kBucketCount; i++) {
+        counts[i] = m_counts[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    // a bucket takes the values whose sub-bucket ends at or below its bound
+    int64_t cumulative = 0;
+    size_t b = 0;
+    char le[64];
+
+    for (i = 0; i < kBucketCount && b < m_bounds.size(); i++) {
+        while (b < m_bounds.size() && (double)upper(i) > m_bounds[b]) {
+            exlib::string n;
+            append_number(n, m_bounds[b]);
+            snprintf(le, sizeof(le), "le=\"%s\"", n.c_str());
+            append_sample(out, m_name, "_bucket", m_labels, le, (double)cumulative);
+            b++;
+        }
+
+        cumulative += counts[i];
+    }
+
+    for (; b < m_bounds.size(); b++) {
+        exlib::string n;
+        append_number(n, m_bounds[b]);
+        snprintf(le, sizeof(le), "le=\"%s\"", n.c_str());
+        append_sample(out, m_name, "_bucket", m_labels, le, (double)cumulative);
+    }
+
+    append_sample(out, m_name, "_bucket", m_labels, "le=\"+Inf\"", (double)total);
+    append_sample(out, m_name, "_count", m_labels, NULL, (double)total);
+    append_sample(out, m_name, "_sum", m_labels, NULL, sum());
+}
+
+double HistogramMetric::percentile(double p) const
+{
+    int64_t total = count();
+    if (total == 0)
+        return 0;
+
+    if (p < 0)
+        p = 0;
+    else if (p > 100)
+        p = 100;
+
+    int64_t target = (int64_t)ceil(p / 100 * (double)total);
+    if (target < 1)
+        target = 1;
+
+    int64_t cumulative = 0;
+    int64_t max = m_max.load(std::memory_order_relaxed);
+
+    for (int32_t i = 0; i < kBucketCount; i++) {
+        cumulative += m_counts[i].load(std::memory_order_relaxed);
+        if (cumulative >= target) {
+            int64_t v = upper(i);
+            return (double)(v < max ? v : max);
+        }
+    }
+
+    return (double)max;
+}
+
+result_t Counter::get_name(exlib::string& retVal)
+{
+    retVal = m_metric->m_name;
+    return 0;
+}
+
+result_t Counter::get_value(double& retVal)
+{
+    retVal = m_metric->value();
+    return 0;
+}
+
+result_t Counter::inc(double value)
+{
+    if (!(value >= 0))
+        return CHECK_ERROR(Runtime::setError("Counter: value must not be negative."));
+
+    m_metric->inc(value);
+    return 0;
+}
+
+result_t Gauge::get_name(exlib::string& retVal)
+{
+    retVal = m_metric->m_name;
+    return 0;
+}
+
+result_t Gauge::get_value(double& retVal)
+{
+    retVal = m_metric->value();
+    return 0;
+}
+
+result_t Gauge::set(double value)
+{
+    m_metric->set(value);
+    return 0;
+}
+
+result_t Gauge::inc(double value)
+{
+    m_metric->inc(value);
+    return 0;
+}
+
+result_t Gauge::dec(double value)
+{
+    m_metric->dec(value);
+    return 0;
+}
+
+result_t Histogram::get_name(exlib::string& retVal)
+{
+    retVal = m_metric->m_name;
+    return 0;
+}
+
+result_t Histogram::get_count(int64_t& retVal)
+{
+    retVal = m_metric->count();
+    return 0;
+}
+
+result_t Histogram::get_sum(double& retVal)
+{
+    retVal = m_metric->sum();
+    return 0;
+}
+
+result_t Histogram::observe(double value)
+{
+    if (isnan(value))
+        return CHECK_ERROR(CALL_E_INVALIDARG);
+
+    if (value >= (double)(1ll << HistogramMetric::kMaxBits))
+        value = (double)(1ll << HistogramMetric::kMaxBits);
+
+    m_metric->observe((int64_t)(value + 0.5));
+    return 0;
+}
+
+result_t Histogram::percentile(double p, double& retVal)
+{
+    retVal = m_metric->percentile(p);
+    return 0;
+}
+
+static result_t get_opts(exlib::string& name, v8::Local<v8::Object> opts, exlib::string& help,
+    exlib::string& labels)
+{
+    Isolate* isolate = Isolate::current();
+    result_t hr;
+
+    // the built-in series are used by native code, keep scripts away from them
+    if (!qstrcmp(name.c_str(), "fibjs_", 6))
+        return CHECK_ERROR(Runtime::setError("metrics: the 'fibjs_' prefix is reserved."));
+
+    hr = GetConfigValue(isolate, opts, "help", help, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    v8::Local<v8::Object> o;
+    hr = GetConfigValue(isolate, opts, "labels", o, true);
+    if (hr == CALL_E_PARAMNOTOPTIONAL)
+        return 0;
+    if (hr < 0)
+        return hr;
+
+    return render_labels(o, labels);
+}
+
+result_t metrics_base::counter(exlib::string name, v8::Local<v8::Object> opts, obj_ptr<Counter_base>& retVal)
+{
+    exlib::string help, labels;
+    result_t hr = get_opts(name, opts, help, labels);
+    if (hr < 0)
+        return hr;
+
+    obj_ptr<CounterMetric> m;
+    hr = find_metric(
+        Metric::kCounter, name, help, labels,
+        [](exlib::string& name, exlib::string& labels) -> Metric* {
+            return new CounterMetric(name, labels);
+        },
+        m);
+    if (hr < 0)
+        return hr;
+
+    retVal = new Counter(m);
+    return 0;
+}
+
+result_t metrics_base::gauge(exlib::string name, v8::Local<v8::Object> opts, obj_ptr<Gauge_base>& retVal)
+{
+    exlib::string help, labels;
+    result_t hr = get_opts(name, opts, help, labels);
+    if (hr < 0)
+        return hr;
+
+    obj_ptr<GaugeMetric> m;
+    hr = find_metric(
+        Metric::kGauge, name, help, labels,
+        [](exlib::string& name, exlib::string& labels) -> Metric* {
+            return new GaugeMetric(name, labels);
+        },
+        m);
+    if (hr < 0)
+        return hr;
+
+    retVal = new Gauge(m);
+    return 0;
+}
+
+result_t metrics_base::histogram(exlib::string name, v8::Local<v8::Object> opts, obj_ptr<Histogram_base>& retVal)
+{
+    Isolate* isolate = Isolate::current();
+    exlib::string help, labels;
+    result_t hr = get_opts(name, opts, help, labels);
+    if (hr < 0)
+        return hr;
+
+    std::vector<double> bounds;
+    v8::Local<v8::Array> a;
+    hr = GetConfigValue(isolate, opts, "buckets", a, true);
+    if (hr >= 0) {
+        v8::Local<v8::Context> context = isolate->context();
+        int32_t len = a->Length();
+
+        for (int32_t i = 0; i < len; i++) {
+            double v;
+            hr = GetArgumentValue(isolate, JSValue(a->Get(context, i)), v);
+            if (hr < 0)
+                return hr;
+            if (isnan(v) || (!bounds.empty() && v <= bounds.back()))
+                return CHECK_ERROR(Runtime::setError("metrics: buckets must be in increasing order."));
+
+            bounds.push_back(v);
+        }
+    } else if (hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+    else
+        bounds.assign(s_defaultBounds, s_defaultBounds + ARRAYSIZE(s_defaultBounds));
+
+    obj_ptr<HistogramMetric> m;
+    hr = find_metric(
+        Metric::kHistogram, name, help, labels,
+        [&bounds](exlib::string& name, exlib::string& labels) -> Metric* {
+            return new HistogramMetric(name, labels, bounds);
+        },
+        m);
+    if (hr < 0)
+        return hr;
+
+    retVal = new Histogram(m);
+    return 0;
+}
+
+result_t metrics_base::collect(exlib::string& retVal)
+{
+    static bool s_init = init_builtin();
+    (void)s_init;
+
+    std::vector<std::pair<exlib::string, std::vector<obj_ptr<Metric>>>> families;
+    std::vector<std::pair<int32_t, exlib::string>> infos;
+
+    // take references under the lock, format outside of it
+    s_lock.lock();
+    for (auto& it : s_families) {
+        std::vector<obj_ptr<Metric>> series;
+        for (auto& s : it.second.m_series)
+            series.push_back(s.second);
+
+        families.push_back(std::make_pair(it.first, series));
+        infos.push_back(std::make_pair(it.second.m_type, it.second.m_help));
+    }
+    s_lock.unlock();
+
+    exlib::string out;
+
+    for (size_t i = 0; i < families.size(); i++) {
+        out.append("# TYPE ");
+        out.append(families[i].first);
+        out.append(1, ' ');
+        out.append(s_types[infos[i].first]);
+        out.append(1, '\n');
+
+        if (!infos[i].second.empty()) {
+            out.append("# HELP ");
+            out.append(families[i].first);
+            out.append(1, ' ');
+            for (const char* s = infos[i].second.c_str(); *s; s++) {
+                if (*s == '\\')
+                    out.append("\\\\", 2);
+                else if (*s == '"')
+                    out.append("\\\"", 2);
+                else if (*s == '\n')
+                    out.append("\\n", 2);
+                else
+                    out.append(1, *s);
+            }
+            out.append(1, '\n');
+        }
+
+        for (auto& m : families[i].second)
+            m->collect(out);
+    }
+
+    out.append("# EOF\n");
+    retVal = out;
+
+    return 0;
+}
+
+class MetricsHandler : public Handler_base {
+    FIBER_FREE();
+
+public:
+    // Handler_base
+    virtual result_t invoke(object_base* v, obj_ptr<Handler_base>& retVal, AsyncEvent* ac)
+    {
+        obj_ptr<HttpRequest_base> req = HttpRequest_base::getInstance(v);
+        if (req == NULL)
+            return CHECK_ERROR(CALL_E_BADVARTYPE);
+
+        obj_ptr<HttpResponse_base> rep;
+        req->get_response(rep);
+
+        exlib::string text;
+        metrics_base::collect(text);
+
+        date_t d;
+        d.now();
+
+        rep->setHeader("Content-Type", "application/openmetrics-text; version=1.0.0; charset=utf-8");
+        rep->set_body(new MemoryStream::CloneStream(text, d));
+
+        return CALL_RETURN_NULL;
+    }
+};
+
+result_t metrics_base::handler(obj_ptr<Handler_base>& retVal)
+{
+    retVal = new MetricsHandler();
+    return 0;
+}
+
+} /* namespace fibjs */
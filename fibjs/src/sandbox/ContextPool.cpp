@@ -0,0 +1,156 @@
+/*
+ * ContextPool.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "ifs/vm.h"
+#include "ContextPool.h"
+#include "SandBox.h"
+#include "AsyncCall.h"
+
+namespace fibjs {
+
+void vm_get_global(v8::Local<v8::Object> obj, v8::Local<v8::Object>& retVal);
+
+result_t ContextPool_base::_new(v8::Local<v8::Object> opts, obj_ptr<ContextPool_base>& retVal,
+    v8::Local<v8::Object> This)
+{
+    Isolate* isolate = Isolate::current();
+    result_t hr;
+
+    int32_t size = 4;
+    hr = GetConfigValue(isolate, opts, "size", size, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+    if (size < 0)
+        return CHECK_ERROR(Runtime::setError("ContextPool: size must not be negative."));
+
+    obj_ptr<ContextPool> pool = new ContextPool(size);
+    pool->wrap(This);
+    pool->fill(size);
+
+    retVal = pool;
+
+    return 0;
+}
+
+// the same context vm.createContext makes, with an empty object for now
+v8::Local<v8::Object> ContextPool::create()
+{
+    Isolate* isolate = holder();
+    obj_ptr<SandBox> sbox = new SandBox();
+
+    sbox->initGlobal(v8::Object::New(isolate->m_isolate));
+    return sbox->GetPrivate("_global").As<v8::Object>();
+}
+
+void ContextPool::fill(int32_t count)
+{
+    Isolate* isolate = holder();
+
+    while (count-- > 0)
+        m_globals.emplace_back(isolate->m_isolate, create());
+}
+
+void ContextPool::refill()
+{
+    if (m_refilling || (int32_t)m_globals.size() >= m_size)
+        return;
+
+    m_refilling = true;
+    Ref();
+
+    // one context per job, so requests get to run in between
+    syncCall(
+        holder(), [](ContextPool* pool) {
+            pool->m_refilling = false;
+            pool->fill(1);
+            pool->refill();
+            pool->Unref();
+            return 0;
+        },
+        this);
+}
+
+result_t ContextPool::acquire(v8::Local<v8::Object> contextObject, v8::Local<v8::Object>& retVal)
+{
+    Isolate* isolate = holder();
+    v8::Local<v8::Object> _global;
+
+    vm_get_global(contextObject, _global);
+    if (!_global.IsEmpty())
+        return CHECK_ERROR(Runtime::setError("ContextPool: object is already a context."));
+
+    if (m_globals.empty())
+        _global = create();
+    else {
+        _global = m_globals.front().Get(isolate->m_isolate);
+        m_globals.pop_front();
+    }
+
+    refill();
+
+    v8::Local<v8::Context> _context = _global->GetCreationContextChecked();
+    v8::Context::Scope context_scope(_context);
+
+    _context->SetEmbedderData(kSandboxObject, contextObject);
+    _global->Set(_context, isolate->NewString("global"), _global).IsJust();
+    _global->Set(_context, isolate->NewString("globalThis"), _global).IsJust();
+
+    contextObject->SetPrivate(_context, v8::Private::ForApi(isolate->m_isolate, isolate->NewString("_global")), _global).IsJust();
+    contextObject->SetPrivate(_context, v8::Private::ForApi(isolate->m_isolate, isolate->NewString("_context_pool")), wrap()).IsJust();
+
+    retVal = contextObject;
+
+    return 0;
+}
+
+result_t ContextPool::release(v8::Local<v8::Object> contextObject)
+{
+    Isolate* isolate = holder();
+    v8::Local<v8::Context> context = isolate->context();
+    v8::Local<v8::Private> strPool = v8::Private::ForApi(isolate->m_isolate, isolate->NewString("_context_pool"));
+    v8::Local<v8::Private> strGlobal = v8::Private::ForApi(isolate->m_isolate, isolate->NewString("_global"));
+
+    JSValue pool = contextObject->GetPrivate(context, strPool);
+    if (!pool->StrictEquals(wrap()))
+        return CHECK_ERROR(Runtime::setError("ContextPool: object was not acquired from this pool."));
+
+    v8::Local<v8::Object> _global;
+    vm_get_global(contextObject, _global);
+
+    contextObject->DeletePrivate(context, strPool).IsJust();
+    contextObject->DeletePrivate(context, strGlobal).IsJust();
+
+    v8::Local<v8::String> strGlobalName = isolate->NewString("global");
+    v8::Local<v8::String> strGlobalThis = isolate->NewString("globalThis");
+    if (JSValue(contextObject->Get(context, strGlobalName))->StrictEquals(_global))
+        contextObject->Delete(context, strGlobalName).IsJust();
+    if (JSValue(contextObject->Get(context, strGlobalThis))->StrictEquals(_global))
+        contextObject->Delete(context, strGlobalThis).IsJust();
+
+    // code that is still alive in the context sees an empty global from now
+    // on, and the global proxy that escaped no longer reaches it
+    v8::Local<v8::Context> _context = _global->GetCreationContextChecked();
+    _context->SetEmbedderData(kSandboxObject, v8::Object::New(isolate->m_isolate));
+    _context->DetachGlobal();
+
+    return 0;
+}
+
+result_t ContextPool::get_size(int32_t& retVal)
+{
+    retVal = m_size;
+    return 0;
+}
+
+result_t ContextPool::get_available(int32_t& retVal)
+{
+    retVal = (int32_t)m_globals.size();
+    return 0;
+}
+
+}
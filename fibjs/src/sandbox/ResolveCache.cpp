@@ -0,0 +1,375 @@
+/*
+ * ResolveCache.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "ResolveCache.h"
+#include "ifs/fs.h"
+#include "ifs/vm.h"
+#include "ifs/path.h"
+#include "SimpleObject.h"
+#include "AsyncUV.h"
+#include "options.h"
+#include <unordered_map>
+#include <unordered_set>
+#include <atomic>
+#include <stdio.h>
+
+namespace fibjs {
+
+class dir_entry {
+public:
+    dir_entry()
+        : m_missing(false)
+    {
+    }
+
+public:
+    bool m_missing;
+    std::unordered_set<exlib::string> m_names;
+};
+
+class package_entry {
+public:
+    result_t m_hr;
+    exlib::string m_main;
+};
+
+class dir_watch {
+public:
+    uv_fs_event_t m_handle;
+    exlib::string m_dir;
+};
+
+static exlib::spinlock s_lock;
+static std::atomic<bool> s_loaded(false);
+static int64_t s_generation = 0;
+static std::unordered_map<exlib::string, dir_entry> s_dirs;
+static std::unordered_map<exlib::string, exlib::string> s_realpaths;
+static std::unordered_map<exlib::string, package_entry> s_packages;
+static std::unordered_map<exlib::string, exlib::string> s_resolved;
+static std::unordered_map<exlib::string, dir_watch*> s_watches;
+
+// names are looked up the way the file system compares them
+static exlib::string fold_name(exlib::string name)
+{
+#if defined(_WIN32) || defined(__APPLE__)
+    char* p = name.data();
+    for (size_t i = 0; i < name.length(); i++)
+        if (p[i] >= 'A' && p[i] <= 'Z')
+            p[i] += 'a' - 'A';
+#endif
+    return name;
+}
+
+// paths inside a zip file are not on the file system
+static bool is_virtual(exlib::string fname)
+{
+    return fname.find('$') != exlib::string::npos;
+}
+
+static void load_cache()
+{
+    FILE* fp = fopen(g_resolve_cache_file.c_str(), "rb");
+    if (fp == NULL)
+        return;
+
+    exlib::string data;
+    char buf[8192];
+    size_t sz;
+
+    while ((sz = fread(buf, 1, sizeof(buf), fp)) > 0)
+        data.append(buf, sz);
+    fclose(fp);
+
+    // pairs of key and file, each ends with a zero byte
+    size_t pos = 0;
+    while (pos < data.length()) {
+        size_t p1 = data.find('\0', pos);
+        if (p1 == exlib::string::npos)
+            break;
+        size_t p2 = data.find('\0', p1 + 1);
+        if (p2 == exlib::string::npos)
+            break;
+
+        s_resolved[data.substr(pos, p1 - pos)] = data.substr(p1 + 1, p2 - p1 - 1);
+        pos = p2 + 1;
+    }
+}
+
+bool ResolveCache::enabled()
+{
+    if (!g_resolve_cache)
+        return false;
+
+    if (!s_loaded.load(std::memory_order_acquire)) {
+        s_lock.lock();
+        if (!s_loaded.load(std::memory_order_relaxed)) {
+            if (!g_resolve_cache_file.empty())
+                load_cache();
+            s_loaded.store(true, std::memory_order_release);
+        }
+        s_lock.unlock();
+    }
+
+    return true;
+}
+
+int64_t ResolveCache::generation()
+{
+    s_lock.lock();
+    int64_t generation = s_generation;
+    s_lock.unlock();
+
+    return generation;
+}
+
+template <typename T>
+static void erase_tree(T& map, exlib::string path)
+{
+    exlib::string prefix = path + PATH_SLASH;
+
+    map.erase(path);
+    for (auto it = map.begin(); it != map.end();)
+        if (it->first.substr(0, prefix.length()) == prefix)
+            it = map.erase(it);
+        else
+            it++;
+}
+
+// name was added, removed or changed in dir. a directory that was missing
+// may have just been created, so what was learned under it goes too.
+static void invalidate(exlib::string dir, const char* name)
+{
+    exlib::string path = dir;
+
+    if (name && *name)
+        path = path + PATH_SLASH + name;
+
+    s_lock.lock();
+    s_generation++;
+    s_dirs.erase(dir);
+    s_packages.erase(dir);
+    erase_tree(s_dirs, path);
+    erase_tree(s_packages, path);
+    s_realpaths.clear();
+    s_resolved.clear();
+    s_lock.unlock();
+}
+
+static void watch_cb(uv_fs_event_t* handle, const char* filename, int events, int status)
+{
+    invalidate(((dir_watch*)handle->data)->m_dir, filename);
+}
+
+// start watching dir before it is listed, so no change slips in between
+static void watch_dir(exlib::string dir)
+{
+    s_lock.lock();
+    bool watched = s_watches.find(dir) != s_watches.end();
+    if (!watched)
+        s_watches[dir] = NULL;
+    s_lock.unlock();
+
+    if (watched)
+        return;
+
+    dir_watch* w = new dir_watch();
+    w->m_dir = dir;
+    w->m_handle.data = w;
+
+    int32_t ret = uv_call([w] {
+        uv_fs_event_init(s_uv_loop, &w->m_handle);
+        return uv_fs_event_start(&w->m_handle, watch_cb, w->m_dir.c_str(), 0);
+    });
+
+    if (ret == 0) {
+        s_lock.lock();
+        s_watches[dir] = w;
+        s_lock.unlock();
+    } else
+        uv_post([w] {
+            uv_close((uv_handle_t*)&w->m_handle, [](uv_handle_t* handle) {
+                delete (dir_watch*)handle->data;
+            });
+        });
+}
+
+bool ResolveCache::exists(exlib::string fname)
+{
+    if (!enabled() || is_virtual(fname))
+        return true;
+
+    exlib::string dir, name;
+    path_base::dirname(fname, dir);
+    path_base::basename(fname, "", name);
+    name = fold_name(name);
+
+    s_lock.lock();
+    auto it = s_dirs.find(dir);
+    if (it != s_dirs.end()) {
+        bool found = !it->second.m_missing && it->second.m_names.find(name) != it->second.m_names.end();
+        s_lock.unlock();
+        return found;
+    }
+    int64_t generation = s_generation;
+    s_lock.unlock();
+
+    if (g_resolve_cache_watch)
+        watch_dir(dir);
+
+    obj_ptr<NArray> names;
+    dir_entry entry;
+    result_t hr = fs_base::ac_readdir(dir, names);
+
+    if (hr == UV_ENOENT || hr == UV_ENOTDIR)
+        entry.m_missing = true;
+    else if (hr < 0)
+        return true;
+    else {
+        int32_t len = names->length();
+        for (int32_t i = 0; i < len; i++) {
+            Variant v;
+            names->_indexed_getter(i, v);
+            entry.m_names.insert(fold_name(v.string()));
+        }
+    }
+
+    bool found = entry.m_names.find(name) != entry.m_names.end();
+
+    // a change seen while listing may not be in the listing
+    s_lock.lock();
+    if (generation == s_generation)
+        s_dirs[dir] = entry;
+    s_lock.unlock();
+
+    return found;
+}
+
+result_t ResolveCache::realpath(exlib::string fname, exlib::string& retVal)
+{
+    if (!enabled() || is_virtual(fname))
+        return fs_base::ac_realpath(fname, retVal);
+
+    s_lock.lock();
+    auto it = s_realpaths.find(fname);
+    if (it != s_realpaths.end()) {
+        retVal = it->second;
+        s_lock.unlock();
+        return 0;
+    }
+    int64_t generation = s_generation;
+    s_lock.unlock();
+
+    result_t hr = fs_base::ac_realpath(fname, retVal);
+    if (hr < 0)
+        return hr;
+
+    s_lock.lock();
+    if (generation == s_generation)
+        s_realpaths[fname] = retVal;
+    s_lock.unlock();
+
+    return 0;
+}
+
+bool ResolveCache::get_package(exlib::string dir, result_t& hr, exlib::string& retVal)
+{
+    if (!enabled())
+        return false;
+
+    s_lock.lock();
+    auto it = s_packages.find(dir);
+    bool found = it != s_packages.end();
+    if (found) {
+        hr = it->second.m_hr;
+        retVal = it->second.m_main;
+    }
+    s_lock.unlock();
+
+    return found;
+}
+
+void ResolveCache::set_package(int64_t generation, exlib::string dir, result_t hr, exlib::string main)
+{
+    if (!enabled())
+        return;
+
+    s_lock.lock();
+    if (generation == s_generation) {
+        package_entry& e = s_packages[dir];
+        e.m_hr = hr;
+        e.m_main = main;
+    }
+    s_lock.unlock();
+}
+
+bool ResolveCache::get_resolved(exlib::string key, exlib::string& retVal)
+{
+    if (!enabled())
+        return false;
+
+    s_lock.lock();
+    auto it = s_resolved.find(key);
+    bool found = it != s_resolved.end();
+    if (found)
+        retVal = it->second;
+    s_lock.unlock();
+
+    return found;
+}
+
+void ResolveCache::set_resolved(int64_t generation, exlib::string key, exlib::string fname)
+{
+    if (!enabled())
+        return;
+
+    s_lock.lock();
+    if (generation == s_generation)
+        s_resolved[key] = fname;
+    s_lock.unlock();
+}
+
+void ResolveCache::clear()
+{
+    s_lock.lock();
+    s_generation++;
+    s_dirs.clear();
+    s_realpaths.clear();
+    s_packages.clear();
+    s_resolved.clear();
+    s_lock.unlock();
+}
+
+void ResolveCache::save()
+{
+    if (!g_resolve_cache || g_resolve_cache_file.empty())
+        return;
+
+    exlib::string data;
+
+    s_lock.lock();
+    for (auto& it : s_resolved) {
+        data.append(it.first.c_str(), it.first.length() + 1);
+        data.append(it.second.c_str(), it.second.length() + 1);
+    }
+    s_lock.unlock();
+
+    FILE* fp = fopen(g_resolve_cache_file.c_str(), "wb");
+    if (fp == NULL)
+        return;
+
+    fwrite(data.c_str(), 1, data.length(), fp);
+    fclose(fp);
+}
+
+result_t vm_base::clearResolveCache()
+{
+    ResolveCache::clear();
+    return 0;
+}
+
+} /* namespace fibjs */
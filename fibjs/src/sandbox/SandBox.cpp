@@ -17,6 +17,8 @@
 #include "ifs/EventEmitter.h"
 #include "loaders/loaders.h"
 #include "options.h"
+#include <uv/include/uv.h>
+#include <stdio.h>
 
 namespace fibjs {
 
@@ -147,6 +149,67 @@ void SandBox::installBuffer()
     InstallModule("node:buffer", _buffer);
 }
 
+static v8::Local<v8::Object> touch_builtin(Isolate* isolate, RootModule* pModule)
+{
+    if (!g_trace_builtins)
+        return pModule->getModule(isolate);
+
+    const char* name = pModule->name();
+    for (size_t i = 0; i < isolate->m_builtins.size(); i++)
+        if (!qstrcmp(isolate->m_builtins[i].name, name))
+            return pModule->getModule(isolate);
+
+    uint64_t tm = uv_hrtime();
+    v8::Local<v8::Object> mod = pModule->getModule(isolate);
+    uint64_t now = uv_hrtime();
+
+    isolate->m_builtins.push_back({ name, tm - isolate->m_start_time, now - tm });
+
+    return mod;
+}
+
+void SandBox::lazy_builtin(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    RootModule* pModule = (RootModule*)info.Data().As<v8::External>()->Value();
+    info.GetReturnValue().Set(touch_builtin(Isolate::current(info), pModule));
+}
+
+void SandBox::lazy_builtin_promises(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    Isolate* isolate = Isolate::current(info);
+    RootModule* pModule = (RootModule*)info.Data().As<v8::External>()->Value();
+    v8::Local<v8::Object> mod = touch_builtin(isolate, pModule);
+
+    info.GetReturnValue().Set(mod->Get(isolate->context(), isolate->NewString("promises")).FromMaybe(v8::Local<v8::Value>()));
+}
+
+void SandBox::installBuiltin(exlib::string fname, RootModule* pModule, v8::AccessorNameGetterCallback getter)
+{
+    Isolate* isolate = holder();
+    v8::Local<v8::Object> m = v8::Object::New(isolate->m_isolate);
+
+    m->SetLazyDataProperty(isolate->context(), isolate->NewString("exports"), getter,
+         v8::External::New(isolate->m_isolate, pModule))
+        .IsJust();
+    InstallModule(fname, v8::Local<v8::Value>(), m);
+}
+
+void SandBox::traceBuiltins(Isolate* isolate)
+{
+    int32_t count = 0;
+
+    for (RootModule* pModule = RootModule::g_root; pModule; pModule = pModule->m_next)
+        count++;
+
+    fprintf(stderr, "builtin modules: %d of %d used\n", (int32_t)isolate->m_builtins.size(), count);
+    fprintf(stderr, "   time(ms)   cost(ms)  module\n");
+
+    for (size_t i = 0; i < isolate->m_builtins.size(); i++) {
+        Isolate::BuiltinTouch& b = isolate->m_builtins[i];
+        fprintf(stderr, "%11.3f%11.3f  %s\n", (double)b.time / 1000000, (double)b.cost / 1000000, b.name);
+    }
+}
+
 result_t SandBox::addBuiltinModules()
 {
     Isolate* isolate = holder();
@@ -156,19 +219,32 @@ result_t SandBox::addBuiltinModules()
 
     while (pModule) {
         exlib::string name = pModule->name();
-        v8::Local<v8::Object> mod = pModule->getModule(isolate);
-        InstallModule(name, mod);
-        InstallModule("node:" + name, mod);
-
-        v8::Local<v8::Value> promises = mod->Get(context, isolate->NewString("promises")).FromMaybe(v8::Local<v8::Value>());
-        if (!promises.IsEmpty() && promises->IsObject()) {
-            InstallModule(name + PATH_SLASH + "promises", promises.As<v8::Object>());
-            InstallModule("node:" + name + PATH_SLASH + "promises", promises.As<v8::Object>());
+        installBuiltin(name, pModule, lazy_builtin);
+        installBuiltin("node:" + name, pModule, lazy_builtin);
+
+        if (pModule->class_info().hasPromises()) {
+            installBuiltin(name + PATH_SLASH + "promises", pModule, lazy_builtin_promises);
+            installBuiltin("node:" + name + PATH_SLASH + "promises", pModule, lazy_builtin_promises);
         }
 
         pModule = pModule->m_next;
     }
 
+    // modules preloaded into the startup snapshot, keyed by their full path
+    if (!isolate->m_snapshot_modules.IsEmpty()) {
+        v8::Local<v8::Object> mods = isolate->m_snapshot_modules.Get(isolate->m_isolate);
+        JSArray names = mods->GetOwnPropertyNames(context);
+        int32_t len = names->Length();
+
+        for (int32_t i = 0; i < len; i++) {
+            JSValue name = names->Get(context, i);
+            JSValue m = mods->Get(context, name);
+
+            if (m->IsObject())
+                InstallModule(isolate->toString(name), v8::Local<v8::Value>(), m.As<v8::Object>());
+        }
+    }
+
     installBuffer();
 
     return 0;
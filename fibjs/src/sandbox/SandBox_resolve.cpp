@@ -14,6 +14,8 @@
 #include "LruCache.h"
 #include "Buffer.h"
 #include "options.h"
+#include "ResolveCache.h"
+#include "Bundle.h"
 #include "loaders/loaders.h"
 
 namespace fibjs {
@@ -22,6 +24,18 @@ result_t SandBox::loadFile(exlib::string fname, obj_ptr<Buffer_base>& data)
 {
     result_t hr;
 
+    // modules in a bundle are used in place
+    obj_ptr<Bundle> bundle;
+    exlib::string member;
+    if (Bundle::find(fname, bundle, member)) {
+        const Bundle::Slot* slot = bundle->lookup(member, Bundle::kFile);
+        if (!slot)
+            return CALL_E_FILE_NOT_FOUND;
+
+        data = bundle->buffer(slot);
+        return 0;
+    }
+
     if (fname.substr(fname.length() - 5) == ".node") {
         obj_ptr<Stat_base> stat;
         hr = fs_base::ac_stat(fname, stat);
@@ -43,16 +57,29 @@ result_t SandBox::loadFile(exlib::string fname, obj_ptr<Buffer_base>& data)
     return hr;
 }
 
+// the real path of fname, and false when the resolve cache knows it is not there
+static bool probe(exlib::string fname, exlib::string& retVal)
+{
+    if (!ResolveCache::exists(fname)) {
+        retVal = fname;
+        return false;
+    }
+
+    if (ResolveCache::realpath(fname, retVal) < 0)
+        retVal = fname;
+
+    return true;
+}
+
 result_t SandBox::resolveFile(v8::Local<v8::Object> mods, exlib::string& fname, obj_ptr<Buffer_base>& data,
     v8::Local<v8::Value>* retVal)
 {
     size_t cnt = m_loaders.size();
     result_t hr;
     exlib::string fname1;
+    bool found;
 
-    hr = fs_base::ac_realpath(fname, fname1);
-    if (hr < 0)
-        fname1 = fname;
+    found = probe(fname, fname1);
 
     if (retVal) {
         *retVal = get_module(mods, fname1);
@@ -62,19 +89,18 @@ result_t SandBox::resolveFile(v8::Local<v8::Object> mods, exlib::string& fname,
         }
     }
 
-    hr = loadFile(fname1, data);
-    if (hr >= 0) {
-        fname = fname1;
-        return 0;
+    if (found) {
+        hr = loadFile(fname1, data);
+        if (hr >= 0) {
+            fname = fname1;
+            return 0;
+        }
     }
 
     for (size_t i = 0; i < cnt; i++) {
         obj_ptr<ExtLoader>& l = m_loaders[i];
-        exlib::string fname2 = fname + l->m_ext;
 
-        hr = fs_base::ac_realpath(fname2, fname1);
-        if (hr < 0)
-            fname1 = fname2;
+        found = probe(fname + l->m_ext, fname1);
 
         if (retVal) {
             *retVal = get_module(mods, fname1);
@@ -84,20 +110,22 @@ result_t SandBox::resolveFile(v8::Local<v8::Object> mods, exlib::string& fname,
             }
         }
 
-        hr = loadFile(fname1, data);
-        if (hr >= 0) {
-            fname = fname1;
-            return 0;
+        if (found) {
+            hr = loadFile(fname1, data);
+            if (hr >= 0) {
+                fname = fname1;
+                return 0;
+            }
         }
     }
 
     return CALL_E_FILE_NOT_FOUND;
 }
 
-result_t SandBox::resolvePackage(v8::Local<v8::Object> mods, exlib::string& fname,
-    obj_ptr<Buffer_base>& data, v8::Local<v8::Value>* retVal)
+// the entry that package.json in dir names for require()
+static result_t package_main(SandBox* sb, exlib::string dir, exlib::string& config_name)
 {
-    Isolate* isolate = holder();
+    Isolate* isolate = sb->holder();
     v8::Local<v8::Context> context = isolate->context();
     exlib::string fname1;
     result_t hr;
@@ -105,9 +133,12 @@ result_t SandBox::resolvePackage(v8::Local<v8::Object> mods, exlib::string& fnam
     exlib::string buf;
     obj_ptr<Buffer_base> bin;
 
-    fname1 = fname;
+    fname1 = dir;
     resolvePath(fname1, "package.json");
-    hr = loadFile(fname1, bin);
+    if (!ResolveCache::exists(fname1))
+        return CALL_E_FILE_NOT_FOUND;
+
+    hr = sb->loadFile(fname1, bin);
     if (hr < 0)
         return CALL_E_FILE_NOT_FOUND;
 
@@ -120,7 +151,6 @@ result_t SandBox::resolvePackage(v8::Local<v8::Object> mods, exlib::string& fnam
         return CHECK_ERROR(Runtime::setError("SandBox: Invalid package.json"));
 
     v8::Local<v8::Object> o = v8::Local<v8::Object>::Cast(v);
-    exlib::string config_name;
 
     v8::Local<v8::String> strExports = isolate->NewString("exports", 7);
     JSValue exports = o->Get(context, strExports);
@@ -181,6 +211,25 @@ result_t SandBox::resolvePackage(v8::Local<v8::Object> mods, exlib::string& fnam
         config_name = isolate->toString(main);
     }
 
+    return 0;
+}
+
+result_t SandBox::resolvePackage(v8::Local<v8::Object> mods, exlib::string& fname,
+    obj_ptr<Buffer_base>& data, v8::Local<v8::Value>* retVal)
+{
+    exlib::string config_name;
+    result_t hr;
+
+    if (!ResolveCache::get_package(fname, hr, config_name)) {
+        int64_t generation = ResolveCache::generation();
+
+        hr = package_main(this, fname, config_name);
+        if (hr >= 0 || hr == CALL_E_FILE_NOT_FOUND)
+            ResolveCache::set_package(generation, fname, hr, config_name);
+    }
+    if (hr < 0)
+        return hr;
+
     resolvePath(fname, config_name);
     path_base::normalize(fname, fname);
 
@@ -314,6 +363,18 @@ result_t SandBox::resolveId(exlib::string& id, v8::Local<v8::Value>& retVal)
     return custom_resolveId(id, retVal);
 }
 
+// what an id resolves to depends on the extensions this sandbox can load,
+// so they are part of its key in the process wide resolve cache
+exlib::string SandBox::resolve_key(exlib::string key)
+{
+    exlib::string exts;
+
+    for (size_t i = 0; i < m_loaders.size(); i++)
+        exts += m_loaders[i]->m_ext;
+
+    return exts + '\n' + key;
+}
+
 result_t SandBox::resolveModule(exlib::string base, exlib::string& id, obj_ptr<Buffer_base>& data,
     v8::Local<v8::Value>& retVal)
 {
@@ -352,6 +413,17 @@ result_t SandBox::resolveModule(exlib::string base, exlib::string& id, obj_ptr<B
 
         if (isPathSlash(base.c_str()[base.length() - 1]))
             base.resize(base.length() - 1);
+
+        exlib::string key = resolve_key(base + '\n' + id);
+        if (ResolveCache::get_resolved(key, fname)) {
+            hr = resolveFile(fname, data, &retVal);
+            if (hr >= 0) {
+                id = fname;
+                return hr;
+            }
+        }
+
+        int64_t generation = ResolveCache::generation();
         fname = base;
 
         while (true) {
@@ -365,6 +437,8 @@ result_t SandBox::resolveModule(exlib::string base, exlib::string& id, obj_ptr<B
 
             hr = resolveFile(fname, data, &retVal);
             if (hr != CALL_E_FILE_NOT_FOUND && hr != CALL_E_PATH_NOT_FOUND) {
+                if (hr >= 0)
+                    ResolveCache::set_resolved(generation, key, fname);
                 id = fname;
                 return hr;
             }
@@ -398,7 +472,26 @@ result_t SandBox::resolve(exlib::string base, exlib::string& id, obj_ptr<Buffer_
         return resolveModule(base, id, data, retVal);
     }
 
-    return resolveFile(id, data, &retVal);
+    exlib::string key = resolve_key(id);
+    exlib::string fname;
+    result_t hr;
+
+    if (ResolveCache::get_resolved(key, fname)) {
+        hr = resolveFile(fname, data, &retVal);
+        if (hr >= 0) {
+            id = fname;
+            return hr;
+        }
+    }
+
+    int64_t generation = ResolveCache::generation();
+    fname = id;
+    hr = resolveFile(fname, data, &retVal);
+    if (hr >= 0)
+        ResolveCache::set_resolved(generation, key, fname);
+
+    id = fname;
+    return hr;
 }
 
 result_t SandBox::resolve(exlib::string id, exlib::string base, exlib::string& retVal)
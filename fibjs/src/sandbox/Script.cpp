@@ -10,11 +10,87 @@
 #include "Script.h"
 #include "SandBox.h"
 #include "Timer.h"
+#include "Buffer.h"
+#include "options.h"
+#include "ifs/fs.h"
+#include "path.h"
+#include <uv/include/uv.h>
+#include <openssl/evp.h>
 
 namespace fibjs {
 
 void vm_get_global(v8::Local<v8::Object> obj, v8::Local<v8::Object>& retVal);
 
+v8::Local<v8::UnboundScript> ScriptCache::get(Isolate* isolate, const exlib::string& key)
+{
+    auto it = m_scripts.find(key);
+    if (it == m_scripts.end())
+        return v8::Local<v8::UnboundScript>();
+
+    m_lru.splice(m_lru.begin(), m_lru, it->second.m_lru);
+    return it->second.m_script.Get(isolate->m_isolate);
+}
+
+void ScriptCache::put(Isolate* isolate, const exlib::string& key, v8::Local<v8::UnboundScript> script)
+{
+    if (m_scripts.find(key) != m_scripts.end())
+        return;
+
+    while (m_scripts.size() >= (size_t)g_script_cache_size) {
+        m_scripts.erase(m_lru.back());
+        m_lru.pop_back();
+    }
+
+    m_lru.push_front(key);
+
+    entry& e = m_scripts[key];
+    e.m_script.Reset(isolate->m_isolate, script);
+    e.m_lru = m_lru.begin();
+}
+
+// the code cache of a script is kept in --script-cache=dir, named by the
+// sha256 of its origin and source
+static exlib::string script_cache_file(const exlib::string& key)
+{
+    unsigned char md[EVP_MAX_MD_SIZE];
+    unsigned int md_len = 0;
+    static const char hex[] = "0123456789abcdef";
+    exlib::string name;
+
+    EVP_Digest(key.c_str(), key.length(), md, &md_len, EVP_sha256(), NULL);
+
+    name.resize(md_len * 2);
+    char* p = name.data();
+    for (unsigned int i = 0; i < md_len; i++) {
+        p[i * 2] = hex[md[i] >> 4];
+        p[i * 2 + 1] = hex[md[i] & 15];
+    }
+
+    exlib::string fname = g_script_cache_dir;
+    resolvePath(fname, name + ".cache");
+    return fname;
+}
+
+// written to a temporary file first, so a reader never sees half of it
+static void save_script_cache(exlib::string fname, v8::Local<v8::UnboundScript> script)
+{
+    v8::ScriptCompiler::CachedData* cache = v8::ScriptCompiler::CreateCodeCache(script);
+    if (!cache)
+        return;
+
+    obj_ptr<Buffer_base> data = new Buffer(cache->data, cache->length);
+    delete cache;
+
+    static exlib::atomic s_tmp_id;
+    char buf[64];
+    snprintf(buf, sizeof(buf), ".%d.%d.tmp", (int32_t)uv_os_getpid(), (int32_t)s_tmp_id.inc());
+    exlib::string tmp = fname + buf;
+
+    if (fs_base::ac_writeFile(tmp, data, "binary") == 0)
+        if (fs_base::ac_rename(tmp, fname) < 0)
+            fs_base::ac_unlink(tmp);
+}
+
 result_t Script_base::_new(exlib::string code, v8::Local<v8::Object> opts,
     obj_ptr<Script_base>& retVal, v8::Local<v8::Object> This)
 {
@@ -48,17 +124,103 @@ result_t Script::init(exlib::string code, v8::Local<v8::Object> opts)
     if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
         return hr;
 
-    v8::ScriptOrigin origin(isolate->m_isolate, isolate->NewString(filename), lineOffset, columnOffset);
-    v8::ScriptCompiler::Source source(isolate->NewString(code), origin);
-    v8::MaybeLocal<v8::UnboundScript> maybe_ub_script
-        = v8::ScriptCompiler::CompileUnboundScript(isolate->m_isolate, &source);
+    obj_ptr<Buffer_base> cachedData;
+    hr = GetConfigValue(isolate, opts, "cachedData", cachedData, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    bool produceCachedData = false;
+    hr = GetConfigValue(isolate, opts, "produceCachedData", produceCachedData, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    char buf[64];
+    snprintf(buf, sizeof(buf), "\n%d:%d\n", lineOffset, columnOffset);
+    exlib::string key = filename + buf + code;
 
     v8::Local<v8::UnboundScript> ub_script;
-    if (maybe_ub_script.IsEmpty() || !maybe_ub_script.ToLocal(&ub_script))
-        return CALL_E_JAVASCRIPT;
+
+    if (g_script_cache_size > 0) {
+        if (!isolate->m_script_cache)
+            isolate->m_script_cache = new ScriptCache();
+        ub_script = isolate->m_script_cache->get(isolate, key);
+    }
+
+    if (ub_script.IsEmpty()) {
+        v8::ScriptOrigin origin(isolate->m_isolate, isolate->NewString(filename), lineOffset, columnOffset);
+        exlib::string cache_file;
+        obj_ptr<Buffer_base> disk_cache;
+
+        if (!cachedData && !g_script_cache_dir.empty()) {
+            cache_file = script_cache_file(key);
+
+            Variant var;
+            if (fs_base::ac_readFile(cache_file, "", var) == 0)
+                disk_cache = (Buffer_base*)var.object();
+        }
+
+        Buffer_base* cache = cachedData ? cachedData : disk_cache;
+        v8::ScriptCompiler::CachedData* data = NULL;
+        if (cache) {
+            Buffer* _cache = Buffer::Cast(cache);
+            data = new v8::ScriptCompiler::CachedData(_cache->data(), (int32_t)_cache->length());
+        }
+
+        v8::ScriptCompiler::Source source(isolate->NewString(code), origin, data);
+        v8::MaybeLocal<v8::UnboundScript> maybe_ub_script
+            = v8::ScriptCompiler::CompileUnboundScript(isolate->m_isolate, &source,
+                data ? v8::ScriptCompiler::kConsumeCodeCache : v8::ScriptCompiler::kNoCompileOptions);
+
+        if (maybe_ub_script.IsEmpty() || !maybe_ub_script.ToLocal(&ub_script))
+            return CALL_E_JAVASCRIPT;
+
+        bool rejected = data && source.GetCachedData()->rejected;
+        if (cachedData)
+            m_cachedDataRejected = rejected;
+
+        // a cache on disk that v8 did not take was built by another version
+        if (!cache_file.empty() && (!disk_cache || rejected))
+            save_script_cache(cache_file, ub_script);
+
+        if (g_script_cache_size > 0)
+            isolate->m_script_cache->put(isolate, key, ub_script);
+    }
 
     m_script.Reset(isolate->m_isolate, ub_script);
 
+    if (produceCachedData)
+        return createCachedData(m_cachedData);
+
+    return 0;
+}
+
+result_t Script::createCachedData(obj_ptr<Buffer_base>& retVal)
+{
+    Isolate* isolate = holder();
+    v8::Local<v8::UnboundScript> ub_script = v8::Local<v8::UnboundScript>::New(isolate->m_isolate, m_script);
+
+    v8::ScriptCompiler::CachedData* cache = v8::ScriptCompiler::CreateCodeCache(ub_script);
+    if (!cache)
+        return CHECK_ERROR(Runtime::setError("Script: failed to create cached data."));
+
+    retVal = new Buffer(cache->data, cache->length);
+    delete cache;
+
+    return 0;
+}
+
+result_t Script::get_cachedData(obj_ptr<Buffer_base>& retVal)
+{
+    if (!m_cachedData)
+        return CALL_RETURN_NULL;
+
+    retVal = m_cachedData;
+    return 0;
+}
+
+result_t Script::get_cachedDataRejected(bool& retVal)
+{
+    retVal = m_cachedDataRejected;
     return 0;
 }
 
@@ -7,6 +7,7 @@
  */
 
 #include "Buffer.h"
+#include "Bundle.h"
 #include "SandBox.h"
 #include "loaders.h"
 #include "object.h"
@@ -24,7 +25,16 @@ result_t custom_Loader::compile(SandBox::Context* ctx, Buffer_base* src, exlib::
     // read filecontent and compile to strScript :start
     v8::Local<v8::Value> transpileArgs[2];
 
-    src->valueOf(transpileArgs[0]);
+    // a module in a bundle is mapped read only, the compiler gets a copy
+    obj_ptr<Buffer_base> _src = src;
+    obj_ptr<Bundle> bundle;
+    exlib::string member;
+    if (Bundle::find(name, bundle, member)) {
+        Buffer* buf = Buffer::Cast(src);
+        _src = new Buffer(buf->data(), buf->length());
+    }
+
+    _src->valueOf(transpileArgs[0]);
     v8::Local<v8::Object> requireInfo = v8::Object::New(isolate->m_isolate);
     transpileArgs[1] = requireInfo;
 
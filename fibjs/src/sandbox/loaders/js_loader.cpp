@@ -10,6 +10,7 @@
 #include "SandBox.h"
 #include "loaders.h"
 #include "ifs/util.h"
+#include "Bundle.h"
 
 namespace fibjs {
 
@@ -38,9 +39,28 @@ result_t js_Loader::compile(SandBox::Context* ctx, Buffer_base* src, exlib::stri
     v8::ScriptOrigin so_origin(isolate->m_isolate, soname, -1, 0, false,
         -1, v8::Local<v8::Value>(), false, false, false, pargs);
 
-    script = v8::Script::Compile(isolate->m_isolate->GetCurrentContext(),
-        isolate->NewString(src1), &so_origin)
-                 .FromMaybe(v8::Local<v8::Script>());
+    // a module in a bundle may come with the code cache of its source,
+    // v8 checks that it matches and compiles from scratch when it does not
+    obj_ptr<Bundle> bundle;
+    exlib::string member;
+    const Bundle::Slot* slot = NULL;
+
+    if (m_ext == ".js" && Bundle::find(name, bundle, member))
+        slot = bundle->lookup(member, Bundle::kCodeCache);
+
+    if (slot) {
+        v8::ScriptCompiler::CachedData* cache;
+        cache = new v8::ScriptCompiler::CachedData((const uint8_t*)bundle->data(slot), (int32_t)slot->size);
+
+        v8::ScriptCompiler::Source source(isolate->NewString(src1), so_origin, cache);
+
+        script = v8::ScriptCompiler::Compile(isolate->m_isolate->GetCurrentContext(), &source,
+            v8::ScriptCompiler::kConsumeCodeCache)
+                     .FromMaybe(v8::Local<v8::Script>());
+    } else
+        script = v8::Script::Compile(isolate->m_isolate->GetCurrentContext(),
+            isolate->NewString(src1), &so_origin)
+                     .FromMaybe(v8::Local<v8::Script>());
 
     if (script.IsEmpty())
         return throwSyntaxError(try_catch);
@@ -0,0 +1,392 @@
+/*
+ * bench.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "ifs/test.h"
+#include "ifs/coroutine.h"
+#include "console.h"
+#include <uv/include/uv.h>
+#include <math.h>
+#include <vector>
+
+namespace fibjs {
+
+void asyncLog(int32_t priority, exlib::string msg);
+v8::Local<v8::Function> wrapFunction(v8::Local<v8::Function> func);
+
+class _bench_gc {
+public:
+    _bench_gc(v8::Isolate* isolate)
+        : m_isolate(isolate)
+    {
+        reset();
+
+        m_isolate->AddGCPrologueCallback(prologue, this);
+        m_isolate->AddGCEpilogueCallback(epilogue, this);
+    }
+
+    ~_bench_gc()
+    {
+        m_isolate->RemoveGCPrologueCallback(prologue, this);
+        m_isolate->RemoveGCEpilogueCallback(epilogue, this);
+    }
+
+public:
+    void reset()
+    {
+        m_count = 0;
+        m_scavenge = 0;
+        m_markSweep = 0;
+        m_time = 0;
+        m_freed = 0;
+    }
+
+    size_t used()
+    {
+        v8::HeapStatistics hs;
+        m_isolate->GetHeapStatistics(&hs);
+        return hs.used_heap_size();
+    }
+
+private:
+    static void prologue(v8::Isolate* isolate, v8::GCType type, v8::GCCallbackFlags flags, void* data)
+    {
+        _bench_gc* pThis = (_bench_gc*)data;
+
+        pThis->m_before = pThis->used();
+        pThis->m_start = uv_hrtime();
+    }
+
+    static void epilogue(v8::Isolate* isolate, v8::GCType type, v8::GCCallbackFlags flags, void* data)
+    {
+        _bench_gc* pThis = (_bench_gc*)data;
+        size_t after = pThis->used();
+
+        if (pThis->m_before > after)
+            pThis->m_freed += pThis->m_before - after;
+        pThis->m_time += uv_hrtime() - pThis->m_start;
+
+        pThis->m_count++;
+        if (type == v8::kGCTypeScavenge)
+            pThis->m_scavenge++;
+        else if (type == v8::kGCTypeMarkSweepCompact)
+            pThis->m_markSweep++;
+    }
+
+public:
+    int32_t m_count;
+    int32_t m_scavenge;
+    int32_t m_markSweep;
+    uint64_t m_time;
+    uint64_t m_freed;
+
+private:
+    v8::Isolate* m_isolate;
+    size_t m_before = 0;
+    uint64_t m_start = 0;
+};
+
+class _bench {
+public:
+    _bench(Isolate* isolate, v8::Local<v8::Function> fn, int32_t concurrency)
+        : m_isolate(isolate)
+        , m_fn(fn)
+        , m_concurrency(concurrency)
+        , m_left(0)
+    {
+        if (m_concurrency > 1) {
+            v8::Local<v8::Context> context = isolate->context();
+            v8::Local<v8::Function> worker = isolate->NewFunction("bench_worker", s_worker,
+                v8::External::New(isolate->m_isolate, this));
+
+            m_workers = v8::Array::New(isolate->m_isolate, m_concurrency);
+            for (int32_t i = 0; i < m_concurrency; i++)
+                m_workers->Set(context, i, worker).IsJust();
+        }
+    }
+
+public:
+    result_t run(int64_t n, uint64_t& elapsed)
+    {
+        v8::HandleScope handle_scope(m_isolate->m_isolate);
+        result_t hr = 0;
+
+        m_left = n;
+
+        uint64_t t = uv_hrtime();
+        if (m_concurrency > 1) {
+            v8::Local<v8::Array> r;
+            hr = coroutine_base::parallel(m_workers, m_concurrency, r);
+        } else if (!drain())
+            hr = CALL_E_JAVASCRIPT;
+        elapsed = uv_hrtime() - t;
+
+        return hr;
+    }
+
+private:
+    bool drain()
+    {
+        v8::Local<v8::Context> context = m_fn->GetCreationContextChecked();
+        v8::Local<v8::Value> recv = v8::Undefined(m_isolate->m_isolate);
+
+        while (m_left > 0) {
+            v8::HandleScope handle_scope(m_isolate->m_isolate);
+
+            m_left--;
+            if (m_fn->Call(context, recv, 0, NULL).IsEmpty())
+                return false;
+        }
+
+        return true;
+    }
+
+    static void s_worker(const v8::FunctionCallbackInfo<v8::Value>& args)
+    {
+        _bench* pThis = (_bench*)v8::Local<v8::External>::Cast(args.Data())->Value();
+        pThis->drain();
+    }
+
+private:
+    Isolate* m_isolate;
+    v8::Local<v8::Function> m_fn;
+    int32_t m_concurrency;
+    v8::Local<v8::Array> m_workers;
+    int64_t m_left;
+};
+
+static double t_critical(size_t df)
+{
+    static const double s_table[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+
+    if (df == 0)
+        return 0;
+    if (df <= ARRAYSIZE(s_table))
+        return s_table[df - 1];
+    return 1.96;
+}
+
+static exlib::string format_ops(double ops)
+{
+    char buf[64];
+    exlib::string str;
+
+    if (ops >= 100)
+        snprintf(buf, sizeof(buf), "%.0f", ops);
+    else
+        snprintf(buf, sizeof(buf), "%.2f", ops);
+
+    const char* p = buf;
+    const char* dot = qstrchr(buf, '.');
+    int32_t len = dot ? (int32_t)(dot - buf) : (int32_t)qstrlen(buf);
+
+    for (int32_t i = 0; i < len; i++) {
+        if (i > 0 && (len - i) % 3 == 0)
+            str.append(1, ',');
+        str.append(1, p[i]);
+    }
+    if (dot)
+        str.append(dot);
+
+    return str;
+}
+
+result_t test_base::bench(exlib::string name, v8::Local<v8::Function> fn, v8::Local<v8::Object> opts,
+    v8::Local<v8::Object>& retVal)
+{
+    Isolate* isolate = Isolate::current(fn);
+    v8::Local<v8::Context> context = isolate->context();
+    result_t hr;
+
+    int32_t warmup = 100;
+    hr = GetConfigValue(isolate, opts, "warmup", warmup, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    int32_t time = 1000;
+    hr = GetConfigValue(isolate, opts, "time", time, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    int32_t minSamples = 5;
+    hr = GetConfigValue(isolate, opts, "minSamples", minSamples, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    int32_t iterations = 0;
+    hr = GetConfigValue(isolate, opts, "iterations", iterations, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    int32_t concurrency = 1;
+    hr = GetConfigValue(isolate, opts, "concurrency", concurrency, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    double threshold = 5;
+    hr = GetConfigValue(isolate, opts, "threshold", threshold, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    if (warmup < 0 || time < 0 || minSamples < 1 || iterations < 0 || concurrency < 1 || threshold < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    _bench b(isolate, wrapFunction(fn), concurrency);
+    _bench_gc gc(isolate->m_isolate);
+    uint64_t elapsed;
+
+    uint64_t warmup_ns = (uint64_t)warmup * 1000000;
+    uint64_t spent = 0;
+    int64_t count = 0;
+    int64_t n = 1;
+
+    do {
+        hr = b.run(n, elapsed);
+        if (hr < 0)
+            return hr;
+
+        spent += elapsed;
+        count += n;
+
+        if (elapsed < warmup_ns / 10 && n < (1 << 20))
+            n *= 2;
+    } while (spent < warmup_ns);
+
+    uint64_t time_ns = (uint64_t)time * 1000000;
+
+    if (iterations > 0)
+        n = iterations;
+    else {
+        double per_op = spent > 0 ? (double)spent / count : 1;
+
+        n = (int64_t)(time_ns / 20 / per_op);
+        if (n < 1)
+            n = 1;
+        else if (n > INT32_MAX)
+            n = INT32_MAX;
+    }
+
+    std::vector<double> samples;
+    uint64_t total = 0;
+
+    gc.reset();
+    size_t used = gc.used();
+
+    while (total < time_ns || (int32_t)samples.size() < minSamples) {
+        hr = b.run(n, elapsed);
+        if (hr < 0)
+            return hr;
+
+        total += elapsed;
+        samples.push_back((double)elapsed / n);
+    }
+
+    int64_t allocated = (int64_t)gc.used() - (int64_t)used + (int64_t)gc.m_freed;
+    if (allocated < 0)
+        allocated = 0;
+
+    size_t k = samples.size();
+    double mean = 0;
+    for (size_t i = 0; i < k; i++)
+        mean += samples[i];
+    mean /= k;
+
+    double variance = 0;
+    if (k > 1) {
+        for (size_t i = 0; i < k; i++)
+            variance += (samples[i] - mean) * (samples[i] - mean);
+        variance /= k - 1;
+    }
+
+    double sd = sqrt(variance);
+    double rme = mean > 0 ? t_critical(k - 1) * sd / sqrt((double)k) / mean * 100 : 0;
+    double ops = mean > 0 ? 1e9 / mean : 0;
+
+    v8::Local<v8::Object> o = v8::Object::New(isolate->m_isolate);
+
+    o->Set(context, isolate->NewString("name"), isolate->NewString(name)).IsJust();
+    o->Set(context, isolate->NewString("ops"), v8::Number::New(isolate->m_isolate, ops)).IsJust();
+    o->Set(context, isolate->NewString("mean"), v8::Number::New(isolate->m_isolate, mean)).IsJust();
+    o->Set(context, isolate->NewString("sd"), v8::Number::New(isolate->m_isolate, sd)).IsJust();
+    o->Set(context, isolate->NewString("rme"), v8::Number::New(isolate->m_isolate, rme)).IsJust();
+    o->Set(context, isolate->NewString("samples"), v8::Number::New(isolate->m_isolate, (double)k)).IsJust();
+    o->Set(context, isolate->NewString("iterations"), v8::Number::New(isolate->m_isolate, (double)n)).IsJust();
+    o->Set(context, isolate->NewString("concurrency"), v8::Number::New(isolate->m_isolate, concurrency)).IsJust();
+
+    v8::Local<v8::Object> o1 = v8::Object::New(isolate->m_isolate);
+    o1->Set(context, isolate->NewString("count"), v8::Number::New(isolate->m_isolate, gc.m_count)).IsJust();
+    o1->Set(context, isolate->NewString("scavenge"), v8::Number::New(isolate->m_isolate, gc.m_scavenge)).IsJust();
+    o1->Set(context, isolate->NewString("markSweep"), v8::Number::New(isolate->m_isolate, gc.m_markSweep)).IsJust();
+    o1->Set(context, isolate->NewString("time"), v8::Number::New(isolate->m_isolate, (double)gc.m_time / 1000000)).IsJust();
+    o->Set(context, isolate->NewString("gc"), o1).IsJust();
+
+    o1 = v8::Object::New(isolate->m_isolate);
+    o1->Set(context, isolate->NewString("allocated"), v8::Number::New(isolate->m_isolate, (double)allocated)).IsJust();
+    o1->Set(context, isolate->NewString("allocatedPerOp"), v8::Number::New(isolate->m_isolate, (double)allocated / ((double)n * k))).IsJust();
+    o->Set(context, isolate->NewString("heap"), o1).IsJust();
+
+    char buf[128];
+    exlib::string str("    ");
+
+    str.append(logger::highLight());
+    str.append(name);
+    str.append(COLOR_RESET);
+    str.append(": ");
+    str.append(format_ops(ops));
+    snprintf(buf, sizeof(buf), " ops/sec \xc2\xb1%.2f%% (%d samples)", rme, (int32_t)k);
+    str.append(buf);
+
+    v8::Local<v8::Object> baseline;
+    hr = GetConfigValue(isolate, opts, "baseline", baseline, true);
+    if (hr >= 0) {
+        JSValue v = baseline->Get(context, isolate->NewString(name));
+        if (!v.IsEmpty() && v->IsObject())
+            baseline = v8::Local<v8::Object>::Cast(v);
+
+        double base_ops = 0;
+        double base_rme = 0;
+
+        hr = GetConfigValue(isolate, baseline, "ops", base_ops, true);
+        if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+            return hr;
+
+        if (hr >= 0 && base_ops > 0) {
+            hr = GetConfigValue(isolate, baseline, "rme", base_rme, true);
+            if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+                return hr;
+
+            double diff = (ops - base_ops) / base_ops * 100;
+            bool regression = diff < -threshold && -diff > rme + base_rme;
+
+            o1 = v8::Object::New(isolate->m_isolate);
+            o1->Set(context, isolate->NewString("ops"), v8::Number::New(isolate->m_isolate, base_ops)).IsJust();
+            o1->Set(context, isolate->NewString("diff"), v8::Number::New(isolate->m_isolate, diff)).IsJust();
+            o1->Set(context, isolate->NewString("regression"), v8::Boolean::New(isolate->m_isolate, regression)).IsJust();
+            o->Set(context, isolate->NewString("baseline"), o1).IsJust();
+
+            snprintf(buf, sizeof(buf), " %+.2f%%", diff);
+            if (regression)
+                str.append(logger::error());
+            else if (diff > threshold)
+                str.append(logger::notice());
+            str.append(buf);
+            str.append(COLOR_RESET);
+        }
+    } else if (hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    asyncLog(console_base::C_INFO, str);
+
+    retVal = o;
+
+    return 0;
+}
+}
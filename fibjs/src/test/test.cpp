@@ -491,7 +491,7 @@ private:
     int32_t m_pos = 0;
 };
 
-inline v8::Local<v8::Function> wrapFunction(v8::Local<v8::Function> func)
+v8::Local<v8::Function> wrapFunction(v8::Local<v8::Function> func)
 {
     if (func->IsAsyncFunction())
         util_base::sync(func, true, func);
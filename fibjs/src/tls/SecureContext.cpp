@@ -9,6 +9,7 @@
 #include "ifs/crypto.h"
 #include "SecureContext.h"
 #include "X509Certificate.h"
+#include "TLSSessionCache.h"
 
 namespace fibjs {
 
@@ -72,12 +73,13 @@ void SecureContext::init_ctx(const SSL_METHOD* method)
     SSL_CTX_clear_mode(m_ctx, SSL_MODE_NO_AUTO_CHAIN);
 
     static std::atomic<uint32_t> s_sid_ctx = 1;
-    uint32_t sid_ctx = s_sid_ctx++;
+    m_id = s_sid_ctx++;
 
-    SSL_CTX_set_session_id_context(m_ctx, (const unsigned char*)&sid_ctx, sizeof(sid_ctx));
+    SSL_CTX_set_session_id_context(m_ctx, (const unsigned char*)&m_id, sizeof(m_id));
 
     SSL_CTX_set_session_cache_mode(m_ctx,
         SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL | SSL_SESS_CACHE_NO_AUTO_CLEAR);
+    SSL_CTX_sess_set_new_cb(m_ctx, TLSSessionCache::new_session);
 }
 
 result_t SecureContext::set_ca(v8::Local<v8::Object> options, bool isServer)
@@ -368,6 +370,16 @@ result_t SecureContext::set_secureProtocol(v8::Local<v8::Object> options, bool i
     if (maxVersion)
         SSL_CTX_set_max_proto_version(m_ctx, maxVersion);
 
+    exlib::string ciphers;
+    hr = GetConfigValue(isolate, options, "ciphers", ciphers, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return Runtime::setError("SecureContext: ciphers must be a valid string.");
+
+    if (hr != CALL_E_PARAMNOTOPTIONAL && SSL_CTX_set_cipher_list(m_ctx, ciphers.c_str()) != 1) {
+        ERR_clear_error();
+        return Runtime::setError("SecureContext: ciphers \"" + ciphers + "\" is not supported.");
+    }
+
     return 0;
 }
 
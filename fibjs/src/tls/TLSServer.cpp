@@ -92,6 +92,21 @@ result_t TLSServer::get_socket(obj_ptr<Socket_base>& retVal)
     return m_server->get_socket(retVal);
 }
 
+result_t TLSServer::get_maxConnections(int32_t& retVal)
+{
+    return m_server->get_maxConnections(retVal);
+}
+
+result_t TLSServer::set_maxConnections(int32_t newVal)
+{
+    return m_server->set_maxConnections(newVal);
+}
+
+result_t TLSServer::get_connections(int32_t& retVal)
+{
+    return m_server->get_connections(retVal);
+}
+
 result_t TLSServer::get_handler(obj_ptr<Handler_base>& retVal)
 {
     return m_handler->get_handler(retVal);
@@ -0,0 +1,176 @@
+/*
+ * TLSSessionCache.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "ifs/tls.h"
+#include "TLSSessionCache.h"
+#include "TLSSocket.h"
+#include "Metrics.h"
+#include <time.h>
+
+namespace fibjs {
+
+TLSSessionCache* TLSSessionCache::current()
+{
+    static TLSSessionCache s_cache;
+    return &s_cache;
+}
+
+int32_t TLSSessionCache::new_session(SSL* ssl, SSL_SESSION* sess)
+{
+    if (SSL_is_server(ssl))
+        return 0;
+
+    TLSSocket* sock = (TLSSocket*)SSL_get_app_data(ssl);
+    if (sock == nullptr || sock->m_session_key.empty())
+        return 0;
+
+    return current()->put(sock->m_session_key, sess) ? 1 : 0;
+}
+
+SSL_SESSION* TLSSessionCache::get(const exlib::string& key)
+{
+    SSL_SESSION* sess = nullptr;
+    int64_t now = time(NULL);
+
+    m_lock.lock();
+
+    auto it = m_map.find(key);
+    if (it != m_map.end()) {
+        std::list<entry>::iterator e = it->second;
+
+        if (e->m_expire > now && SSL_SESSION_is_resumable(e->m_sess)) {
+            sess = e->m_sess;
+            if (SSL_SESSION_get_protocol_version(sess) == TLS1_3_VERSION) {
+                e->m_sess = nullptr;
+                erase(e);
+            } else {
+                SSL_SESSION_up_ref(sess);
+                m_lru.splice(m_lru.begin(), m_lru, e);
+            }
+        } else
+            erase(e);
+    }
+
+    m_lock.unlock();
+
+    metrics_tls_session_lookups(sess != nullptr)->inc();
+
+    return sess;
+}
+
+bool TLSSessionCache::put(const exlib::string& key, SSL_SESSION* sess)
+{
+    int64_t now = time(NULL);
+    int64_t expire = SSL_SESSION_get_time(sess) + SSL_SESSION_get_timeout(sess);
+
+    m_lock.lock();
+
+    if (m_size <= 0 || m_timeout <= 0 || expire <= now) {
+        m_lock.unlock();
+        return false;
+    }
+
+    if (expire > now + m_timeout)
+        expire = now + m_timeout;
+
+    auto it = m_map.find(key);
+    if (it != m_map.end())
+        erase(it->second);
+
+    m_lru.push_front({ key, sess, expire });
+    m_map.emplace(key, m_lru.begin());
+    trim();
+
+    m_lock.unlock();
+
+    return true;
+}
+
+void TLSSessionCache::erase(std::list<entry>::iterator it)
+{
+    if (it->m_sess)
+        SSL_SESSION_free(it->m_sess);
+
+    m_map.erase(it->m_key);
+    m_lru.erase(it);
+}
+
+void TLSSessionCache::trim()
+{
+    while ((int32_t)m_lru.size() > m_size)
+        erase(std::prev(m_lru.end()));
+}
+
+int32_t TLSSessionCache::count()
+{
+    m_lock.lock();
+    int32_t n = (int32_t)m_lru.size();
+    m_lock.unlock();
+
+    return n;
+}
+
+int32_t TLSSessionCache::get_size()
+{
+    return m_size;
+}
+
+void TLSSessionCache::set_size(int32_t size)
+{
+    m_lock.lock();
+    m_size = size;
+    trim();
+    m_lock.unlock();
+}
+
+int32_t TLSSessionCache::get_timeout()
+{
+    return m_timeout;
+}
+
+void TLSSessionCache::set_timeout(int32_t timeout)
+{
+    m_lock.lock();
+    m_timeout = timeout;
+    if (m_timeout <= 0)
+        while (!m_lru.empty())
+            erase(m_lru.begin());
+    m_lock.unlock();
+}
+
+result_t tls_base::get_sessionCacheSize(int32_t& retVal)
+{
+    retVal = TLSSessionCache::current()->get_size();
+    return 0;
+}
+
+result_t tls_base::set_sessionCacheSize(int32_t newVal)
+{
+    if (newVal < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    TLSSessionCache::current()->set_size(newVal);
+    return 0;
+}
+
+result_t tls_base::get_sessionCacheTimeout(int32_t& retVal)
+{
+    retVal = TLSSessionCache::current()->get_timeout();
+    return 0;
+}
+
+result_t tls_base::set_sessionCacheTimeout(int32_t newVal)
+{
+    if (newVal < 0)
+        return CHECK_ERROR(CALL_E_OUTRANGE);
+
+    TLSSessionCache::current()->set_timeout(newVal);
+    return 0;
+}
+
+}
@@ -12,8 +12,25 @@
 #include "TLSSocket.h"
 #include "SecureContext.h"
 #include "X509Certificate.h"
+#include "TLSSessionCache.h"
+#include "Metrics.h"
 #include "Buffer.h"
 #include "options.h"
+#include <openssl/kdf.h>
+
+#ifdef Linux
+#include <sys/socket.h>
+#include <netinet/tcp.h>
+#include <linux/tls.h>
+
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#endif
 
 namespace fibjs {
 
@@ -117,6 +134,7 @@ public:
         BIO_set_data(m_sock->m_bio_out, m_sock);
 
         SSL_set_bio(m_sock->m_tls, m_sock->m_bio_in, m_sock->m_bio_out);
+        SSL_set_app_data(m_sock->m_tls, m_sock);
 
         if (is_server)
             SSL_set_accept_state(m_sock->m_tls);
@@ -126,6 +144,8 @@ public:
                 SSL_set1_host(m_sock->m_tls, server_name.c_str());
                 SSL_set_tlsext_host_name(m_sock->m_tls, server_name.c_str());
             }
+
+            resume(socket, server_name);
         }
 
         next(handshake);
@@ -153,6 +173,9 @@ public:
 
         switch (m_state) {
         case SSL_ERROR_NONE:
+            if (!m_sock->m_session_key.empty())
+                metrics_tls_handshakes(SSL_session_reused(m_sock->m_tls))->inc();
+            m_sock->enable_ktls();
             return next();
         case SSL_ERROR_WANT_READ:
             return m_sock->m_stream->read(-1, m_sock->m_in, next(read_ok));
@@ -175,6 +198,40 @@ public:
         return Runtime::setError("socket closed");
     }
 
+private:
+    // offer the cached session of the same server, the new sessions of this
+    // connection are stored under the same key by TLSSessionCache::new_session
+    void resume(Stream_base* socket, exlib::string server_name)
+    {
+        TLSSessionCache* cache = TLSSessionCache::current();
+        if (cache->get_size() == 0 || cache->get_timeout() == 0)
+            return;
+
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%u|", m_sock->m_ctx.As<SecureContext>()->id());
+
+        exlib::string key = buf;
+        obj_ptr<Socket_base> sock = Socket_base::getInstance(socket);
+        if (sock) {
+            exlib::string addr;
+            int32_t port = 0;
+
+            sock->get_remoteAddress(addr);
+            sock->get_remotePort(port);
+            snprintf(buf, sizeof(buf), ":%d", port);
+            key += addr + buf;
+        }
+        key += "|" + server_name;
+
+        m_sock->m_session_key = key;
+
+        SSL_SESSION* sess = cache->get(key);
+        if (sess) {
+            SSL_set_session(m_sock->m_tls, sess);
+            SSL_SESSION_free(sess);
+        }
+    }
+
 public:
     obj_ptr<TLSSocket> m_sock;
     int32_t m_state;
@@ -292,6 +349,157 @@ result_t TLSSocket::get_localPort(int32_t& retVal)
     return sock->get_localPort(retVal);
 }
 
+result_t TLSSocket::get_ktls(bool& retVal)
+{
+    retVal = m_ktls;
+    return 0;
+}
+
+// hand the record encryption of the send direction over to the kernel. only
+// tls 1.2 with aes-gcm is offloaded: the key block can be derived from the
+// session with public api, and the first record under the new keys has been
+// the Finished message, so the sequence number is known to be 1. receiving
+// stays in openssl, kernel rx would turn alerts into read errors.
+void TLSSocket::enable_ktls()
+{
+#ifdef Linux
+    if (SSL_version(m_tls) != TLS1_2_VERSION)
+        return;
+
+    const SSL_CIPHER* cipher = SSL_get_current_cipher(m_tls);
+    if (cipher == nullptr)
+        return;
+
+    int32_t nid = SSL_CIPHER_get_cipher_nid(cipher);
+    size_t key_len;
+
+    if (nid == NID_aes_128_gcm)
+        key_len = TLS_CIPHER_AES_GCM_128_KEY_SIZE;
+    else if (nid == NID_aes_256_gcm)
+        key_len = TLS_CIPHER_AES_GCM_256_KEY_SIZE;
+    else
+        return;
+
+    obj_ptr<Socket_base> sock = Socket_base::getInstance(m_stream);
+    if (!sock)
+        return;
+
+    int32_t fd = -1;
+    if (sock->get_fd(fd) < 0 || fd < 0)
+        return;
+
+    unsigned char master[SSL_MAX_MASTER_KEY_LENGTH];
+    size_t master_len = SSL_SESSION_get_master_key(SSL_get_session(m_tls), master, sizeof(master));
+    if (master_len == 0)
+        return;
+
+    unsigned char seed[SSL3_RANDOM_SIZE * 2];
+    SSL_get_server_random(m_tls, seed, SSL3_RANDOM_SIZE);
+    SSL_get_client_random(m_tls, seed + SSL3_RANDOM_SIZE, SSL3_RANDOM_SIZE);
+
+    // key block of an aead suite: client key, server key, client salt, server salt
+    const size_t salt_len = TLS_CIPHER_AES_GCM_128_SALT_SIZE;
+    unsigned char block[TLS_CIPHER_AES_GCM_256_KEY_SIZE * 2 + TLS_CIPHER_AES_GCM_128_SALT_SIZE * 2];
+    size_t block_len = key_len * 2 + salt_len * 2;
+
+    EVPKeyCtxPointer pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_TLS1_PRF, NULL);
+    bool ok = pctx
+        && EVP_PKEY_derive_init(pctx) > 0
+        && EVP_PKEY_CTX_set_tls1_prf_md(pctx, SSL_CIPHER_get_handshake_digest(cipher)) > 0
+        && EVP_PKEY_CTX_set1_tls1_prf_secret(pctx, master, master_len) > 0
+        && EVP_PKEY_CTX_add1_tls1_prf_seed(pctx, (const unsigned char*)"key expansion", 13) > 0
+        && EVP_PKEY_CTX_add1_tls1_prf_seed(pctx, seed, sizeof(seed)) > 0
+        && EVP_PKEY_derive(pctx, block, &block_len) > 0;
+    OPENSSL_cleanse(master, sizeof(master));
+
+    if (!ok) {
+        ERR_clear_error();
+        OPENSSL_cleanse(block, sizeof(block));
+        return;
+    }
+
+    bool server = SSL_is_server(m_tls);
+    const unsigned char* key = block + (server ? key_len : 0);
+    const unsigned char* salt = block + key_len * 2 + (server ? salt_len : 0);
+
+    // the explicit nonce only has to be unique per key, start it at the
+    // sequence number like openssl does
+    static const unsigned char seq[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+    union {
+        tls12_crypto_info_aes_gcm_128 gcm128;
+        tls12_crypto_info_aes_gcm_256 gcm256;
+    } info;
+    socklen_t info_len;
+
+    memset(&info, 0, sizeof(info));
+    if (key_len == TLS_CIPHER_AES_GCM_128_KEY_SIZE) {
+        info.gcm128.info.version = TLS_1_2_VERSION;
+        info.gcm128.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+        memcpy(info.gcm128.key, key, key_len);
+        memcpy(info.gcm128.salt, salt, salt_len);
+        memcpy(info.gcm128.iv, seq, sizeof(seq));
+        memcpy(info.gcm128.rec_seq, seq, sizeof(seq));
+        info_len = sizeof(info.gcm128);
+    } else {
+        info.gcm256.info.version = TLS_1_2_VERSION;
+        info.gcm256.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+        memcpy(info.gcm256.key, key, key_len);
+        memcpy(info.gcm256.salt, salt, salt_len);
+        memcpy(info.gcm256.iv, seq, sizeof(seq));
+        memcpy(info.gcm256.rec_seq, seq, sizeof(seq));
+        info_len = sizeof(info.gcm256);
+    }
+    OPENSSL_cleanse(block, sizeof(block));
+
+    // a socket with the tls ulp attached but no key installed passes data
+    // through untouched, so a failure of the second call is harmless.
+    if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) == 0
+        && setsockopt(fd, SOL_TLS, TLS_TX, &info, info_len) == 0) {
+        // anything openssl would send from now on is sealed with stale state
+#ifdef SSL_OP_NO_RENEGOTIATION
+        SSL_set_options(m_tls, SSL_OP_NO_RENEGOTIATION);
+#endif
+        m_ktls = true;
+    }
+
+    OPENSSL_cleanse(&info, sizeof(info));
+#endif
+}
+
+void TLSSocket::ktls_close_notify()
+{
+#ifdef Linux
+    obj_ptr<Socket_base> sock = Socket_base::getInstance(m_stream);
+    int32_t fd = -1;
+
+    if (!sock || sock->get_fd(fd) < 0 || fd < 0)
+        return;
+
+    unsigned char alert[2] = { SSL3_AL_WARNING, SSL3_AD_CLOSE_NOTIFY };
+    char cbuf[CMSG_SPACE(sizeof(unsigned char))];
+    struct iovec iov = { alert, sizeof(alert) };
+    struct msghdr msg;
+
+    memset(&msg, 0, sizeof(msg));
+    memset(cbuf, 0, sizeof(cbuf));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cbuf;
+    msg.msg_controllen = sizeof(cbuf);
+
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+    *CMSG_DATA(cmsg) = SSL3_RT_ALERT;
+
+    // best effort, like a close_notify lost on a busy socket
+    ::sendmsg(fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+    SSL_set_shutdown(m_tls, SSL_SENT_SHUTDOWN);
+#endif
+}
+
 result_t TLSSocket::get_fd(int32_t& retVal)
 {
     obj_ptr<Socket_base> sock = Socket_base::getInstance(m_stream);
@@ -398,7 +606,15 @@ result_t TLSSocket::write(Buffer_base* data, AsyncEvent* ac)
     public:
         ON_STATE(AsyncWrite, try_lock)
         {
-            return lock(m_sock->m_write_lock, next(write));
+            return lock(m_sock->m_write_lock, next(m_sock->m_ktls ? direct : write));
+        }
+
+        ON_STATE(AsyncWrite, direct)
+        {
+            if (g_ssldump)
+                outLog(console_base::C_WARN, clean_string((const char*)m_data.As<Buffer>()->data(), m_data.As<Buffer>()->length()));
+
+            return m_sock->m_stream->write(m_data, next());
         }
 
         ON_STATE(AsyncWrite, write)
@@ -478,6 +694,11 @@ result_t TLSSocket::close(AsyncEvent* ac)
             if (m_state != SSL_ERROR_WANT_WRITE)
                 return next();
 
+            if (m_sock->m_ktls) {
+                m_sock->ktls_close_notify();
+                return next();
+            }
+
             m_state = SSL_get_error(m_sock->m_tls, SSL_shutdown(m_sock->m_tls));
             if (m_sock->m_out)
                 return m_sock->m_stream->write(m_sock->m_out, next(write));
@@ -517,6 +738,11 @@ result_t TLSSocket::copyTo(Stream_base* stm, int64_t bytes, int64_t& retVal, Asy
 int TLSSocket::Write(const char* data, int len)
 {
     BIO_clear_retry_flags(m_bio_out);
+
+    // the kernel owns the send state, records from openssl would be garbage
+    if (m_ktls)
+        return len;
+
     if (m_out) {
         BIO_set_retry_write(m_bio_out);
         return 0;
@@ -0,0 +1,614 @@
+/*
+ * SharedCache.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "SharedCache.h"
+#include "Buffer.h"
+#include "ifs/msgpack.h"
+#include <uv/include/uv.h>
+#include <map>
+
+namespace fibjs {
+
+static exlib::spinlock s_storeLock;
+static std::map<exlib::string, obj_ptr<SharedCache::Store>> s_stores;
+
+static inline int64_t now_ms()
+{
+    return (int64_t)(uv_hrtime() / 1000000);
+}
+
+static inline uint64_t key_hash(const exlib::string& key)
+{
+    uint64_t h = (uint64_t)std::hash<exlib::string>()(key);
+
+    h *= 0x9e3779b97f4a7c15ull;
+    return h ^ (h >> 29);
+}
+
+result_t SharedCache_base::_new(exlib::string name, v8::Local<v8::Object> opts,
+    obj_ptr<SharedCache_base>& retVal, v8::Local<v8::Object> This)
+{
+    Isolate* isolate = Isolate::current();
+    result_t hr;
+
+    int64_t maxBytes = 64 * 1024 * 1024;
+    hr = GetConfigValue(isolate, opts, "maxBytes", maxBytes, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+    if (maxBytes <= 0)
+        return CHECK_ERROR(Runtime::setError("SharedCache: maxBytes must be greater than 0."));
+
+    int32_t maxEntries = 0;
+    hr = GetConfigValue(isolate, opts, "maxEntries", maxEntries, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+    if (maxEntries < 0)
+        return CHECK_ERROR(CALL_E_INVALIDARG);
+
+    int32_t timeout = 0;
+    hr = GetConfigValue(isolate, opts, "timeout", timeout, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    int32_t shards = 16;
+    hr = GetConfigValue(isolate, opts, "shards", shards, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+    if (shards < 1 || shards > 1024)
+        return CHECK_ERROR(Runtime::setError("SharedCache: shards must be between 1 and 1024."));
+
+    if (maxEntries > 0 && shards > maxEntries)
+        shards = maxEntries;
+
+    obj_ptr<SharedCache::Store> store;
+
+    s_storeLock.lock();
+    std::map<exlib::string, obj_ptr<SharedCache::Store>>::iterator it = s_stores.find(name);
+    if (it != s_stores.end())
+        store = it->second;
+    else {
+        store = new SharedCache::Store(name, maxBytes, maxEntries, timeout, shards);
+        s_stores.insert(std::pair<exlib::string, obj_ptr<SharedCache::Store>>(name, store));
+    }
+    s_storeLock.unlock();
+
+    retVal = new SharedCache(store);
+    return 0;
+}
+
+void SharedCache::Sketch::init(int64_t width)
+{
+    uint64_t size = 64;
+
+    if (width > (1 << 20))
+        width = 1 << 20;
+    while ((int64_t)size < width)
+        size <<= 1;
+
+    m_table.assign(size * 4, 0);
+    m_mask = size - 1;
+    m_additions = 0;
+    m_sampleSize = (int64_t)size * 10;
+}
+
+uint64_t SharedCache::Sketch::index(uint64_t hash, int32_t i)
+{
+    static const uint64_t seeds[] = {
+        0xc3a5c85c97cb3127ull, 0xb492b66fbe98f273ull,
+        0x9ae16a3b2f90404full, 0xcbf29ce484222325ull
+    };
+
+    uint64_t h = (hash + seeds[i]) * seeds[(i + 1) & 3];
+    return h ^ (h >> 32);
+}
+
+int32_t SharedCache::Sketch::frequency(uint64_t hash) const
+{
+    int32_t freq = 15;
+    uint64_t size = m_mask + 1;
+
+    for (int32_t i = 0; i < 4; i++) {
+        int32_t c = m_table[i * size + (index(hash, i) & m_mask)];
+        if (c < freq)
+            freq = c;
+    }
+
+    return freq;
+}
+
+void SharedCache::Sketch::increment(uint64_t hash)
+{
+    uint64_t size = m_mask + 1;
+    bool added = false;
+
+    for (int32_t i = 0; i < 4; i++) {
+        uint8_t& c = m_table[i * size + (index(hash, i) & m_mask)];
+        if (c < 15) {
+            c++;
+            added = true;
+        }
+    }
+
+    // age the counters so that the sketch follows the recent access pattern.
+    if (added && ++m_additions >= m_sampleSize) {
+        for (size_t i = 0; i < m_table.size(); i++)
+            m_table[i] >>= 1;
+        m_additions /= 2;
+    }
+}
+
+void SharedCache::Shard::init(int64_t maxBytes, int32_t maxEntries)
+{
+    m_maxBytes = maxBytes;
+    m_maxEntries = maxEntries;
+
+    m_windowBytes = maxBytes / 100;
+    m_protectedBytes = (maxBytes - m_windowBytes) * 4 / 5;
+
+    if (maxEntries > 0) {
+        m_windowEntries = maxEntries / 100;
+        if (m_windowEntries < 1)
+            m_windowEntries = 1;
+        m_protectedEntries = (maxEntries - m_windowEntries) * 4 / 5;
+    }
+
+    m_sketch.init(maxEntries > 0 ? maxEntries : maxBytes / 256);
+}
+
+bool SharedCache::Shard::window_full() const
+{
+    if (m_window.m_count <= 1)
+        return false;
+
+    return m_window.m_bytes > m_windowBytes
+        || (m_maxEntries > 0 && m_window.m_count > m_windowEntries);
+}
+
+bool SharedCache::Shard::protected_full() const
+{
+    if (m_protected.m_count == 0)
+        return false;
+
+    return m_protected.m_bytes > m_protectedBytes
+        || (m_maxEntries > 0 && m_protected.m_count > m_protectedEntries);
+}
+
+bool SharedCache::Shard::full() const
+{
+    return m_window.m_bytes + m_probation.m_bytes + m_protected.m_bytes > m_maxBytes
+        || (m_maxEntries > 0 && (int32_t)m_map.size() > m_maxEntries);
+}
+
+void SharedCache::Shard::erase(Entry* e)
+{
+    queue(e->m_queue).remove(e);
+    m_map.erase(e->m_key);
+    delete e;
+}
+
+void SharedCache::Shard::evict(Entry* e)
+{
+    m_evictions++;
+    erase(e);
+}
+
+void SharedCache::Shard::clear()
+{
+    std::unordered_map<exlib::string, Entry*>::iterator it;
+
+    for (it = m_map.begin(); it != m_map.end(); ++it)
+        delete it->second;
+
+    m_map.clear();
+    m_window.clear();
+    m_probation.clear();
+    m_protected.clear();
+}
+
+void SharedCache::Shard::touch(Entry* e)
+{
+    Queue& q = queue(e->m_queue);
+
+    q.remove(e);
+    if (e->m_queue == kProbation) {
+        e->m_queue = kProtected;
+        m_protected.push_front(e);
+
+        while (protected_full()) {
+            Entry* d = m_protected.m_tail;
+
+            m_protected.remove(d);
+            d->m_queue = kProbation;
+            m_probation.push_front(d);
+        }
+    } else
+        q.push_front(e);
+}
+
+void SharedCache::Shard::admit()
+{
+    while (window_full()) {
+        Entry* c = m_window.m_tail;
+
+        m_window.remove(c);
+        c->m_queue = kProbation;
+        m_probation.push_front(c);
+
+        while (full()) {
+            Entry* v = m_probation.m_tail;
+            if (v == c)
+                v = m_protected.m_tail;
+
+            if (v == NULL) {
+                evict(c);
+                break;
+            }
+
+            // TinyLFU: the candidate leaving the window only replaces the main
+            // victim when it has been seen more often.
+            if (m_sketch.frequency(c->m_hash) > m_sketch.frequency(v->m_hash))
+                evict(v);
+            else {
+                m_rejections++;
+                erase(c);
+                break;
+            }
+        }
+    }
+
+    while (full()) {
+        Entry* v = m_probation.m_tail;
+        if (v == NULL)
+            v = m_protected.m_tail;
+        if (v == NULL)
+            v = m_window.m_tail;
+
+        evict(v);
+    }
+}
+
+SharedCache::Entry* SharedCache::Shard::find(const exlib::string& key, uint64_t hash, int64_t now, bool touch)
+{
+    if (touch)
+        m_sketch.increment(hash);
+
+    std::unordered_map<exlib::string, Entry*>::iterator it = m_map.find(key);
+    if (it == m_map.end())
+        return NULL;
+
+    Entry* e = it->second;
+    if (e->m_expire && e->m_expire <= now) {
+        m_expirations++;
+        erase(e);
+        return NULL;
+    }
+
+    if (touch)
+        this->touch(e);
+
+    return e;
+}
+
+bool SharedCache::Shard::put(const exlib::string& key, uint64_t hash, int32_t type, exlib::string& value,
+    int64_t expire, bool replace)
+{
+    std::unordered_map<exlib::string, Entry*>::iterator it = m_map.find(key);
+    Entry* e;
+
+    m_sketch.increment(hash);
+
+    if (it != m_map.end()) {
+        e = it->second;
+        if (!replace)
+            return true;
+
+        queue(e->m_queue).remove(e);
+    } else {
+        e = new Entry(key, hash);
+        m_map.insert(std::pair<exlib::string, Entry*>(key, e));
+    }
+
+    e->m_type = type;
+    e->m_value.swap(value);
+    e->m_expire = expire;
+    queue(e->m_queue).push_front(e);
+
+    if (e->bytes() > m_maxBytes) {
+        m_rejections++;
+        erase(e);
+        return false;
+    }
+
+    admit();
+    return true;
+}
+
+SharedCache::Store::Store(exlib::string name, int64_t maxBytes, int32_t maxEntries, int32_t timeout, int32_t shards)
+    : m_name(name)
+    , m_timeout(timeout)
+    , m_shards(shards)
+{
+    int64_t shardBytes = (maxBytes + shards - 1) / shards;
+    int32_t shardEntries = maxEntries > 0 ? (maxEntries + shards - 1) / shards : 0;
+
+    for (int32_t i = 0; i < shards; i++)
+        m_shards[i].init(shardBytes, shardEntries);
+}
+
+result_t SharedCache::encode(v8::Local<v8::Value> value, int32_t& type, exlib::string& data)
+{
+    if (value->IsString() || value->IsStringObject()) {
+        type = kString;
+        data = holder()->toString(value);
+        return 0;
+    }
+
+    Buffer* buf = Buffer::getInstance(value);
+    if (buf) {
+        type = kBuffer;
+        data.assign((const char*)buf->data(), buf->length());
+        return 0;
+    }
+
+    obj_ptr<Buffer_base> packed;
+    result_t hr = msgpack_base::encode(value, packed);
+    if (hr < 0)
+        return hr;
+
+    Buffer* _packed = Buffer::Cast(packed);
+    type = kPacked;
+    data.assign((const char*)_packed->data(), _packed->length());
+    return 0;
+}
+
+result_t SharedCache::decode(int32_t type, const exlib::string& data, v8::Local<v8::Value>& retVal)
+{
+    Isolate* isolate = holder();
+
+    if (type == kString) {
+        retVal = isolate->NewString(data);
+        return 0;
+    }
+
+    obj_ptr<Buffer_base> buf = new Buffer(data.c_str(), data.length());
+    if (type == kBuffer) {
+        retVal = GetReturnValue(isolate, buf);
+        return 0;
+    }
+
+    return msgpack_base::decode(buf, retVal);
+}
+
+result_t SharedCache::store(exlib::string& name, uint64_t hash, v8::Local<v8::Value> value,
+    int32_t timeout, bool replace)
+{
+    int32_t type;
+    exlib::string data;
+    result_t hr;
+
+    hr = encode(value, type, data);
+    if (hr < 0)
+        return hr;
+
+    if (timeout < 0)
+        timeout = m_store->m_timeout;
+
+    int64_t expire = timeout > 0 ? now_ms() + timeout : 0;
+    Shard& shard = m_store->shard(hash);
+
+    shard.m_lock.lock();
+    shard.put(name, hash, type, data, expire, replace);
+    shard.m_lock.unlock();
+
+    return 0;
+}
+
+result_t SharedCache::get_name(exlib::string& retVal)
+{
+    retVal = m_store->m_name;
+    return 0;
+}
+
+result_t SharedCache::get_size(int32_t& retVal)
+{
+    retVal = 0;
+
+    for (size_t i = 0; i < m_store->m_shards.size(); i++) {
+        Shard& shard = m_store->m_shards[i];
+
+        shard.m_lock.lock();
+        retVal += (int32_t)shard.m_map.size();
+        shard.m_lock.unlock();
+    }
+
+    return 0;
+}
+
+result_t SharedCache::get_bytes(int64_t& retVal)
+{
+    retVal = 0;
+
+    for (size_t i = 0; i < m_store->m_shards.size(); i++) {
+        Shard& shard = m_store->m_shards[i];
+
+        shard.m_lock.lock();
+        retVal += shard.m_window.m_bytes + shard.m_probation.m_bytes + shard.m_protected.m_bytes;
+        shard.m_lock.unlock();
+    }
+
+    return 0;
+}
+
+result_t SharedCache::get_stats(v8::Local<v8::Object>& retVal)
+{
+    Isolate* isolate = holder();
+    v8::Local<v8::Context> context = isolate->context();
+    v8::Local<v8::Object> o = v8::Object::New(isolate->m_isolate);
+    int64_t size = 0, bytes = 0, hits = 0, misses = 0, evictions = 0;
+    int64_t rejections = 0, expirations = 0, loads = 0, waits = 0;
+
+    for (size_t i = 0; i < m_store->m_shards.size(); i++) {
+        Shard& shard = m_store->m_shards[i];
+
+        shard.m_lock.lock();
+        size += shard.m_map.size();
+        bytes += shard.m_window.m_bytes + shard.m_probation.m_bytes + shard.m_protected.m_bytes;
+        hits += shard.m_hits;
+        misses += shard.m_misses;
+        evictions += shard.m_evictions;
+        rejections += shard.m_rejections;
+        expirations += shard.m_expirations;
+        loads += shard.m_loads;
+        waits += shard.m_waits;
+        shard.m_lock.unlock();
+    }
+
+    o->Set(context, isolate->NewString("size"), v8::Number::New(isolate->m_isolate, (double)size)).IsJust();
+    o->Set(context, isolate->NewString("bytes"), v8::Number::New(isolate->m_isolate, (double)bytes)).IsJust();
+    o->Set(context, isolate->NewString("hits"), v8::Number::New(isolate->m_isolate, (double)hits)).IsJust();
+    o->Set(context, isolate->NewString("misses"), v8::Number::New(isolate->m_isolate, (double)misses)).IsJust();
+    o->Set(context, isolate->NewString("evictions"), v8::Number::New(isolate->m_isolate, (double)evictions)).IsJust();
+    o->Set(context, isolate->NewString("rejections"), v8::Number::New(isolate->m_isolate, (double)rejections)).IsJust();
+    o->Set(context, isolate->NewString("expirations"), v8::Number::New(isolate->m_isolate, (double)expirations)).IsJust();
+    o->Set(context, isolate->NewString("loads"), v8::Number::New(isolate->m_isolate, (double)loads)).IsJust();
+    o->Set(context, isolate->NewString("waits"), v8::Number::New(isolate->m_isolate, (double)waits)).IsJust();
+
+    retVal = o;
+    return 0;
+}
+
+result_t SharedCache::clear()
+{
+    for (size_t i = 0; i < m_store->m_shards.size(); i++) {
+        Shard& shard = m_store->m_shards[i];
+
+        shard.m_lock.lock();
+        shard.clear();
+        shard.m_lock.unlock();
+    }
+
+    return 0;
+}
+
+result_t SharedCache::has(exlib::string name, bool& retVal)
+{
+    uint64_t hash = key_hash(name);
+    Shard& shard = m_store->shard(hash);
+
+    shard.m_lock.lock();
+    retVal = shard.find(name, hash, now_ms(), false) != NULL;
+    shard.m_lock.unlock();
+
+    return 0;
+}
+
+result_t SharedCache::get(exlib::string name, v8::Local<v8::Value>& retVal)
+{
+    return get(name, v8::Local<v8::Function>(), retVal);
+}
+
+result_t SharedCache::get(exlib::string name, v8::Local<v8::Function> updater,
+    v8::Local<v8::Value>& retVal)
+{
+    Isolate* isolate = holder();
+    uint64_t hash = key_hash(name);
+    Shard& shard = m_store->shard(hash);
+    result_t hr;
+
+    while (true) {
+        obj_ptr<Loader> loader;
+        bool found = false;
+        bool wait = false;
+        int32_t type = kString;
+        exlib::string data;
+
+        shard.m_lock.lock();
+        Entry* e = shard.find(name, hash, now_ms(), true);
+        if (e) {
+            shard.m_hits++;
+            type = e->m_type;
+            data = e->m_value;
+            found = true;
+        } else {
+            shard.m_misses++;
+
+            if (!updater.IsEmpty()) {
+                std::unordered_map<exlib::string, obj_ptr<Loader>>::iterator it = shard.m_loading.find(name);
+                if (it != shard.m_loading.end()) {
+                    loader = it->second;
+                    shard.m_waits++;
+                    wait = true;
+                } else {
+                    loader = new Loader();
+                    shard.m_loading.insert(std::pair<exlib::string, obj_ptr<Loader>>(name, loader));
+                    shard.m_loads++;
+                }
+            }
+        }
+        shard.m_lock.unlock();
+
+        if (found)
+            return decode(type, data, retVal);
+
+        if (updater.IsEmpty())
+            return 0;
+
+        if (wait) {
+            Isolate::LeaveJsScope _rt(isolate);
+            loader->m_ready.wait();
+            if (_rt.is_terminating())
+                return CALL_E_TIMEOUT;
+            continue;
+        }
+
+        v8::Local<v8::Value> a = isolate->NewString(name);
+        v8::Local<v8::Value> v = updater->Call(updater->GetCreationContextChecked(), wrap(), 1, &a)
+                                     .FromMaybe(v8::Local<v8::Value>());
+
+        hr = 0;
+        if (v.IsEmpty())
+            hr = CALL_E_JAVASCRIPT;
+        else if (!IsEmpty(v))
+            hr = store(name, hash, v, -1, false);
+
+        shard.m_lock.lock();
+        shard.m_loading.erase(name);
+        shard.m_lock.unlock();
+        loader->m_ready.set();
+
+        if (hr < 0)
+            return hr;
+
+        retVal = v;
+        return 0;
+    }
+}
+
+result_t SharedCache::set(exlib::string name, v8::Local<v8::Value> value, int32_t timeout)
+{
+    if (value->IsUndefined())
+        return remove(name);
+
+    return store(name, key_hash(name), value, timeout, true);
+}
+
+result_t SharedCache::remove(exlib::string name)
+{
+    uint64_t hash = key_hash(name);
+    Shard& shard = m_store->shard(hash);
+
+    shard.m_lock.lock();
+    Entry* e = shard.find(name, hash, 0, false);
+    if (e)
+        shard.erase(e);
+    shard.m_lock.unlock();
+
+    return 0;
+}
+
+} /* namespace fibjs */
@@ -0,0 +1,190 @@
+/*
+ * util_bundle.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "ifs/util.h"
+#include "Buffer.h"
+#include "Bundle.h"
+#include "SandBox.h"
+#include <unordered_set>
+#include <vector>
+
+namespace fibjs {
+
+class bundle_entry {
+public:
+    exlib::string m_name;
+    int32_t m_kind;
+    exlib::string m_data;
+    uint64_t m_offset;
+    uint64_t m_size;
+};
+
+// the code cache of a module as js_Loader compiles it
+static result_t code_cache(Isolate* isolate, exlib::string name, exlib::string script, exlib::string& retVal)
+{
+    if (script.length() > 2 && script.c_str()[0] == '#' && script.c_str()[1] == '!') {
+        char* _script = script.data();
+        _script[0] = '/';
+        _script[1] = '/';
+    }
+
+    script = SandBox::module_args + ("\n" + script) + "\n});";
+
+    TryCatch try_catch;
+
+    v8::ScriptCompiler::Source script_source(isolate->NewString(script),
+        v8::ScriptOrigin(isolate->m_isolate, isolate->NewString(name), -1));
+
+    v8::Local<v8::UnboundScript> ubs = v8::ScriptCompiler::CompileUnboundScript(
+        isolate->m_isolate, &script_source,
+        v8::ScriptCompiler::kEagerCompile)
+                                           .FromMaybe(v8::Local<v8::UnboundScript>());
+
+    if (ubs.IsEmpty())
+        return throwSyntaxError(try_catch);
+
+    const v8::ScriptCompiler::CachedData* cache = v8::ScriptCompiler::CreateCodeCache(ubs);
+    retVal.assign((const char*)cache->data, cache->length);
+    delete cache;
+
+    return 0;
+}
+
+static void align(exlib::string& buf)
+{
+    static const char zero[8] = { 0 };
+    buf.append(zero, (8 - (buf.length() & 7)) & 7);
+}
+
+result_t util_base::bundle(v8::Local<v8::Object> files, v8::Local<v8::Object> opts, obj_ptr<Buffer_base>& retVal)
+{
+    Isolate* isolate = Isolate::current();
+    v8::Local<v8::Context> context = isolate->context();
+    result_t hr;
+
+    bool codeCache = true;
+    hr = GetConfigValue(isolate, opts, "codeCache", codeCache, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    std::vector<bundle_entry> entries;
+    std::unordered_set<exlib::string> names;
+
+    JSArray keys = files->GetOwnPropertyNames(context);
+    int32_t len = keys->Length();
+
+    for (int32_t i = 0; i < len; i++) {
+        JSValue k = keys->Get(context, i);
+        JSValue v = files->Get(context, k);
+        bundle_entry e;
+
+        e.m_name = isolate->toString(k);
+        e.m_kind = Bundle::kFile;
+
+        // names are relative, with '/' between the parts
+        char* p = e.m_name.data();
+        for (size_t j = 0; j < e.m_name.length(); j++)
+            if (p[j] == '\\')
+                p[j] = '/';
+        while (e.m_name.length() > 0 && e.m_name[0] == '/')
+            e.m_name = e.m_name.substr(1);
+        while (e.m_name.length() > 1 && e.m_name[0] == '.' && e.m_name[1] == '/')
+            e.m_name = e.m_name.substr(2);
+
+        if (e.m_name.empty() || e.m_name.length() > 0xffff)
+            return CHECK_ERROR(Runtime::setError("util.bundle: invalid file name '" + isolate->toString(k) + "'."));
+        if (!names.insert(e.m_name).second)
+            return CHECK_ERROR(Runtime::setError("util.bundle: duplicate file name '" + e.m_name + "'."));
+
+        Buffer* buf = Buffer::getInstance(v);
+        if (buf)
+            e.m_data.assign((const char*)buf->data(), buf->length());
+        else if (v->IsString() || v->IsStringObject())
+            e.m_data = isolate->toString(v);
+        else
+            return CHECK_ERROR(Runtime::setError("util.bundle: content of '" + e.m_name + "' must be a String or Buffer."));
+
+        entries.push_back(e);
+
+        if (codeCache && e.m_name.length() > 3 && e.m_name.substr(e.m_name.length() - 3) == ".js") {
+            bundle_entry c;
+
+            c.m_name = e.m_name;
+            c.m_kind = Bundle::kCodeCache;
+            hr = code_cache(isolate, e.m_name, e.m_data, c.m_data);
+            if (hr < 0)
+                return hr;
+
+            entries.push_back(c);
+        }
+    }
+
+    uint32_t slots = 8;
+    while (slots < entries.size() * 2)
+        slots <<= 1;
+
+    exlib::string data;
+    for (size_t i = 0; i < entries.size(); i++) {
+        bundle_entry& e = entries[i];
+
+        e.m_offset = data.length();
+        e.m_size = e.m_data.length();
+        data.append(e.m_data);
+        e.m_data.clear();
+        align(data);
+    }
+
+    // a code cache shares the name of the file before it
+    uint64_t index_offset = data.length();
+    uint64_t name_offset = 0;
+    std::vector<Bundle::Slot> index(slots);
+    exlib::string name_data;
+
+    memset(index.data(), 0, slots * sizeof(Bundle::Slot));
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        bundle_entry& e = entries[i];
+
+        if (e.m_kind == Bundle::kFile) {
+            name_offset = index_offset + slots * sizeof(Bundle::Slot) + name_data.length();
+            if (name_offset + e.m_name.length() > 0xffffffffull)
+                return CHECK_ERROR(Runtime::setError("util.bundle: bundle is too large."));
+            name_data.append(e.m_name);
+        }
+
+        uint64_t h = Bundle::hash(e.m_name.c_str(), e.m_name.length());
+        uint32_t pos = (uint32_t)h & (slots - 1);
+        while (index[pos].kind != Bundle::kEmpty)
+            pos = (pos + 1) & (slots - 1);
+
+        Bundle::Slot& slot = index[pos];
+        slot.hash = h;
+        slot.offset = e.m_offset;
+        slot.size = e.m_size;
+        slot.name_offset = (uint32_t)name_offset;
+        slot.name_length = (uint16_t)e.m_name.length();
+        slot.kind = (uint8_t)e.m_kind;
+    }
+
+    data.append((const char*)index.data(), slots * sizeof(Bundle::Slot));
+    data.append(name_data);
+    align(data);
+
+    Bundle::Trailer t;
+    memcpy(t.magic, Bundle::magic, sizeof(t.magic));
+    t.version = Bundle::version;
+    t.slots = slots;
+    t.index_offset = index_offset;
+    t.size = data.length() + sizeof(t);
+    data.append((const char*)&t, sizeof(t));
+
+    retVal = new Buffer(data.c_str(), data.length());
+    return 0;
+}
+
+} /* namespace fibjs */
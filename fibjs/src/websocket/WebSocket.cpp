@@ -16,14 +16,13 @@
 #include "encoding.h"
 #include "MemoryStream.h"
 #include "HttpClient.h"
+#include "Metrics.h"
 #include <stdlib.h>
 
 namespace fibjs {
 
 DECLARE_MODULE(ws);
 
-#define WS_DEFALTE_BUF_SIZE (32 * 1024)
-
 result_t http_request2(HttpClient_base* httpClient, exlib::string method, exlib::string url,
     SeekableStream_base* body, NObject* headers,
     obj_ptr<HttpResponse_base>& retVal, AsyncEvent* ac);
@@ -92,8 +91,22 @@ public:
         next(start);
     }
 
+    asyncSend(WebSocket* pThis, Buffer_base* frame, bool deflated)
+        : AsyncState(NULL)
+        , m_this(pThis)
+        , m_type(ws_base::C_BINARY)
+        , m_frame(frame)
+        , m_deflated(deflated)
+    {
+        m_this->m_ioState.inc();
+        next(start);
+    }
+
     ~asyncSend()
     {
+        if (m_frame)
+            m_this->m_frameBuffered -= Buffer::Cast(m_frame)->length();
+
         m_this->m_lockSend.unlock(this);
         m_this->free_mem();
     }
@@ -113,8 +126,13 @@ public:
         if (!m_this->m_buffer)
             m_this->m_buffer = new MemoryStream();
 
-        if (m_this->m_compress && !m_this->m_deflate)
-            m_this->m_deflate = new defraw(NULL);
+        if (m_frame) {
+            // the peer window now holds data our deflater has never seen
+            if (m_deflated)
+                m_this->m_deflate.Release();
+
+            return m_this->m_buffer->write(m_frame, next(encode_ok));
+        }
 
         return m_msg->sendTo(m_this->m_buffer, m_this, next(encode_ok));
     }
@@ -173,6 +191,8 @@ private:
     obj_ptr<SeekableStream_base> m_buffer;
     int32_t m_type;
     int64_t m_size;
+    obj_ptr<Buffer_base> m_frame;
+    bool m_deflated = false;
 };
 
 result_t WebSocket_base::_new(exlib::string url, exlib::string protocol,
@@ -230,8 +250,10 @@ result_t WebSocket_base::_new(exlib::string url, v8::Local<v8::Object> opts,
             m_headers->add("Connection", "Upgrade");
             m_headers->add("Sec-WebSocket-Version", "13");
 
-            if (m_this->m_enableCompress)
-                m_headers->add("Sec-WebSocket-Extensions", "permessage-deflate");
+            if (m_this->m_enableCompress) {
+                m_this->m_deflateOpts = m_this->m_deflateOpts.bounded();
+                m_headers->add("Sec-WebSocket-Extensions", m_this->m_deflateOpts.offer());
+            }
 
             if (!m_this->m_origin.empty())
                 m_headers->add("Origin", m_this->m_origin);
@@ -309,8 +331,16 @@ result_t WebSocket_base::_new(exlib::string url, v8::Local<v8::Object> opts,
             if (hr < 0)
                 return hr;
 
-            if (hr != CALL_RETURN_NULL && m_this->m_enableCompress && !qstricmp(v.c_str(), "permessage-deflate", 18))
-                m_this->enableCompress();
+            if (hr != CALL_RETURN_NULL && m_this->m_enableCompress) {
+                WebSocketDeflate agreed;
+
+                if (!m_this->m_deflateOpts.parse(v, agreed)) {
+                    m_this->endConnect(1002, "invalid Sec-WebSocket-Extensions header.");
+                    return CHECK_ERROR(Runtime::setError("websocket: invalid Sec-WebSocket-Extensions header."));
+                }
+
+                m_this->enableCompress(agreed);
+            }
 
             m_httprep->get_stream(m_this->m_stream);
 
@@ -343,22 +373,28 @@ result_t WebSocket_base::_new(exlib::string url, v8::Local<v8::Object> opts,
     exlib::string origin = "";
     exlib::string protocol = "";
     bool perMessageDeflate = false;
+    WebSocketDeflate deflateOpts;
     int32_t maxPayload = WS_DEF_SIZE;
     v8::Local<v8::Object> v;
     obj_ptr<NObject> headers = new NObject();
     obj_ptr<HttpClient_base> hc = NULL;
+    result_t hr;
 
     GetConfigValue(isolate, opts, "protocol", protocol);
     GetConfigValue(isolate, opts, "origin", origin);
-    GetConfigValue(isolate, opts, "perMessageDeflate", perMessageDeflate);
     GetConfigValue(isolate, opts, "maxPayload", maxPayload);
 
+    hr = WebSocketDeflate::load(isolate, opts, perMessageDeflate, deflateOpts);
+    if (hr < 0)
+        return hr;
+
     if (GetConfigValue(isolate, opts, "headers", v) >= 0)
         headers->add(v);
 
     GetConfigValue(isolate, opts, "httpClient", hc);
 
     obj_ptr<WebSocket> sock = new WebSocket(url, protocol, origin, perMessageDeflate, maxPayload);
+    sock->m_deflateOpts = deflateOpts;
     sock->m_holder = new ValueHolder(sock->wrap(This));
 
     (new asyncConnect(sock, headers, hc, sock->holder()))->apost(0);
@@ -390,8 +426,8 @@ void WebSocket::free_mem()
 
         m_holder.Release();
 
-        if (m_compress)
-            extMemory(-WS_DEFALTE_BUF_SIZE);
+        if (m_compressMemory)
+            extMemory(-(int32_t)m_compressMemory);
     }
 }
 
@@ -417,9 +453,6 @@ void WebSocket::startRecv(Isolate* isolate)
 
         ON_STATE(asyncRead, recv)
         {
-            if (m_this->m_compress && !m_this->m_inflate)
-                m_this->m_inflate = new infraw(NULL, m_this->m_maxSize);
-
             m_msg = new WebSocketMessage(ws_base::C_TEXT, false, false, m_this->m_maxSize);
             return m_msg->readFrom(m_this->m_stream, m_this, next(event));
         }
@@ -535,11 +568,76 @@ void WebSocket::endConnect(SeekableStream_base* body)
     endConnect(code, reason);
 }
 
-void WebSocket::enableCompress()
+void WebSocket::enableCompress(const WebSocketDeflate& agreed)
 {
     m_compress = true;
     m_flushTail = new Buffer("\x0\x0\xff\xff", 4);
-    extMemory(WS_DEFALTE_BUF_SIZE);
+
+    if (m_masked) {
+        m_deflateBits = agreed.client_max_window_bits;
+        m_inflateBits = agreed.server_max_window_bits;
+        m_deflateTakeover = !agreed.client_no_context_takeover;
+        m_inflateTakeover = !agreed.server_no_context_takeover;
+    } else {
+        m_deflateBits = agreed.server_max_window_bits;
+        m_inflateBits = agreed.client_max_window_bits;
+        m_deflateTakeover = !agreed.server_no_context_takeover;
+        m_inflateTakeover = !agreed.client_no_context_takeover;
+    }
+
+    // only the state kept between messages belongs to the socket
+    if (m_deflateTakeover)
+        m_compressMemory += WebSocketZlib::state_size(m_deflateBits, true);
+    if (m_inflateTakeover)
+        m_compressMemory += WebSocketZlib::state_size(m_inflateBits, false);
+
+    if (m_compressMemory)
+        extMemory((int32_t)m_compressMemory);
+}
+
+obj_ptr<ws_defraw> WebSocket::borrowDeflate()
+{
+    if (m_deflate)
+        return m_deflate;
+
+    if (m_deflateTakeover) {
+        if (WebSocketZlib::reserve(WebSocketZlib::state_size(m_deflateBits, true))) {
+            m_deflate = new ws_defraw(m_deflateBits);
+            return m_deflate;
+        }
+
+        // sending without context takeover is always allowed
+        metrics_ws_compress_fallbacks()->inc();
+    }
+
+    return WebSocketZlib::deflater(m_deflateBits);
+}
+
+void WebSocket::returnDeflate(ws_defraw* zs)
+{
+    if (zs == m_deflate)
+        zs->attach(NULL);
+    else
+        WebSocketZlib::release(zs);
+}
+
+obj_ptr<ws_infraw> WebSocket::borrowInflate()
+{
+    if (!m_inflateTakeover)
+        return WebSocketZlib::inflater(m_inflateBits, m_maxSize);
+
+    if (!m_inflate)
+        m_inflate = new ws_infraw(m_inflateBits, m_maxSize);
+
+    return m_inflate;
+}
+
+void WebSocket::returnInflate(ws_infraw* zs)
+{
+    if (zs == m_inflate)
+        zs->attach(NULL);
+    else
+        WebSocketZlib::release(zs);
 }
 
 result_t WebSocket::get_url(exlib::string& retVal)
@@ -608,6 +706,12 @@ result_t WebSocket::send(Buffer_base* data)
     return 0;
 }
 
+void WebSocket::sendFrame(Buffer_base* frame, bool deflated)
+{
+    m_frameBuffered += Buffer::Cast(frame)->length();
+    (new asyncSend(this, frame, deflated))->post(0);
+}
+
 result_t WebSocket::ref(obj_ptr<WebSocket_base>& retVal)
 {
     isolate_ref();
@@ -0,0 +1,418 @@
+/*
+ * WebSocketDeflate.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "ifs/ws.h"
+#include "WebSocketDeflate.h"
+#include <stdlib.h>
+#include <vector>
+
+namespace fibjs {
+
+#define WS_POOL_SIZE 64
+
+std::atomic<int64_t> WebSocketZlib::s_deflate_memory(0);
+std::atomic<int64_t> WebSocketZlib::s_inflate_memory(0);
+std::atomic<int64_t> WebSocketZlib::s_pooled(0);
+std::atomic<int64_t> WebSocketZlib::s_limit(0);
+
+static exlib::spinlock s_lock;
+static std::vector<obj_ptr<ws_defraw>> s_deflaters[16];
+static std::vector<obj_ptr<ws_infraw>> s_inflaters[16];
+
+static voidpf ws_zalloc(voidpf opaque, uInt items, uInt size)
+{
+    int64_t sz = (int64_t)items * size;
+    int64_t* p = (int64_t*)malloc(sz + 16);
+    if (p == NULL)
+        return Z_NULL;
+
+    p[0] = sz;
+    *(std::atomic<int64_t>*)opaque += sz;
+
+    return p + 2;
+}
+
+static void ws_zfree(voidpf opaque, voidpf address)
+{
+    int64_t* p = (int64_t*)address - 2;
+
+    *(std::atomic<int64_t>*)opaque -= p[0];
+    free(p);
+}
+
+ws_defraw::ws_defraw(int32_t bits)
+    : def_base(NULL)
+    , m_bits(bits)
+{
+    strm.zalloc = ws_zalloc;
+    strm.zfree = ws_zfree;
+    strm.opaque = &WebSocketZlib::s_deflate_memory;
+
+    deflateInit2(&strm, -1, Z_DEFLATED, -bits, 8, 0);
+}
+
+ws_infraw::ws_infraw(int32_t bits, int32_t maxSize)
+    : inf_base(NULL, maxSize)
+    , m_bits(bits)
+{
+    strm.zalloc = ws_zalloc;
+    strm.zfree = ws_zfree;
+    strm.opaque = &WebSocketZlib::s_inflate_memory;
+
+    inflateInit2(&strm, -bits);
+}
+
+obj_ptr<ws_defraw> WebSocketZlib::deflater(int32_t bits)
+{
+    obj_ptr<ws_defraw> zs;
+
+    s_lock.lock();
+    std::vector<obj_ptr<ws_defraw>>& pool = s_deflaters[bits];
+    if (!pool.empty()) {
+        zs = pool.back();
+        pool.pop_back();
+        s_pooled--;
+    }
+    s_lock.unlock();
+
+    if (!zs)
+        zs = new ws_defraw(bits);
+
+    return zs;
+}
+
+obj_ptr<ws_infraw> WebSocketZlib::inflater(int32_t bits, int32_t maxSize)
+{
+    obj_ptr<ws_infraw> zs;
+
+    s_lock.lock();
+    std::vector<obj_ptr<ws_infraw>>& pool = s_inflaters[bits];
+    if (!pool.empty()) {
+        zs = pool.back();
+        pool.pop_back();
+        s_pooled--;
+    }
+    s_lock.unlock();
+
+    if (zs)
+        zs->reset(maxSize);
+    else
+        zs = new ws_infraw(bits, maxSize);
+
+    return zs;
+}
+
+void WebSocketZlib::release(ws_defraw* zs)
+{
+    zs->reset();
+
+    // an idle stream is only kept while the budget has room for it
+    if (!reserve(0))
+        return;
+
+    s_lock.lock();
+    std::vector<obj_ptr<ws_defraw>>& pool = s_deflaters[zs->m_bits];
+    if (pool.size() < WS_POOL_SIZE) {
+        pool.push_back(zs);
+        s_pooled++;
+    }
+    s_lock.unlock();
+}
+
+void WebSocketZlib::release(ws_infraw* zs)
+{
+    zs->attach(NULL);
+
+    if (!reserve(0))
+        return;
+
+    s_lock.lock();
+    std::vector<obj_ptr<ws_infraw>>& pool = s_inflaters[zs->m_bits];
+    if (pool.size() < WS_POOL_SIZE) {
+        pool.push_back(zs);
+        s_pooled++;
+    }
+    s_lock.unlock();
+}
+
+bool WebSocketZlib::reserve(int64_t size)
+{
+    int64_t limit = s_limit;
+    if (limit <= 0)
+        return true;
+
+    return s_deflate_memory + s_inflate_memory + size <= limit;
+}
+
+WebSocketDeflate WebSocketDeflate::bounded() const
+{
+    WebSocketDeflate opts = *this;
+
+    // no room for state that lives as long as the connection, so ask for
+    // every message to be compressed on its own
+    if (!WebSocketZlib::reserve(WebSocketZlib::state_size(server_max_window_bits, true)
+            + WebSocketZlib::state_size(client_max_window_bits, false))) {
+        opts.server_no_context_takeover = true;
+        opts.client_no_context_takeover = true;
+    }
+
+    return opts;
+}
+
+static result_t load_bits(Isolate* isolate, v8::Local<v8::Object> o, const char* key, int32_t& bits)
+{
+    result_t hr = GetConfigValue(isolate, o, key, bits, true);
+    if (hr == CALL_E_PARAMNOTOPTIONAL)
+        return 0;
+    if (hr < 0)
+        return hr;
+
+    if (bits < 9 || bits > 15)
+        return CHECK_ERROR(Runtime::setError(exlib::string("ws: ") + key + " must be between 9 and 15."));
+
+    return 0;
+}
+
+result_t WebSocketDeflate::load(Isolate* isolate, v8::Local<v8::Object> opts, bool& enable, WebSocketDeflate& retVal)
+{
+    v8::Local<v8::Object> o;
+    result_t hr;
+
+    GetConfigValue(isolate, opts, "perMessageDeflate", enable);
+    if (GetConfigValue(isolate, opts, "perMessageDeflate", o, true) < 0)
+        return 0;
+
+    GetConfigValue(isolate, o, "serverNoContextTakeover", retVal.server_no_context_takeover);
+    GetConfigValue(isolate, o, "clientNoContextTakeover", retVal.client_no_context_takeover);
+
+    hr = load_bits(isolate, o, "serverMaxWindowBits", retVal.server_max_window_bits);
+    if (hr < 0)
+        return hr;
+
+    return load_bits(isolate, o, "clientMaxWindowBits", retVal.client_max_window_bits);
+}
+
+static exlib::string trim(exlib::string s)
+{
+    size_t b = 0, e = s.length();
+
+    while (b < e && (s[b] == ' ' || s[b] == '\t'))
+        b++;
+    while (e > b && (s[e - 1] == ' ' || s[e - 1] == '\t'))
+        e--;
+
+    return s.substr(b, e - b);
+}
+
+static void split(exlib::string s, char ch, std::vector<exlib::string>& retVal)
+{
+    size_t p = 0, p1;
+
+    while ((p1 = s.find(ch, p)) != exlib::string::npos) {
+        retVal.push_back(trim(s.substr(p, p1 - p)));
+        p = p1 + 1;
+    }
+    retVal.push_back(trim(s.substr(p)));
+}
+
+// one permessage-deflate entry of Sec-WebSocket-Extensions, the parameters
+// are read from the point of view of the RFC, not of the caller.
+class deflate_params {
+public:
+    deflate_params()
+        : has_client_bits(false)
+        , has_server_bits(false)
+    {
+    }
+
+public:
+    bool parse(exlib::string ext)
+    {
+        std::vector<exlib::string> params;
+        split(ext, ';', params);
+
+        if (qstricmp(params[0].c_str(), "permessage-deflate"))
+            return false;
+
+        for (size_t i = 1; i < params.size(); i++) {
+            exlib::string name = params[i];
+            exlib::string value;
+            size_t p = name.find('=');
+
+            if (p != exlib::string::npos) {
+                value = trim(name.substr(p + 1));
+                name = trim(name.substr(0, p));
+                if (value.length() >= 2 && value[0] == '"' && value[value.length() - 1] == '"')
+                    value = value.substr(1, value.length() - 2);
+            }
+
+            if (name == "server_no_context_takeover") {
+                if (p != exlib::string::npos || v.server_no_context_takeover)
+                    return false;
+                v.server_no_context_takeover = true;
+            } else if (name == "client_no_context_takeover") {
+                if (p != exlib::string::npos || v.client_no_context_takeover)
+                    return false;
+                v.client_no_context_takeover = true;
+            } else if (name == "server_max_window_bits") {
+                if (has_server_bits || !bits(value, v.server_max_window_bits))
+                    return false;
+                has_server_bits = true;
+            } else if (name == "client_max_window_bits") {
+                if (has_client_bits)
+                    return false;
+                if (p != exlib::string::npos && !bits(value, v.client_max_window_bits))
+                    return false;
+                has_client_bits = true;
+            } else
+                return false;
+        }
+
+        return true;
+    }
+
+private:
+    static bool bits(exlib::string value, int32_t& retVal)
+    {
+        if (value.length() < 1 || value.length() > 2)
+            return false;
+        for (size_t i = 0; i < value.length(); i++)
+            if (value[i] < '0' || value[i] > '9')
+                return false;
+
+        retVal = atoi(value.c_str());
+        return retVal >= 8 && retVal <= 15;
+    }
+
+public:
+    WebSocketDeflate v;
+    bool has_client_bits;
+    bool has_server_bits;
+};
+
+exlib::string WebSocketDeflate::offer() const
+{
+    exlib::string s("permessage-deflate");
+    char buf[64];
+
+    if (server_no_context_takeover)
+        s.append("; server_no_context_takeover");
+    if (client_no_context_takeover)
+        s.append("; client_no_context_takeover");
+    if (server_max_window_bits < 15) {
+        snprintf(buf, sizeof(buf), "; server_max_window_bits=%d", server_max_window_bits);
+        s.append(buf);
+    }
+
+    if (client_max_window_bits < 15) {
+        snprintf(buf, sizeof(buf), "; client_max_window_bits=%d", client_max_window_bits);
+        s.append(buf);
+    } else
+        s.append("; client_max_window_bits");
+
+    return s;
+}
+
+bool WebSocketDeflate::parse(exlib::string answer, WebSocketDeflate& agreed) const
+{
+    deflate_params p;
+
+    if (!p.parse(answer))
+        return false;
+
+    agreed = p.v;
+
+    // zlib can not deflate with a window of 256 bytes
+    if (agreed.client_max_window_bits < 9)
+        return false;
+    if (agreed.server_max_window_bits < 9)
+        agreed.server_max_window_bits = 9;
+
+    if (client_no_context_takeover)
+        agreed.client_no_context_takeover = true;
+    if (agreed.client_max_window_bits > client_max_window_bits)
+        agreed.client_max_window_bits = client_max_window_bits;
+
+    return true;
+}
+
+bool WebSocketDeflate::accept(exlib::string offers, WebSocketDeflate& agreed, exlib::string& answer) const
+{
+    std::vector<exlib::string> exts;
+    split(offers, ',', exts);
+
+    for (size_t i = 0; i < exts.size(); i++) {
+        deflate_params p;
+
+        if (!p.parse(exts[i]) || p.v.server_max_window_bits < 9)
+            continue;
+
+        agreed = p.v;
+
+        if (server_no_context_takeover)
+            agreed.server_no_context_takeover = true;
+        if (client_no_context_takeover)
+            agreed.client_no_context_takeover = true;
+        if (agreed.server_max_window_bits > server_max_window_bits)
+            agreed.server_max_window_bits = server_max_window_bits;
+
+        // the client can only be limited when it said it can be
+        if (p.has_client_bits) {
+            if (agreed.client_max_window_bits < 9)
+                agreed.client_max_window_bits = 9;
+            if (agreed.client_max_window_bits > client_max_window_bits)
+                agreed.client_max_window_bits = client_max_window_bits;
+        } else
+            agreed.client_max_window_bits = 15;
+
+        char buf[64];
+
+        answer = "permessage-deflate";
+        if (agreed.server_no_context_takeover)
+            answer.append("; server_no_context_takeover");
+        if (agreed.client_no_context_takeover)
+            answer.append("; client_no_context_takeover");
+        // the server window may only be named when the client offered it,
+        // a smaller window is used anyway, any peer can inflate it
+        if (p.has_server_bits) {
+            snprintf(buf, sizeof(buf), "; server_max_window_bits=%d", agreed.server_max_window_bits);
+            answer.append(buf);
+        }
+        if (p.has_client_bits && agreed.client_max_window_bits < 15) {
+            snprintf(buf, sizeof(buf), "; client_max_window_bits=%d", agreed.client_max_window_bits);
+            answer.append(buf);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+result_t ws_base::get_compressMemory(int64_t& retVal)
+{
+    retVal = WebSocketZlib::s_deflate_memory + WebSocketZlib::s_inflate_memory;
+    return 0;
+}
+
+result_t ws_base::get_compressMemoryLimit(int64_t& retVal)
+{
+    retVal = WebSocketZlib::s_limit;
+    return 0;
+}
+
+result_t ws_base::set_compressMemoryLimit(int64_t newVal)
+{
+    if (newVal < 0)
+        return CALL_E_OUTRANGE;
+
+    WebSocketZlib::s_limit = newVal;
+    return 0;
+}
+
+} /* namespace fibjs */
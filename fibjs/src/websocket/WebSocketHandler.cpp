@@ -23,12 +23,20 @@ result_t ws_base::upgrade(v8::Local<v8::Object> opts, v8::Local<v8::Function> ac
 {
     Isolate* isolate = Isolate::current(accept);
     bool perMessageDeflate = false;
+    WebSocketDeflate deflateOpts;
     int32_t maxPayload = WS_DEF_SIZE;
+    result_t hr;
 
-    GetConfigValue(isolate, opts, "perMessageDeflate", perMessageDeflate);
     GetConfigValue(isolate, opts, "maxPayload", maxPayload);
 
-    retVal = new WebSocketHandler(accept, perMessageDeflate, maxPayload);
+    hr = WebSocketDeflate::load(isolate, opts, perMessageDeflate, deflateOpts);
+    if (hr < 0)
+        return hr;
+
+    obj_ptr<WebSocketHandler> handler = new WebSocketHandler(accept, perMessageDeflate, maxPayload);
+    handler->m_deflateOpts = deflateOpts;
+
+    retVal = handler;
     return 0;
 }
 
@@ -122,9 +130,13 @@ result_t WebSocketHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
             if (hr < 0)
                 return hr;
 
-            if (hr != CALL_RETURN_NULL && m_pThis->m_enableCompress && !qstricmp(v.c_str(), "permessage-deflate", 18)) {
-                m_httprep->addHeader("Sec-WebSocket-Extensions", "permessage-deflate");
-                m_compress = true;
+            if (hr != CALL_RETURN_NULL && m_pThis->m_enableCompress) {
+                exlib::string answer;
+
+                if (m_pThis->m_deflateOpts.bounded().accept(v, m_agreed, answer)) {
+                    m_httprep->addHeader("Sec-WebSocket-Extensions", answer);
+                    m_compress = true;
+                }
             }
 
             return m_httprep->sendTo(m_stm, next(accept));
@@ -135,7 +147,7 @@ result_t WebSocketHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
             obj_ptr<WebSocketHandler> pHandler = m_pThis;
             obj_ptr<WebSocket> sock = new WebSocket(m_stm, "", this, m_pThis->m_enableCompress, m_pThis->m_maxSize);
             if (m_compress)
-                sock->enableCompress();
+                sock->enableCompress(m_agreed);
 
             Variant vs[2];
             vs[0] = sock;
@@ -152,6 +164,7 @@ result_t WebSocketHandler::invoke(object_base* v, obj_ptr<Handler_base>& retVal,
         obj_ptr<HttpResponse_base> m_httprep;
         obj_ptr<Stream_base> m_stm;
         bool m_compress;
+        WebSocketDeflate m_agreed;
     };
 
     if (ac->isSync())
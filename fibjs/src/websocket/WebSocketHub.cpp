@@ -0,0 +1,220 @@
+/*
+ * WebSocketHub.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "WebSocketHub.h"
+
+namespace fibjs {
+
+result_t WebSocketHub_base::_new(v8::Local<v8::Object> opts, obj_ptr<WebSocketHub_base>& retVal,
+    v8::Local<v8::Object> This)
+{
+    Isolate* isolate = Isolate::current();
+    result_t hr;
+
+    int64_t maxBuffered = 4 * 1024 * 1024;
+    hr = GetConfigValue(isolate, opts, "maxBufferedBytes", maxBuffered, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+    if (maxBuffered <= 0)
+        return CHECK_ERROR(Runtime::setError("WebSocketHub: maxBufferedBytes must be greater than 0."));
+
+    retVal = new WebSocketHub(maxBuffered);
+    return 0;
+}
+
+// an unmasked frame, which is what a server sends. a compressed payload is
+// deflated with a fresh stream and sync flushed, without the trailing
+// 00 00 ff ff, so it does not depend on the context of any connection.
+// bits is the window the peer agreed on, 0 for a plain frame.
+static result_t build_frame(int32_t type, const uint8_t* data, size_t len, int32_t bits, obj_ptr<Buffer>& retVal)
+{
+    exlib::string zdata;
+    bool deflate = bits > 0;
+
+    if (deflate) {
+        z_stream strm;
+
+        memset(&strm, 0, sizeof(strm));
+        if (deflateInit2(&strm, -1, Z_DEFLATED, -bits, 8, 0) != Z_OK)
+            return CHECK_ERROR(Runtime::setError("WebSocketHub: deflate init failed."));
+
+        zdata.resize(deflateBound(&strm, (uLong)len) + 16);
+
+        strm.next_in = (Bytef*)data;
+        strm.avail_in = (uInt)len;
+        strm.next_out = (Bytef*)zdata.data();
+        strm.avail_out = (uInt)zdata.length();
+
+        int32_t err = deflate(&strm, Z_SYNC_FLUSH);
+        size_t zlen = zdata.length() - strm.avail_out;
+        deflateEnd(&strm);
+
+        if (err != Z_OK || strm.avail_in != 0 || zlen < 4)
+            return CHECK_ERROR(Runtime::setError("WebSocketHub: deflate failed."));
+
+        zdata.resize(zlen - 4);
+        data = (const uint8_t*)zdata.c_str();
+        len = zdata.length();
+    }
+
+    uint8_t head[10];
+    int32_t pos;
+
+    head[0] = (deflate ? 0xc0 : 0x80) | (type & 0x0f);
+    if (len < 126) {
+        head[1] = (uint8_t)len;
+        pos = 2;
+    } else if (len < 65536) {
+        head[1] = 126;
+        head[2] = (uint8_t)(len >> 8);
+        head[3] = (uint8_t)(len & 0xff);
+        pos = 4;
+    } else {
+        uint64_t size = len;
+
+        head[1] = 127;
+        for (int32_t i = 0; i < 8; i++)
+            head[2 + i] = (uint8_t)((size >> (56 - i * 8)) & 0xff);
+        pos = 10;
+    }
+
+    obj_ptr<Buffer> frame = new Buffer(NULL, pos + len);
+    memcpy(frame->data(), head, pos);
+    if (len)
+        memcpy(frame->data() + pos, data, len);
+
+    retVal = frame;
+    return 0;
+}
+
+result_t WebSocketHub::subscribe(WebSocket_base* sock, exlib::string topic)
+{
+    WebSocket* ws = (WebSocket*)sock;
+
+    if (ws->m_masked)
+        return CHECK_ERROR(Runtime::setError("WebSocketHub: only server side WebSocket can subscribe."));
+
+    if (ws->m_readyState != ws_base::C_OPEN)
+        return CHECK_ERROR(Runtime::setError("WebSocketHub: WebSocket is not open."));
+
+    m_topics[topic].emplace(ws, ws);
+    return 0;
+}
+
+result_t WebSocketHub::unsubscribe(WebSocket_base* sock, exlib::string topic)
+{
+    auto it = m_topics.find(topic);
+    if (it == m_topics.end())
+        return 0;
+
+    it->second.erase((WebSocket*)sock);
+    if (it->second.empty())
+        m_topics.erase(it);
+
+    return 0;
+}
+
+result_t WebSocketHub::publish(exlib::string topic, exlib::string data, int32_t& retVal)
+{
+    return publish(topic, ws_base::C_TEXT, (const uint8_t*)data.c_str(), data.length(), retVal);
+}
+
+result_t WebSocketHub::publish(exlib::string topic, Buffer_base* data, int32_t& retVal)
+{
+    Buffer* buf = Buffer::Cast(data);
+    return publish(topic, ws_base::C_BINARY, buf->data(), buf->length(), retVal);
+}
+
+result_t WebSocketHub::publish(exlib::string topic, int32_t type, const uint8_t* data, size_t len, int32_t& retVal)
+{
+    retVal = 0;
+    m_published++;
+
+    auto it = m_topics.find(topic);
+    if (it == m_topics.end())
+        return 0;
+
+    obj_ptr<Buffer> frames[16];
+    std::vector<WebSocket*> removed;
+    result_t hr;
+
+    for (auto& s : it->second) {
+        WebSocket* ws = s.first;
+
+        if (ws->m_closeState != ws_base::C_OPEN || ws->m_readyState != ws_base::C_OPEN) {
+            removed.push_back(ws);
+            continue;
+        }
+
+        bool deflate = ws->m_compress;
+        int32_t bits = deflate ? ws->m_deflateBits : 0;
+        obj_ptr<Buffer>& frame = frames[bits];
+        if (!frame) {
+            hr = build_frame(type, data, len, bits, frame);
+            if (hr < 0)
+                return hr;
+            m_encoded++;
+        }
+
+        int64_t size = frame->length();
+
+        // a consumer that can not keep up is dropped instead of letting its
+        // queue grow without bound
+        if (ws->m_frameBuffered + size > m_maxBuffered) {
+            removed.push_back(ws);
+            ws->endConnect(1008, "slow consumer");
+            m_evicted++;
+            continue;
+        }
+
+        ws->sendFrame(frame, deflate);
+
+        m_frames++;
+        m_bytes += size;
+        retVal++;
+    }
+
+    for (size_t i = 0; i < removed.size(); i++)
+        it->second.erase(removed[i]);
+    if (it->second.empty())
+        m_topics.erase(it);
+
+    return 0;
+}
+
+result_t WebSocketHub::count(exlib::string topic, int32_t& retVal)
+{
+    auto it = m_topics.find(topic);
+    retVal = it == m_topics.end() ? 0 : (int32_t)it->second.size();
+
+    return 0;
+}
+
+result_t WebSocketHub::get_stats(v8::Local<v8::Object>& retVal)
+{
+    Isolate* isolate = holder();
+    v8::Local<v8::Context> context = isolate->context();
+    v8::Local<v8::Object> o = v8::Object::New(isolate->m_isolate);
+    int64_t subscribers = 0;
+
+    for (auto& t : m_topics)
+        subscribers += t.second.size();
+
+    o->Set(context, isolate->NewString("topics"), v8::Number::New(isolate->m_isolate, (double)m_topics.size())).IsJust();
+    o->Set(context, isolate->NewString("subscribers"), v8::Number::New(isolate->m_isolate, (double)subscribers)).IsJust();
+    o->Set(context, isolate->NewString("published"), v8::Number::New(isolate->m_isolate, (double)m_published)).IsJust();
+    o->Set(context, isolate->NewString("frames"), v8::Number::New(isolate->m_isolate, (double)m_frames)).IsJust();
+    o->Set(context, isolate->NewString("encoded"), v8::Number::New(isolate->m_isolate, (double)m_encoded)).IsJust();
+    o->Set(context, isolate->NewString("bytes"), v8::Number::New(isolate->m_isolate, (double)m_bytes)).IsJust();
+    o->Set(context, isolate->NewString("evicted"), v8::Number::New(isolate->m_isolate, (double)m_evicted)).IsJust();
+
+    retVal = o;
+    return 0;
+}
+
+} /* namespace fibjs */
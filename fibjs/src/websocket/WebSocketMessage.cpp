@@ -197,7 +197,6 @@ result_t WebSocketMessage::sendTo(Stream_base* stm, WebSocket* wss, AsyncEvent*
             , m_stm(stm)
             , m_wss(wss)
             , m_mask(0)
-            , m_take_over(false)
         {
             m_pThis->get_body(m_body);
 
@@ -205,9 +204,9 @@ result_t WebSocketMessage::sendTo(Stream_base* stm, WebSocket* wss, AsyncEvent*
                 m_data = new MemoryStream();
 
                 if (m_wss && m_wss->m_compress) {
-                    m_take_over = true;
-                    m_wss->m_deflate->attach(m_data);
-                    m_zip = m_wss->m_deflate;
+                    m_deflate = m_wss->borrowDeflate();
+                    m_deflate->attach(m_data);
+                    m_zip = m_deflate;
                 } else
                     zlib_base::createDeflateRaw(m_data, m_zip);
 
@@ -231,8 +230,10 @@ result_t WebSocketMessage::sendTo(Stream_base* stm, WebSocket* wss, AsyncEvent*
 
         ON_STATE(asyncSendTo, head)
         {
-            if (m_take_over)
-                m_wss->m_deflate->attach(NULL);
+            if (m_deflate) {
+                m_wss->returnDeflate(m_deflate);
+                m_deflate.Release();
+            }
 
             int64_t size;
             m_data->size(size);
@@ -296,8 +297,10 @@ result_t WebSocketMessage::sendTo(Stream_base* stm, WebSocket* wss, AsyncEvent*
 
         virtual int32_t error(int32_t v)
         {
-            if (m_take_over)
-                m_wss->m_deflate->attach(NULL);
+            if (m_deflate) {
+                m_wss->returnDeflate(m_deflate);
+                m_deflate.Release();
+            }
             return v;
         }
 
@@ -311,7 +314,7 @@ result_t WebSocketMessage::sendTo(Stream_base* stm, WebSocket* wss, AsyncEvent*
         int64_t m_size;
         uint32_t m_mask;
         obj_ptr<Buffer_base> m_buffer;
-        bool m_take_over;
+        obj_ptr<ws_defraw> m_deflate;
     };
 
     if (ac->isSync())
@@ -340,7 +343,6 @@ result_t WebSocketMessage::readFrom(Stream_base* stm, WebSocket* wss, AsyncEvent
             , m_size(0)
             , m_fullsize(0)
             , m_mask(0)
-            , m_take_over(false)
         {
             m_pThis->get_body(m_body);
             m_zip = m_body;
@@ -368,9 +370,10 @@ result_t WebSocketMessage::readFrom(Stream_base* stm, WebSocket* wss, AsyncEvent
             ch = data[0];
             if (ch & 0x40) {
                 if (m_wss && m_wss->m_compress) {
-                    m_take_over = true;
-                    m_wss->m_inflate->attach(m_body);
-                    m_zip = m_wss->m_inflate;
+                    if (!m_inflate)
+                        m_inflate = m_wss->borrowInflate();
+                    m_inflate->attach(m_body);
+                    m_zip = m_inflate;
                 } else
                     zlib_base::createInflateRaw(m_body, m_pThis->m_maxSize, m_zip);
 
@@ -461,7 +464,7 @@ result_t WebSocketMessage::readFrom(Stream_base* stm, WebSocket* wss, AsyncEvent
                 return next(head);
             }
 
-            if (m_take_over)
+            if (m_inflate)
                 return m_zip->write(m_wss->m_flushTail, next(tail_end));
 
             return m_zip->flush(next(body_end));
@@ -474,8 +477,10 @@ result_t WebSocketMessage::readFrom(Stream_base* stm, WebSocket* wss, AsyncEvent
 
         ON_STATE(asyncReadFrom, body_end)
         {
-            if (m_take_over)
-                m_wss->m_inflate->attach(NULL);
+            if (m_inflate) {
+                m_wss->returnInflate(m_inflate);
+                m_inflate.Release();
+            }
 
             m_body->rewind();
             return next();
@@ -483,8 +488,10 @@ result_t WebSocketMessage::readFrom(Stream_base* stm, WebSocket* wss, AsyncEvent
 
         virtual int32_t error(int32_t v)
         {
-            if (m_take_over)
-                m_wss->m_inflate->attach(NULL);
+            if (m_inflate) {
+                m_wss->returnInflate(m_inflate);
+                m_inflate.Release();
+            }
             return v;
         }
 
@@ -501,7 +508,7 @@ result_t WebSocketMessage::readFrom(Stream_base* stm, WebSocket* wss, AsyncEvent
         int64_t m_size;
         int64_t m_fullsize;
         uint32_t m_mask;
-        bool m_take_over;
+        obj_ptr<ws_infraw> m_inflate;
     };
 
     if (ac->isSync())
@@ -15,6 +15,7 @@
 #include "XmlCDATASection.h"
 #include "XmlProcessingInstruction.h"
 #include "XmlParser.h"
+#include "XmlStreamParser.h"
 #include "encoding_iconv.h"
 
 namespace fibjs {
@@ -62,6 +63,11 @@ result_t xml_base::parse(Buffer_base* source, exlib::string type, obj_ptr<XmlDoc
     return retVal->load(source);
 }
 
+result_t xml_base::parseStream(Stream_base* stream, v8::Local<v8::Object> handlers, v8::Local<v8::Object> opts)
+{
+    return XmlStreamParser::parse(stream, handlers, opts);
+}
+
 result_t xml_base::serialize(XmlNode_base* node, exlib::string& retVal)
 {
     return node->toString(retVal);
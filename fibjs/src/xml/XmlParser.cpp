@@ -181,8 +181,7 @@ result_t XmlParser::parse(XmlDocument* doc, exlib::string source)
 {
     XmlParser parser(doc, true);
 
-    parser.m_now = doc;
-    parser.m_list.push_back(doc);
+    parser.reset();
 
     XML_Parser xml_parser = XML_ParserCreate(NULL);
 
@@ -0,0 +1,281 @@
+/*
+ * XmlStreamParser.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: lion
+ */
+
+#include "object.h"
+#include "XmlStreamParser.h"
+#include "XmlElement.h"
+#include "Buffer.h"
+#include "Runtime.h"
+#define XML_STATIC
+#include <expat/include/expat.h>
+
+namespace fibjs {
+
+v8::Local<v8::Function> XmlStreamParser::handler(const char* name)
+{
+    JSValue v = m_handlers->Get(m_isolate->context(), m_isolate->NewString(name));
+    if (v.IsEmpty() || !v->IsFunction())
+        return v8::Local<v8::Function>();
+
+    return v8::Local<v8::Function>::Cast(v);
+}
+
+void XmlStreamParser::call(v8::Local<v8::Function> func, int32_t argc, v8::Local<v8::Value>* argv)
+{
+    if (m_hr < 0)
+        return;
+
+    v8::Local<v8::Value> result = func->Call(func->GetCreationContextChecked(), m_handlers, argc, argv)
+                                      .FromMaybe(v8::Local<v8::Value>());
+    if (result.IsEmpty()) {
+        m_hr = CALL_E_JAVASCRIPT;
+        XML_StopParser((XML_Parser)m_parser, XML_FALSE);
+    }
+}
+
+void XmlStreamParser::flushText()
+{
+    if (m_text.empty())
+        return;
+
+    if (!m_onText.IsEmpty()) {
+        v8::HandleScope handle_scope(m_isolate->m_isolate);
+        v8::Local<v8::Value> arg = m_isolate->NewString(m_text);
+        call(m_onText, 1, &arg);
+    }
+
+    m_text.clear();
+}
+
+bool XmlStreamParser::matchPath(const char* name)
+{
+    for (size_t i = 0; i < m_select.size(); i++) {
+        const exlib::string& sel = m_select[i];
+
+        if (sel[0] == '/') {
+            if (sel == m_path)
+                return true;
+        } else if (sel == name)
+            return true;
+    }
+
+    return false;
+}
+
+void XmlStreamParser::OnStartElement(const XML_Char* name, const XML_Char** atts)
+{
+    m_pathStack.push_back(m_path.length());
+    m_path.append(1, '/');
+    m_path.append(name);
+
+    if (m_capture > 0) {
+        m_capture++;
+        m_builder->OnStartElement(name, atts);
+        return;
+    }
+
+    flushText();
+
+    if (!m_onElement.IsEmpty() && matchPath(name)) {
+        m_doc = new XmlDocument(true);
+        m_builder.reset(new XmlParser(m_doc, true));
+        m_builder->reset();
+        m_builder->OnStartElement(name, atts);
+        m_capture = 1;
+        return;
+    }
+
+    if (m_onStartElement.IsEmpty())
+        return;
+
+    v8::HandleScope handle_scope(m_isolate->m_isolate);
+    v8::Local<v8::Context> context = m_isolate->context();
+    v8::Local<v8::Object> attrs = v8::Object::New(m_isolate->m_isolate);
+
+    while (atts[0] && atts[1]) {
+        attrs->Set(context, m_isolate->NewString(atts[0]), m_isolate->NewString(atts[1])).IsJust();
+        atts += 2;
+    }
+
+    v8::Local<v8::Value> argv[] = { m_isolate->NewString(name), attrs };
+    call(m_onStartElement, 2, argv);
+}
+
+void XmlStreamParser::OnEndElement(const XML_Char* name)
+{
+    if (m_capture > 0) {
+        m_builder->OnEndElement(name);
+
+        if (--m_capture == 0) {
+            obj_ptr<XmlElement_base> el;
+            m_doc->get_documentElement(el);
+
+            v8::HandleScope handle_scope(m_isolate->m_isolate);
+            v8::Local<v8::Value> argv[] = { GetReturnValue(m_isolate, el), m_isolate->NewString(m_path) };
+            call(m_onElement, 2, argv);
+
+            m_builder.reset();
+            m_doc.Release();
+        }
+    } else {
+        flushText();
+
+        if (!m_onEndElement.IsEmpty()) {
+            v8::HandleScope handle_scope(m_isolate->m_isolate);
+            v8::Local<v8::Value> arg = m_isolate->NewString(name);
+            call(m_onEndElement, 1, &arg);
+        }
+    }
+
+    m_path.resize(m_pathStack.back());
+    m_pathStack.pop_back();
+}
+
+void XmlStreamParser::OnCharacterData(const XML_Char* s, int32_t len)
+{
+    if (m_capture > 0)
+        m_builder->OnCharacterData(s, len);
+    else if (!m_onText.IsEmpty())
+        m_text.append(s, len);
+}
+
+void XmlStreamParser::OnProcessingInstruction(const XML_Char* target, const XML_Char* data)
+{
+    if (m_capture > 0) {
+        m_builder->OnProcessingInstruction(target, data);
+        return;
+    }
+
+    flushText();
+
+    if (!m_onProcessingInstruction.IsEmpty()) {
+        v8::HandleScope handle_scope(m_isolate->m_isolate);
+        v8::Local<v8::Value> argv[] = { m_isolate->NewString(target), m_isolate->NewString(data) };
+        call(m_onProcessingInstruction, 2, argv);
+    }
+}
+
+void XmlStreamParser::OnComment(const XML_Char* data)
+{
+    if (m_capture > 0) {
+        m_builder->OnComment(data);
+        return;
+    }
+
+    flushText();
+
+    if (!m_onComment.IsEmpty()) {
+        v8::HandleScope handle_scope(m_isolate->m_isolate);
+        v8::Local<v8::Value> arg = m_isolate->NewString(data);
+        call(m_onComment, 1, &arg);
+    }
+}
+
+void XmlStreamParser::OnStartCdataSection()
+{
+    if (m_capture > 0)
+        m_builder->OnStartCdataSection();
+}
+
+void XmlStreamParser::OnEndCdataSection()
+{
+    if (m_capture > 0)
+        m_builder->OnEndCdataSection();
+}
+
+result_t XmlStreamParser::parse(Stream_base* stream, v8::Local<v8::Object> handlers, v8::Local<v8::Object> opts)
+{
+    Isolate* isolate = Isolate::current(handlers);
+    XmlStreamParser parser(isolate, handlers);
+    result_t hr;
+
+    int32_t bufferSize = STREAM_BUFF_SIZE;
+    hr = GetConfigValue(isolate, opts, "bufferSize", bufferSize, true);
+    if (hr < 0 && hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+    if (bufferSize <= 0)
+        return CHECK_ERROR(CALL_E_INVALIDARG);
+
+    v8::Local<v8::Array> paths;
+    hr = GetConfigValue(isolate, opts, "paths", paths, true);
+    if (hr >= 0) {
+        int32_t len = paths->Length();
+
+        for (int32_t i = 0; i < len; i++) {
+            exlib::string path;
+            hr = GetConfigValue(isolate, paths, i, path, true);
+            if (hr < 0)
+                return hr;
+            if (path.empty())
+                return CHECK_ERROR(CALL_E_INVALIDARG);
+
+            parser.m_select.push_back(path);
+        }
+    } else if (hr != CALL_E_PARAMNOTOPTIONAL)
+        return hr;
+
+    parser.m_onStartElement = parser.handler("startElement");
+    parser.m_onEndElement = parser.handler("endElement");
+    parser.m_onText = parser.handler("text");
+    parser.m_onComment = parser.handler("comment");
+    parser.m_onProcessingInstruction = parser.handler("processingInstruction");
+    parser.m_onElement = parser.handler("element");
+
+    XML_Parser xml_parser = XML_ParserCreate(NULL);
+    parser.m_parser = xml_parser;
+
+    XML_SetParamEntityParsing(xml_parser, XML_PARAM_ENTITY_PARSING_UNLESS_STANDALONE);
+    XML_SetUserData(xml_parser, &parser);
+
+    XML_SetElementHandler(xml_parser, StartElementHandler, EndElementHandler);
+    XML_SetCharacterDataHandler(xml_parser, CharacterDataHandler);
+    XML_SetProcessingInstructionHandler(xml_parser, ProcessingInstructionHandler);
+    XML_SetCommentHandler(xml_parser, CommentHandler);
+    XML_SetCdataSectionHandler(xml_parser, StartCdataSectionHandler, EndCdataSectionHandler);
+
+    while (true) {
+        obj_ptr<Buffer_base> buf;
+        const char* data = NULL;
+        int32_t len = 0;
+
+        hr = stream->ac_read(bufferSize, buf);
+        if (hr < 0)
+            break;
+
+        bool last = hr == CALL_RETURN_NULL;
+        if (!last) {
+            Buffer* _buf = Buffer::Cast(buf);
+            data = (const char*)_buf->data();
+            len = (int32_t)_buf->length();
+        }
+
+        if (XML_Parse(xml_parser, data, len, last) != XML_STATUS_OK) {
+            if (parser.m_hr < 0)
+                hr = parser.m_hr;
+            else {
+                char msg[128];
+                snprintf(msg, sizeof(msg), "XmlParser: error on line %lu at column %lu: %s", XML_GetCurrentLineNumber(xml_parser),
+                    XML_GetCurrentColumnNumber(xml_parser) + 1,
+                    XML_ErrorString(XML_GetErrorCode(xml_parser)));
+                hr = CHECK_ERROR(Runtime::setError(msg));
+            }
+            break;
+        }
+
+        if (last) {
+            parser.flushText();
+            hr = parser.m_hr;
+            break;
+        }
+    }
+
+    XML_ParserFree(xml_parser);
+
+    return hr < 0 ? hr : 0;
+}
+
+} /* namespace fibjs */
@@ -40,6 +40,7 @@
 /// <reference path="../module/assert.d.ts" />
 /// <reference path="../module/performance.d.ts" />
 /// <reference path="../module/perf_hooks.d.ts" />
+/// <reference path="../module/metrics.d.ts" />
 /// <reference path="../module/profiler.d.ts" />
 /// <reference path="../module/test.d.ts" />
 /// <reference path="../module/db.d.ts" />
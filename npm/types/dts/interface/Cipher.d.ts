@@ -58,6 +58,8 @@ declare class Class_Cipher extends Class_object {
 
     /**
      * @description 更新数据
+     * 
+     *       数据小于 64K 时直接在当前线程处理，否则交由后台线程池处理。在一次更新完成之前，不能再次调用 update 或 final。
      *       @param data 指定要更新的数据
      *       @param inputEncoding 指定输入数据编码方式
      *       @param outputEncoding 指定输出数据编码方式
@@ -66,6 +68,8 @@ declare class Class_Cipher extends Class_object {
      */
     update(data: Class_Buffer, inputEncoding?: string, outputEncoding?: string): any;
 
+    update(data: Class_Buffer, inputEncoding?: string, outputEncoding?: string, callback?: (err: Error | undefined | null, retVal: any)=>any): void;
+
     /**
      * @description 更新数据
      *       @param data 指定要更新的数据
@@ -76,6 +80,8 @@ declare class Class_Cipher extends Class_object {
      */
     update(data: string, inputEncoding?: string, outputEncoding?: string): any;
 
+    update(data: string, inputEncoding?: string, outputEncoding?: string, callback?: (err: Error | undefined | null, retVal: any)=>any): void;
+
     /**
      * @description 终止数据
      *       @param outputEncoding 指定输出数据编码方式
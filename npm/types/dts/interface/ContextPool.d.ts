@@ -0,0 +1,65 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/**
+ * @description vm 上下文池，预先创建上下文，按需分配，用完归还
+ * 
+ *  创建上下文的开销不再出现在请求的处理过程中：池在创建时预先准备好上下文，acquire 直接取出一个使用，归还的上下文被解除绑定并丢弃，池在后台创建新的上下文补充。
+ *  ```JavaScript
+ *  var vm = require('vm');
+ *  var pool = new vm.ContextPool({
+ *     size: 8
+ *  });
+ *  var script = new vm.Script('a + b');
+ * 
+ *  var ctx = pool.acquire({ a: 1, b: 2 });
+ *  var r = script.runInContext(ctx);
+ *  pool.release(ctx);
+ *  ```
+ *  
+ */
+declare class Class_ContextPool extends Class_object {
+    /**
+     * @description ContextPool 对象构造函数
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *         "size": 4 // 指定池中预先创建的上下文数量
+     *      }
+     *      ```
+     *      @param opts 指定上下文池选项
+     *     
+     */
+    constructor(opts?: FIBJS.GeneralObject);
+
+    /**
+     * @description 从池中取出一个上下文，并将 contextObject 上下文化
+     * 
+     *      返回的对象可以用于 vm.runInContext 和 Script.runInContext。池为空时将立即创建新的上下文。
+     *      @param contextObject 指定将被上下文化的对象
+     *      @return 返回上下文化之后的 contextObject
+     *     
+     */
+    acquire(contextObject?: FIBJS.GeneralObject): FIBJS.GeneralObject;
+
+    /**
+     * @description 将上下文归还到池中
+     * 
+     *      contextObject 将不再是上下文对象，上下文中仍在运行的代码将只能看到一个空的全局对象。
+     *      @param contextObject 指定由 acquire 返回的对象
+     *     
+     */
+    release(contextObject: FIBJS.GeneralObject): void;
+
+    /**
+     * @description 查询池中预先创建的上下文数量 
+     */
+    readonly size: number;
+
+    /**
+     * @description 查询池中当前可以直接分配的上下文数量 
+     */
+    readonly available: number;
+
+}
+
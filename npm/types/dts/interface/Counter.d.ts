@@ -0,0 +1,25 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/**
+ * @description 只增不减的计数器指标，由 metrics.counter 创建 
+ */
+declare class Class_Counter extends Class_object {
+    /**
+     * @description 查询指标名称 
+     */
+    readonly name: string;
+
+    /**
+     * @description 查询当前计数 
+     */
+    readonly value: number;
+
+    /**
+     * @description 增加计数
+     *      @param value 指定增加的数值，不能为负数
+     *      
+     */
+    inc(value?: number): void;
+
+}
+
@@ -27,12 +27,16 @@
 declare class Class_Digest extends Class_object {
     /**
      * @description 更新二进制摘要信息
+     * 
+     *      数据块小于 64K 时直接在当前线程计算，否则交由后台线程池计算。在一次更新完成之前，不能再次调用 update 或 digest。
      *      @param data 二进制数据块
      *      @return 返回信息摘要对象本身
      *      
      */
     update(data: Class_Buffer): Class_Digest;
 
+    update(data: Class_Buffer, callback: (err: Error | undefined | null, retVal: Class_Digest)=>any): void;
+
     /**
      * @description 更新字符串摘要信息
      *      @param data 字符串数据
@@ -42,6 +46,8 @@ declare class Class_Digest extends Class_object {
      */
     update(data: string, codec?: string): Class_Digest;
 
+    update(data: string, codec?: string, callback?: (err: Error | undefined | null, retVal: Class_Digest)=>any): void;
+
     /**
      * @description 计算并返回摘要
      *      @param codec 指定编码格式，允许值为："buffer", "hex", "base32", "base58", "base64", "utf8", 或者 iconv 模块支持的字符集
@@ -75,5 +75,14 @@ declare class Class_Fiber extends Class_object {
      */
     readonly stack_usage: number;
 
+    /**
+     * @description 查询和设置纤程的截止时间，以 Date.now() 的毫秒数表示，0 表示不限制，缺省为 0
+     * 
+     *      截止时间与局部变量一样会复制到新创建的纤程。纤程内发起的 http 请求会据此缩短超时时间，超过截止时间后以超时错误结束；redis 命令和数据库查询则在超过截止时间后不再发出，直接以超时错误结束。
+     *      在 http.Server 的处理函数中，截止时间由 handlerTimeout 自动设定。
+     *      
+     */
+    deadline: number;
+
 }
 
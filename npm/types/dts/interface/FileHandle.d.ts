@@ -47,6 +47,17 @@ declare class Class_FileHandle extends Class_object {
 
     read(buffer: Class_Buffer, offset?: number, length?: number, position?: number, callback?: (err: Error | undefined | null, retVal: number)=>any): void;
 
+    /**
+     * @description 根据文件描述符，将文件内容依次读入一组 Buffer
+     *      @param buffers 读取结果写入的 Buffer 数组，按顺序填满每个 Buffer 后再写入下一个
+     *      @param position 文件读取位置，默认为当前文件位置
+     *      @return 实际读取的字节数
+     *      
+     */
+    readv(buffers: any[], position?: number): number;
+
+    readv(buffers: any[], position?: number, callback?: (err: Error | undefined | null, retVal: number)=>any): void;
+
     /**
      * @description 根据文件描述符，向文件写入内容
      *      @param buffer 待写入的 Buffer 对象
@@ -0,0 +1,39 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/**
+ * @description 可以任意设置的仪表指标，由 metrics.gauge 创建 
+ */
+declare class Class_Gauge extends Class_object {
+    /**
+     * @description 查询指标名称 
+     */
+    readonly name: string;
+
+    /**
+     * @description 查询当前数值 
+     */
+    readonly value: number;
+
+    /**
+     * @description 设置当前数值
+     *      @param value 指定新的数值
+     *      
+     */
+    set(value: number): void;
+
+    /**
+     * @description 增加数值
+     *      @param value 指定增加的数值
+     *      
+     */
+    inc(value?: number): void;
+
+    /**
+     * @description 减少数值
+     *      @param value 指定减少的数值
+     *      
+     */
+    dec(value?: number): void;
+
+}
+
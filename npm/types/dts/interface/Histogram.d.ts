@@ -0,0 +1,41 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/**
+ * @description 记录数值分布的直方图指标，由 metrics.histogram 创建
+ * 
+ *  直方图以对数线性分桶记录非负整数，小数按四舍五入取整，负数记为 0。
+ *  
+ */
+declare class Class_Histogram extends Class_object {
+    /**
+     * @description 查询指标名称 
+     */
+    readonly name: string;
+
+    /**
+     * @description 查询已记录的数值个数 
+     */
+    readonly count: number;
+
+    /**
+     * @description 查询已记录数值的总和 
+     */
+    readonly sum: number;
+
+    /**
+     * @description 记录一个数值
+     *      @param value 指定要记录的数值
+     *      
+     */
+    observe(value: number): void;
+
+    /**
+     * @description 查询百分位数
+     *      @param p 指定百分位，取值范围 0 至 100
+     *      @return 返回百分位数的近似值
+     *      
+     */
+    percentile(p: number): number;
+
+}
+
@@ -58,6 +58,53 @@ declare class Class_HttpServer extends Class_TcpServer {
      */
     enableCrossOrigin(allowHeaders?: string): void;
 
+    /**
+     * @description 启用原生访问日志
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          "format": "combined", // 日志格式，可以为 combined，common，json 或自定义模板，缺省为 combined
+     *          "headers": [], // 额外记录的请求头字段
+     *          "path": "" // 日志文件路径，缺省时输出到 console
+     *      }
+     *      ```
+     *      自定义模板中可以使用以下变量：$remote_addr，$time_local，$time_iso，$request，$method，$uri，$path，$query，$protocol，$status，$bytes，$latency（微秒），$request_time（秒），以及 $http_xxx 表示请求头 xxx，其中的下划线对应请求头名称中的减号。
+     * 
+     *      json 格式每行输出一个 JSON 对象，headers 指定的字段记录在 headers 属性中；其它格式中 headers 指定的字段以引号包裹依次追加在行尾。
+     * 
+     *      日志在请求完成后格式化并写入缓冲区，由后台线程批量写入文件或 console。
+     *      @param opts 指定访问日志选项
+     *      
+     */
+    enableAccessLog(opts?: FIBJS.GeneralObject): void;
+
+    /**
+     * @description 关闭原生访问日志，已缓冲的日志仍会写出 
+     */
+    disableAccessLog(): void;
+
+    /**
+     * @description 启用并发限制与过载保护
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          "maxConcurrency": 0, // 同时处理的最大请求数，0 表示取消限制，缺省为 0
+     *          "maxQueue": 0, // 超出并发限制时允许排队等候的最大请求数，缺省为 0
+     *          "queueTimeout": 0, // 排队请求的最长等候时间，单位为毫秒，0 表示不限制，缺省为 0
+     *          "adaptive": false, // 是否根据响应延迟自动调整并发上限，缺省为 false
+     *          "minConcurrency": 1 // 自动调整时的最低并发上限，缺省为 1
+     *      }
+     *      ```
+     *      超出并发限制的请求进入队列等候，排队等候的请求不占用纤程；队列已满或等候超时的请求直接返回 503，并关闭连接。
+     * 
+     *      启用 adaptive 后，并发上限在 minConcurrency 与 maxConcurrency 之间根据响应延迟的变化自动调整，延迟明显升高时收缩，延迟平稳时逐步放宽。
+     *      @param opts 指定并发限制选项
+     *      
+     */
+    limitConcurrency(opts?: FIBJS.GeneralObject): void;
+
     /**
      * @description 查询和设置最大请求头个数，缺省为 128 
      */
@@ -83,5 +130,30 @@ declare class Class_HttpServer extends Class_TcpServer {
      */
     serverName: string;
 
+    /**
+     * @description 查询和设置读取请求头的超时时间，单位为毫秒，超时后关闭连接，0 表示不限制，缺省为 0 
+     */
+    headerTimeout: number;
+
+    /**
+     * @description 查询和设置读取请求体的超时时间，单位为毫秒，超时后关闭连接，0 表示不限制，缺省为 0 
+     */
+    bodyTimeout: number;
+
+    /**
+     * @description 查询和设置保持连接时等待下一个请求的超时时间，单位为毫秒，超时后关闭连接，0 表示不限制，缺省为 0 
+     */
+    idleTimeout: number;
+
+    /**
+     * @description 查询和设置请求处理的时限，单位为毫秒，0 表示不限制，缺省为 0。处理函数所在纤程的 deadline 将据此设定，超过时限后处理出错将返回 504 
+     */
+    handlerTimeout: number;
+
+    /**
+     * @description 查询并发限制的运行状态，包括 limit，inflight，waiting，accepted，queued，shed 和 timeouts，未启用并发限制时为 null 
+     */
+    readonly loadStats: FIBJS.GeneralObject;
+
 }
 
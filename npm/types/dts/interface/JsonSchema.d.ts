@@ -0,0 +1,24 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/**
+ * @description json.compile 编译的记录编解码器，按记录结构以固定字段顺序编码和解码 
+ */
+declare class Class_JsonSchema extends Class_object {
+    /**
+     * @description 按记录结构编码变量
+     *      @param data 要编码的记录或记录数组
+     *      @return 返回编码的字符串
+     *      
+     */
+    encode(data: any): string;
+
+    /**
+     * @description 按记录结构解码数据
+     *      @param data 要解码的字符串
+     *      @return 返回解码的记录或记录数组
+     *      
+     */
+    decode(data: string): any;
+
+}
+
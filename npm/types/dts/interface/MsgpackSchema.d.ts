@@ -0,0 +1,25 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/// <reference path="../interface/Buffer.d.ts" />
+/**
+ * @description msgpack.compile 编译的记录编解码器，按记录结构以固定字段顺序编码和解码 
+ */
+declare class Class_MsgpackSchema extends Class_object {
+    /**
+     * @description 按记录结构编码变量
+     *      @param data 要编码的记录或记录数组
+     *      @return 返回编码的二进制数据
+     *      
+     */
+    encode(data: any): Class_Buffer;
+
+    /**
+     * @description 按记录结构解码数据
+     *      @param data 要解码的二进制数据
+     *      @return 返回解码的记录或记录数组
+     *      
+     */
+    decode(data: Class_Buffer): any;
+
+}
+
@@ -83,5 +83,36 @@ declare class Class_SQLite extends Class_DbConnection {
 
     backup(fileName: string, callback: (err: Error | undefined | null)=>any): void;
 
+    /**
+     * @description 执行一个 sql 查询，并以列存格式返回结果
+     * 
+     *      executeColumnar 不为每行创建对象，每一列的数据直接写入一块连续内存，适合返回大量记录的分析查询。返回结果的格式为：
+     *      ```JavaScript
+     *      {
+     *          "length": 3, // 记录数
+     *          "columns": [{
+     *              "name": "id", // 字段名
+     *              "type": "integer", // 字段类型，可能为 null, integer, float, date, text, blob
+     *              "values": Float64Array, // 数值字段的值，integer 字段有超出安全整数范围的值时为 BigInt64Array，date 字段为毫秒时间戳，空值在 Float64Array 中为 NaN，在 BigInt64Array 中为 0
+     *              "nulls": null // 有空值时为 Buffer 位图，第 i 条记录对应第 i >> 3 字节的第 i & 7 位，低位在前，为 1 表示有值
+     *          }, {
+     *              "name": "name",
+     *              "type": "text",
+     *              "offsets": Int32Array, // 长度为 length + 1，第 i 条记录的数据为 data 中 offsets[i] 至 offsets[i + 1] 的部分
+     *              "data": Buffer, // text 和 blob 字段的全部数据
+     *              "nulls": null
+     *          }],
+     *          "affected": 0,
+     *          "insertId": 0
+     *      }
+     *      ```
+     *      字段类型优先根据声明的类型确定，没有声明类型的字段根据第一个非空值确定。integer 和 float 字段中出现文本或二进制值时，字段转为 text 或 blob，之前的数值以文本形式保留。只接受一条 sql 语句。
+     *      @param sql 格式化字符串，可选参数用 ? 指定。例如：'SELECT FROM TEST WHERE [id]=?'
+     *      @param args 可选参数列表
+     *      @return 返回列存格式的查询结果
+     *      
+     */
+    executeColumnar(sql: string, ...args: any[]): FIBJS.GeneralObject;
+
 }
 
@@ -1,5 +1,6 @@
 /// <reference path="../_import/_fibjs.d.ts" />
 /// <reference path="../interface/object.d.ts" />
+/// <reference path="../interface/Buffer.d.ts" />
 /**
  * @description Script 脚本编译和运行对象
  * 
@@ -12,6 +13,19 @@
 declare class Class_Script extends Class_object {
     /**
      * @description Script 对象构造函数
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *         "filename": "<anonymous>", // 指定脚本的文件名
+     *         "lineOffset": 0, // 指定脚本的行偏移
+     *         "columnOffset": 0, // 指定脚本的列偏移
+     *         "cachedData": Buffer, // 指定由 createCachedData 生成的代码缓存，v8 拒绝时将重新编译
+     *         "produceCachedData": false // 指定是否在编译后生成代码缓存，生成的缓存保存在 cachedData 属性中
+     *      }
+     *      ```
+     * 
+     *      同一个隔离区内，源代码和选项相同的脚本只会编译一次，之后的 Script 将复用编译结果。
      *      @param code 指定要编译和运行的脚本代码
      *      @param opts 指定编译和运行选项
      *     
@@ -44,5 +58,24 @@ declare class Class_Script extends Class_object {
      */
     runInThisContext(opts?: FIBJS.GeneralObject): any;
 
+    /**
+     * @description 创建当前脚本的代码缓存，可在创建 Script 时通过 cachedData 选项使用
+     * 
+     *      运行后再创建的缓存会包含运行中编译的函数。
+     *      @return 返回代码缓存数据
+     *     
+     */
+    createCachedData(): Class_Buffer;
+
+    /**
+     * @description 查询创建时通过 produceCachedData 生成的代码缓存，未生成时为 null 
+     */
+    readonly cachedData: Class_Buffer;
+
+    /**
+     * @description 查询创建时指定的 cachedData 是否被 v8 拒绝 
+     */
+    readonly cachedDataRejected: boolean;
+
 }
 
@@ -0,0 +1,132 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/**
+ * @description SharedCache 是在进程内所有 Worker 之间共享的原生缓存
+ * 
+ * 与 LruCache 不同，SharedCache 的数据以序列化形式保存在原生内存中，不占用 JavaScript 堆，同名的 SharedCache 无论在哪个 Worker 中创建，都访问同一份存储：
+ * 
+ * ```JavaScript
+ * const util = require('util');
+ * 
+ * const c = new util.SharedCache('users', {
+ *     maxBytes: 64 * 1024 * 1024,
+ *     timeout: 60000
+ * });
+ * 
+ * c.set('u1', { name: 'lion' });
+ * var u = c.get('u2', k => db.query_user(k));
+ * ```
+ * 
+ * 缓存按键值哈希分片，每个分片独立加锁。写入的值按类型序列化保存：String 以 utf-8 保存，Buffer 保存原始数据，其它类型使用 msgpack 编码，因此读取时返回的是一个新的对象。
+ * 
+ * 容量按字节数限制，也可以同时限制条目数。淘汰策略采用 W-TinyLFU：新数据先进入一个较小的 LRU 窗口，离开窗口时与主缓存中的淘汰候选比较访问频率，只有访问更频繁的数据才会被接纳，从而避免一次性扫描冲刷掉热点数据。
+ * 
+ * get(name, updater) 在多个 Worker 同时未命中同一键值时，只会有一个调用者执行 updater，其余调用者等待其结果。
+ *  
+ */
+declare class Class_SharedCache extends Class_object {
+    /**
+     * @description SharedCache 对象构造函数
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          "maxBytes": 67108864, // 缓存占用的最大字节数，缺省为 64M
+     *          "maxEntries": 0, // 缓存的最大条目数，0 表示不限制，缺省为 0
+     *          "timeout": 0, // 元素缺省失效时间，单位是 ms，小于等于 0 不失效，缺省为 0
+     *          "shards": 16 // 分片数量，缺省为 16
+     *      }
+     *      ```
+     *      容量限制平均分配到各个分片，每个分片独立淘汰。同名缓存在进程生命周期内共享同一份存储，选项以首次创建时为准。
+     *      @param name 指定缓存名称
+     *      @param opts 构造选项
+     *      
+     */
+    constructor(name: string, opts?: FIBJS.GeneralObject);
+
+    /**
+     * @description 查询缓存名称 
+     */
+    readonly name: string;
+
+    /**
+     * @description 查询缓存内条目个数 
+     */
+    readonly size: number;
+
+    /**
+     * @description 查询缓存内数据占用的字节数 
+     */
+    readonly bytes: number;
+
+    /**
+     * @description 查询缓存运行统计
+     * 
+     *      返回的统计对象结构如下：
+     *      ```JavaScript
+     *      {
+     *          "size": 100, // 条目个数
+     *          "bytes": 102400, // 占用的字节数
+     *          "hits": 1000, // 命中次数
+     *          "misses": 10, // 未命中次数
+     *          "evictions": 5, // 因容量淘汰的条目数
+     *          "rejections": 3, // 未被 TinyLFU 接纳的条目数
+     *          "expirations": 2, // 过期失效的条目数
+     *          "loads": 10, // updater 的调用次数
+     *          "waits": 4 // 等待其它调用者 updater 结果的次数
+     *      }
+     *      ```
+     *      
+     */
+    readonly stats: FIBJS.GeneralObject;
+
+    /**
+     * @description 清除缓存数据 
+     */
+    clear(): void;
+
+    /**
+     * @description 检查缓存内是否存在指定键值的数据
+     *      @param name 指定要检查的键值
+     *      @return 返回键值是否存在
+     *      
+     */
+    has(name: string): boolean;
+
+    /**
+     * @description 查询指定键值的值
+     *      @param name 指定要查询的键值
+     *      @return 返回键值所对应的值，若不存在，则返回 undefined
+     *      
+     */
+    get(name: string): any;
+
+    /**
+     * @description 查询指定键值的值，若不存在或过期，则调用回调函数更新数据
+     * 
+     *      多个 Worker 同时查询同一个不存在的键值时，只有一个调用者会执行 updater，其余调用者等待并返回其结果。updater 返回 undefined 或 null 时不缓存。
+     *      @param name 指定要查询的键值
+     *      @param updater 指定更新函数
+     *      @return 返回键值所对应的值
+     *      
+     */
+    get(name: string, updater: (...args: any[])=>any): any;
+
+    /**
+     * @description 设定一个键值数据，键值不存在则插入一条新数据
+     *      @param name 指定要设定的键值
+     *      @param value 指定要设定的数据，为 undefined 时删除该键值
+     *      @param timeout 指定该元素的失效时间，单位是 ms，小于 0 时使用缓存的缺省失效时间，等于 0 时不失效，缺省为 -1
+     *      
+     */
+    set(name: string, value: any, timeout?: number): void;
+
+    /**
+     * @description 删除指定键值的数据
+     *      @param name 指定要删除的键值
+     *      
+     */
+    remove(name: string): void;
+
+}
+
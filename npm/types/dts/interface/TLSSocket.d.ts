@@ -102,5 +102,14 @@ declare class Class_TLSSocket extends Class_Stream {
      */
     readonly localPort: number;
 
+    /**
+     * @description 查询当前连接是否启用了内核 tls 发送卸载(kTLS)
+     * 
+     *      握手完成后，在 Linux 上，若内核支持且协商结果为 TLS 1.2 AES-GCM，发送方向的记录加密将交由内核完成，
+     *      此时数据直接写入下层套接口，不再经过用户态加密。不满足条件时使用原有的加密路径，此属性为 false。
+     *     
+     */
+    readonly ktls: boolean;
+
 }
 
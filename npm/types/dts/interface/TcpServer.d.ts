@@ -78,5 +78,15 @@ declare class Class_TcpServer extends Class_object {
      */
     handler: Class_Handler;
 
+    /**
+     * @description 查询和设置最大连接数，超出的连接在接受后立即关闭，0 表示不限制，缺省为 0 
+     */
+    maxConnections: number;
+
+    /**
+     * @description 查询服务器当前正在处理的连接数 
+     */
+    readonly connections: number;
+
 }
 
@@ -60,6 +60,16 @@ declare class Class_WebSocket extends Class_EventEmitter {
      *          "headers": // specify the http headers, default is {}
      *      }
      *      ```
+     *      perMessageDeflate 也可以是一个对象，用于协商 permessage-deflate 参数，参见 ws.upgrade：
+     *      ```JavaScript
+     *      {
+     *          "serverNoContextTakeover": false, // 服务端每条消息独立压缩，不保留压缩上下文
+     *          "clientNoContextTakeover": false, // 客户端每条消息独立压缩，不保留压缩上下文
+     *          "serverMaxWindowBits": 15, // 服务端压缩窗口大小，9 到 15
+     *          "clientMaxWindowBits": 15 // 客户端压缩窗口大小，9 到 15
+     *      }
+     *      ```
+     *      不保留上下文的一方不再为每个连接常驻压缩状态，压缩流从进程共享的池中借用，窗口越小占用的内存越少。
      *      @param url 指定连接的服务器
      *      @param opts 连接选项，缺省是 {}
      *     
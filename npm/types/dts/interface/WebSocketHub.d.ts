@@ -0,0 +1,106 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/// <reference path="../interface/WebSocket.d.ts" />
+/// <reference path="../interface/Buffer.d.ts" />
+/**
+ * @description WebSocket 广播中心，将一条消息编码一次后发送给全部订阅者
+ * 
+ *  逐个调用 WebSocket.send 向大量连接推送同一条消息时，每个连接都要重新组帧，启用 permessage-deflate 时还要重新压缩。WebSocketHub 在发布时只组帧一次，需要压缩时也只压缩一次，生成的帧由全部订阅者共享，在后台 I/O 线程中写入各个连接：
+ *  ```JavaScript
+ *  var ws = require('ws');
+ *  var http = require('http');
+ * 
+ *  var hub = new ws.Hub();
+ * 
+ *  var svr = new http.Server(80, {
+ *      '/ws': ws.upgrade((conn, req) => {
+ *          hub.subscribe(conn, 'news');
+ *      })
+ *  });
+ *  svr.start();
+ * 
+ *  hub.publish('news', JSON.stringify({ title: 'hello' }));
+ *  ```
+ *  压缩帧不使用上下文接管，每条消息独立压缩，因此可以被任何启用了 permessage-deflate 的连接接收。连接收到压缩的广播帧后，它自己的压缩上下文会被重置。
+ * 
+ *  每个连接待写入的广播数据有上限，超过上限的慢速连接会被移出 WebSocketHub 并断开，触发 error 事件，错误代码为 1008。已经关闭的连接在下次发布时自动移除。只有服务端的 WebSocket 可以订阅。
+ * 
+ */
+declare class Class_WebSocketHub extends Class_object {
+    /**
+     * @description WebSocketHub 对象构造函数
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          "maxBufferedBytes": 4194304 // 每个连接待写入广播数据的最大字节数，超过后断开该连接，缺省为 4M
+     *      }
+     *      ```
+     *      @param opts 构造选项
+     * 
+     */
+    constructor(opts?: FIBJS.GeneralObject);
+
+    /**
+     * @description 将连接加入指定主题
+     *      @param sock 指定服务端 WebSocket 对象
+     *      @param topic 指定主题，缺省为空字符串
+     * 
+     */
+    subscribe(sock: Class_WebSocket, topic?: string): void;
+
+    /**
+     * @description 将连接移出指定主题
+     *      @param sock 指定 WebSocket 对象
+     *      @param topic 指定主题，缺省为空字符串
+     * 
+     */
+    unsubscribe(sock: Class_WebSocket, topic?: string): void;
+
+    /**
+     * @description 向主题的全部订阅者发送文本消息
+     *      @param topic 指定主题
+     *      @param data 指定发送的文本
+     *      @return 返回消息进入发送队列的连接数量
+     * 
+     */
+    publish(topic: string, data: string): number;
+
+    /**
+     * @description 向主题的全部订阅者发送二进制消息
+     *      @param topic 指定主题
+     *      @param data 指定发送的二进制数据
+     *      @return 返回消息进入发送队列的连接数量
+     * 
+     */
+    publish(topic: string, data: Class_Buffer): number;
+
+    /**
+     * @description 查询主题的订阅者数量
+     *      @param topic 指定主题，缺省为空字符串
+     *      @return 返回订阅者数量
+     * 
+     */
+    count(topic?: string): number;
+
+    /**
+     * @description 查询运行统计
+     * 
+     *      返回的统计对象结构如下：
+     *      ```JavaScript
+     *      {
+     *          "topics": 2, // 主题数量
+     *          "subscribers": 100, // 全部主题的订阅数
+     *          "published": 10, // 发布的消息数
+     *          "frames": 1000, // 写入连接的帧数
+     *          "encoded": 12, // 实际组帧或压缩的次数
+     *          "bytes": 102400, // 写入连接的字节数
+     *          "evicted": 1 // 因待写入数据超限被断开的连接数
+     *      }
+     *      ```
+     * 
+     */
+    readonly stats: FIBJS.GeneralObject;
+
+}
+
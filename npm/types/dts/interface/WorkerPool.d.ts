@@ -0,0 +1,100 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/object.d.ts" />
+/**
+ * @description WorkerPool 对象维护一组常驻的 Worker 线程，用于将 CPU 密集型的 JavaScript 任务分发到多个核心并行执行
+ * 
+ * `coroutine.parallel` 只能在同一个 vm 的多个 fiber 间分配任务，无法利用多核。WorkerPool 在创建时启动 size 个独立的 vm，每个 vm 加载同一个入口模块，之后通过 run 调用模块导出的函数：
+ * 
+ * ```JavaScript
+ * // hash.js
+ * exports.fib = n => n <= 1 ? n : exports.fib(n - 1) + exports.fib(n - 2);
+ * ```
+ * 
+ * ```JavaScript
+ * const { WorkerPool } = require('worker_threads');
+ * 
+ * const pool = new WorkerPool(__dirname + '/hash.js', {
+ *     size: 4
+ * });
+ * 
+ * var r = pool.run('fib', [30]);
+ * ```
+ * 
+ * 每个 Worker 拥有独立的本地任务队列，任务按照队列长度分派到较空闲的 Worker，空闲的 Worker 会从其它 Worker 的队列中窃取任务，以保证负载均衡。参数与返回值通过 Worker 消息通道传递，支持的类型与 Worker.postMessage 相同。
+ *  
+ */
+declare class Class_WorkerPool extends Class_object {
+    /**
+     * @description WorkerPool 对象构造函数
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          "size": 4, // Worker 数量，缺省为 CPU 核数
+     *          "file_system": true, // 是否允许 Worker 访问文件系统，缺省为 true
+     *          "safe_buffer": false // 是否在 Worker 内启用 safe buffer，缺省为 false
+     *      }
+     *      ```
+     *      @param path 指定 Worker 入口模块，只接受绝对路径
+     *      @param opts 构造选项
+     *      
+     */
+    constructor(path: string, opts?: FIBJS.GeneralObject);
+
+    /**
+     * @description 在池中的某个 Worker 内调用入口模块导出的函数，并等待返回
+     *      @param fn 指定要调用的导出函数名称
+     *      @param args 指定调用参数
+     *      @return 返回函数执行结果，若函数返回 Promise，则返回 Promise 的结果
+     *      
+     */
+    run(fn: string, args?: any[]): any;
+
+    run(fn: string, args?: any[], callback?: (err: Error | undefined | null, retVal: any)=>any): void;
+
+    /**
+     * @description 取消所有尚未开始执行的任务，被取消的 run 调用将抛出错误
+     *      @return 返回取消的任务数量
+     *      
+     */
+    cancel(): number;
+
+    /**
+     * @description 关闭线程池，取消所有尚未开始执行的任务，并在当前任务完成后停止全部 Worker 
+     */
+    close(): void;
+
+    /**
+     * @description 查询池中 Worker 的数量 
+     */
+    readonly size: number;
+
+    /**
+     * @description 查询等待执行的任务数量 
+     */
+    readonly pending: number;
+
+    /**
+     * @description 查询线程池运行统计
+     * 
+     *      返回的统计对象结构如下：
+     *      ```JavaScript
+     *      {
+     *          "workers": 4, // Worker 数量
+     *          "pending": 0, // 等待执行的任务数量
+     *          "running": 0, // 正在执行的任务数量
+     *          "completed": 100, // 成功完成的任务数量
+     *          "failed": 0, // 执行失败的任务数量
+     *          "cancelled": 0, // 被取消的任务数量
+     *          "stolen": 12, // 被其它 Worker 窃取执行的任务数量
+     *          "queues": [0, 0, 0, 0], // 各 Worker 本地队列深度
+     *          "wait": { "avg": 0.1, "max": 2.3 }, // 任务排队时间，单位 ms
+     *          "run": { "avg": 10.2, "max": 31.5 } // 任务执行时间，单位 ms
+     *      }
+     *      ```
+     *      
+     */
+    readonly stats: FIBJS.GeneralObject;
+
+}
+
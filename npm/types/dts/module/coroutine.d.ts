@@ -4,6 +4,7 @@
 /// <reference path="../interface/Condition.d.ts" />
 /// <reference path="../interface/Event.d.ts" />
 /// <reference path="../interface/Worker.d.ts" />
+/// <reference path="../interface/WorkerPool.d.ts" />
 /// <reference path="../interface/Fiber.d.ts" />
 /**
  * @description 并发控制模块
@@ -58,6 +59,11 @@ declare module 'coroutine' {
      */
     const Worker: typeof Class_Worker;
 
+    /**
+     * @description 多线程工作池对象，参见 WorkerPool 
+     */
+    const WorkerPool: typeof Class_WorkerPool;
+
     /**
      * @description 启动一个纤程并返回纤程对象
      *      @param func 制定纤程执行的函数
@@ -269,6 +269,8 @@ declare module 'crypto' {
 
     /**
      * @description 用于创建数据的一次性哈希摘要的实用程序。当散列少量可用的数据（<= 5MB）时，它比基于对象的 crypto.createHash() 更快。如果数据很大或者是流式传输，仍然建议使用 crypto.createHash()
+     * 
+     *      数据小于 64K 时直接在当前线程计算，否则交由后台线程池计算，计算期间不会阻塞其它 fiber。
      *      @param algorithm 指定签名算法，使用 crypto.getHashes 获取可用摘要算法的名称
      *      @param data 指定要签名的数据
      *      @param outputEncoding 指定输出编码，缺省为 "hex"
@@ -277,6 +279,25 @@ declare module 'crypto' {
      */
     function hash(algorithm: string, data: Class_Buffer, outputEncoding?: string): any;
 
+    function hash(algorithm: string, data: Class_Buffer, outputEncoding?: string, callback?: (err: Error | undefined | null, retVal: any)=>any): void;
+
+    /**
+     * @description 使用同一种算法一次计算多个数据块的哈希摘要，适用于批量校验数据完整性
+     * 
+     *      数据总量较大时，数据块会按字节数分组，由后台线程池中的多个线程并行计算。
+     *      ```JavaScript
+     *      var results = crypto.hashBatch('sha256', [data1, data2, data3]);
+     *      ```
+     *      @param algorithm 指定摘要算法，使用 crypto.getHashes 获取可用摘要算法的名称
+     *      @param datas 指定要计算摘要的数据块数组
+     *      @param outputEncoding 指定输出编码，缺省为 "hex"
+     *      @return 返回与数据块顺序一致的摘要数组
+     *     
+     */
+    function hashBatch(algorithm: string, datas: any[], outputEncoding?: string): any[];
+
+    function hashBatch(algorithm: string, datas: any[], outputEncoding?: string, callback?: (err: Error | undefined | null, retVal: any[])=>any): void;
+
     /**
      * @description 生成指定尺寸的随机数，使用 havege 生成器
      *      @param size 指定生成的随机数尺寸
@@ -558,5 +579,27 @@ declare module 'crypto' {
 
     function verify(algorithm: any, data: Class_Buffer, key: FIBJS.GeneralObject, signature: Class_Buffer, callback: (err: Error | undefined | null, retVal: boolean)=>any): void;
 
+    /**
+     * @description 使用同一种算法批量验证多个签名，适用于大量校验 Ed25519、ECDSA 等签名的场景
+     * 
+     *      items 中的每一项为如下结构的对象：
+     *      ```JavaScript
+     *      {
+     *          "data": Buffer, // 要验证的数据
+     *          "key": publicKey, // 公钥，可以是 KeyObject、公钥数据或者与 crypto.verify 相同的密钥参数对象
+     *          "signature": Buffer // 签名数据
+     *      }
+     *      ```
+     *      批量验证会被分块交给后台线程池中的多个线程并行处理。以公钥数据形式传入的公钥解析后会被缓存，相同的公钥不会重复解码；同一批次中的同一个密钥参数对象只解析一次。
+     *      无法解析的公钥或者格式错误的签名视为验证失败，不会中断整批验证。
+     *      @param algorithm 指定签名算法，使用 crypto.getHashes 获取可用摘要算法的名称
+     *      @param items 指定要验证的签名数组
+     *      @return 返回与 items 顺序一致的验证结果数组
+     *     
+     */
+    function verifyBatch(algorithm: any, items: any[]): any[];
+
+    function verifyBatch(algorithm: any, items: any[], callback: (err: Error | undefined | null, retVal: any[])=>any): void;
+
 }
 
@@ -307,6 +307,18 @@ declare module 'fs' {
 
     function read(fd: Class_FileHandle, buffer: Class_Buffer, offset?: number, length?: number, position?: number, callback?: (err: Error | undefined | null, retVal: number)=>any): void;
 
+    /**
+     * @description 根据文件描述符，将文件内容依次读入一组 Buffer
+     *      @param fd 文件描述符对象
+     *      @param buffers 读取结果写入的 Buffer 数组，按顺序填满每个 Buffer 后再写入下一个
+     *      @param position 文件读取位置，默认为当前文件位置
+     *      @return 实际读取的字节数
+     *      
+     */
+    function readv(fd: Class_FileHandle, buffers: any[], position?: number): number;
+
+    function readv(fd: Class_FileHandle, buffers: any[], position?: number, callback?: (err: Error | undefined | null, retVal: number)=>any): void;
+
     /**
      * @description 根据文件描述符，改变文件模式。只在 POSIX 系统有效。
      *      @param fd 文件描述符对象
@@ -0,0 +1,113 @@
+/// <reference path="../_import/_fibjs.d.ts" />
+/// <reference path="../interface/Counter.d.ts" />
+/// <reference path="../interface/Gauge.d.ts" />
+/// <reference path="../interface/Histogram.d.ts" />
+/// <reference path="../interface/Handler.d.ts" />
+/**
+ * @description 运行时指标模块，以 OpenMetrics 格式输出进程内的计数器、仪表和直方图
+ * 
+ *  引用方法：
+ *  ```JavaScript
+ *  var metrics = require('metrics');
+ *  ```
+ * 
+ *  指标在进程内所有 Worker 之间共享，不同 Worker 以相同名称和标签创建的指标访问的是同一个时间序列，更新操作无锁完成。
+ * 
+ *  模块内置了以下指标：
+ *  - fibjs_async_pool_pending，fibjs_async_pool_workers：异步线程池的排队任务数和工作线程数，pool 标签区分 async 和 longsync
+ *  - fibjs_js_jobs_pending：等待 JavaScript 执行的任务数
+ *  - fibjs_event_loop_lag_microseconds：任务从投递到开始执行的等待时间
+ *  - fibjs_http_server_request_duration_microseconds：HttpHandler 处理请求的时间
+ *  - fibjs_http_client_request_duration_microseconds，fibjs_http_client_errors：HttpClient 请求的时间和失败次数
+ *  - fibjs_db_query_duration_microseconds，fibjs_db_query_errors：数据库查询的时间和失败次数
+ *  - fibjs_http_server_shed_requests：HttpHandler 因并发限制直接返回 503 的请求数
+ *  - fibjs_net_sockets：存活的 Socket 对象数量
+ *  - fibjs_net_rejected_connections：TcpServer 因超过 maxConnections 而关闭的连接数
+ * 
+ *  通过 handler 可以直接向 Prometheus 提供采集服务：
+ *  ```JavaScript
+ *  var svr = new http.Server(8080, {
+ *      '/metrics': metrics.handler(),
+ *      '/api': api_handler
+ *  });
+ *  ```
+ *  
+ */
+declare module 'metrics' {
+    /**
+     * @description 计数器对象，参见 Counter 
+     */
+    const Counter: typeof Class_Counter;
+
+    /**
+     * @description 仪表对象，参见 Gauge 
+     */
+    const Gauge: typeof Class_Gauge;
+
+    /**
+     * @description 直方图对象，参见 Histogram 
+     */
+    const Histogram: typeof Class_Histogram;
+
+    /**
+     * @description 获取或创建一个计数器
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          "help": "", // 指标说明
+     *          "labels": {} // 标签，同名指标不同标签为不同的时间序列
+     *      }
+     *      ```
+     *      名称以 _total 结尾时，输出时以去掉 _total 后的名称作为指标族名称。
+     *      @param name 指定指标名称，必须符合 [a-zA-Z_:][a-zA-Z0-9_:]*
+     *      @param opts 指定指标选项
+     *      @return 返回计数器对象
+     *      
+     */
+    function counter(name: string, opts?: FIBJS.GeneralObject): Class_Counter;
+
+    /**
+     * @description 获取或创建一个仪表
+     * 
+     *      opts 支持的选项与 counter 相同。
+     *      @param name 指定指标名称
+     *      @param opts 指定指标选项
+     *      @return 返回仪表对象
+     *      
+     */
+    function gauge(name: string, opts?: FIBJS.GeneralObject): Class_Gauge;
+
+    /**
+     * @description 获取或创建一个直方图
+     * 
+     *      opts 除支持 counter 的选项外，还支持：
+     *      ```JavaScript
+     *      {
+     *          "buckets": [1, 2, 5, 10, ...] // 输出的桶上界，必须递增，缺省为 1 至 10000000 的 1-2-5 序列
+     *      }
+     *      ```
+     *      直方图内部以对数线性分桶记录数据，相对误差小于 3.2%，buckets 只影响输出格式，同一时间序列以首次创建时的 buckets 为准。
+     *      @param name 指定指标名称
+     *      @param opts 指定指标选项
+     *      @return 返回直方图对象
+     *      
+     */
+    function histogram(name: string, opts?: FIBJS.GeneralObject): Class_Histogram;
+
+    /**
+     * @description 以 OpenMetrics 文本格式输出全部指标
+     *      @return 返回指标文本
+     *      
+     */
+    function collect(): string;
+
+    /**
+     * @description 创建一个输出全部指标的 http 处理器
+     *      @return 返回处理器对象
+     *      
+     */
+    function handler(): Class_Handler;
+
+}
+
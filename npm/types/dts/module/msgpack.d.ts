@@ -1,5 +1,6 @@
 /// <reference path="../_import/_fibjs.d.ts" />
 /// <reference path="../interface/Buffer.d.ts" />
+/// <reference path="../interface/MsgpackSchema.d.ts" />
 /**
  * @description msgpack是一种比 JSON 更轻量的数据交换格式，它可以将 JSON 对象序列化为二进制数据，以达到更快、更高效的数据交换效果
  * 
@@ -59,5 +60,24 @@ declare module 'msgpack' {
      */
     function decode(data: Class_Buffer): any;
 
+    /**
+     * @description 按记录结构编译专用的编解码器
+     * 
+     *      schema 是一个示例记录，其属性名按顺序定义记录的字段。属性值为普通对象时字段为嵌套记录，为只包含一个普通对象的数组时字段为记录数组，其它值表示任意类型的字段。
+     *      ```JavaScript
+     *      var codec = msgpack.compile({
+     *          id: 0,
+     *          name: "",
+     *          owner: { id: 0, name: "" },
+     *          items: [{ sku: "", qty: 0 }]
+     *      });
+     *      ```
+     *      编译后的编解码器只处理 schema 中定义的字段，编码时忽略其它属性，解码时丢弃未知字段，值为 undefined 的字段不会编码。数据为数组时按记录数组处理。
+     *      @param schema 示例记录
+     *      @return 返回编译后的编解码器
+     *      
+     */
+    function compile(schema: FIBJS.GeneralObject): Class_MsgpackSchema;
+
 }
 
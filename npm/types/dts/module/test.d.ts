@@ -236,6 +236,60 @@ declare module 'test' {
      */
     function run(mode: number): FIBJS.GeneralObject;
 
+    /**
+     * @description 运行一个基准测试，输出并返回测试结果
+     * 
+     *      bench 首先在预热阶段反复调用 fn，并根据预热时的耗时自动确定每个采样批次的调用次数，随后以高精度时钟对多个批次采样，统计每秒操作数及其 95% 置信区间。fn 可以是普通函数、async 函数或接受 done 回调的函数。
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          "warmup": 100, // 预热时间，单位 ms，缺省为 100
+     *          "time": 1000, // 采样时间，单位 ms，缺省为 1000
+     *          "minSamples": 5, // 最少采样批次，缺省为 5
+     *          "iterations": 0, // 指定每个批次的调用次数，缺省为 0，自动确定
+     *          "concurrency": 1, // 并发 fiber 数量，大于 1 时每个批次由多个 fiber 并发完成
+     *          "baseline": {}, // 用于比较的基线结果，可以是之前的 bench 结果，或以测试名称为键的结果集合
+     *          "threshold": 5 // 判定为性能退化的阀值，单位 %，缺省为 5
+     *      }
+     *      ```
+     * 
+     *      返回结果结构如下：
+     *      ```JavaScript
+     *      {
+     *          "name": "Buffer.concat", // 测试名称
+     *          "ops": 1234567.8, // 每秒操作数
+     *          "mean": 810.0, // 每次操作的平均耗时，单位 ns
+     *          "sd": 12.5, // 每次操作耗时的标准差，单位 ns
+     *          "rme": 0.52, // 相对误差，95% 置信区间，单位 %
+     *          "samples": 20, // 采样批次
+     *          "iterations": 61728, // 每个批次的调用次数
+     *          "concurrency": 1, // 并发 fiber 数量
+     *          "gc": { // 采样期间的 GC 统计
+     *              "count": 3, // GC 次数
+     *              "scavenge": 3, // 新生代 GC 次数
+     *              "markSweep": 0, // 全量 GC 次数
+     *              "time": 0.42 // GC 耗时，单位 ms
+     *          },
+     *          "heap": {
+     *              "allocated": 1048576, // 采样期间堆内存分配的字节数
+     *              "allocatedPerOp": 0.85 // 平均每次操作分配的字节数
+     *          },
+     *          "baseline": { // 仅在指定 baseline 时返回
+     *              "ops": 1200000, // 基线的每秒操作数
+     *              "diff": 2.88, // 相对于基线的变化，单位 %
+     *              "regression": false // 是否判定为性能退化
+     *          }
+     *      }
+     *      ```
+     *      @param name 指定测试名称
+     *      @param fn 指定被测试的函数
+     *      @param opts 指定测试选项
+     *      @return 返回测试结果
+     *      
+     */
+    function bench(name: string, fn: (...args: any[])=>any, opts?: FIBJS.GeneralObject): FIBJS.GeneralObject;
+
     /**
      * @description 断言测试模块，如果测试值为假，则报错，报错行为可设定继续运行或者错误抛出 
      */
@@ -38,6 +38,7 @@ declare module 'tls' {
      *      - maxVersion: 设置允许的最大 TLS 版本。 'TLSv1.3' 、 'TLSv1.2' 、 'TLSv1.1' 或 'TLSv1' 之一。不能与 secureProtocol 选项一起指定。
      *      - minVersion: 设置允许的最低 TLS 版本。 'TLSv1.3' 、 'TLSv1.2' 、 'TLSv1.1' 或 'TLSv1' 之一。不能与 secureProtocol 选项一起指定。
      *      - secureProtocol: 传统机制选择要使用的 TLS 协议版本，不支持最小和最大版本的独立控制，也不支持将协议限制为 TLSv1.3。建议改用 minVersion 和 maxVersion。
+     *      - ciphers: TLS 1.2 及以下版本使用的 OpenSSL 密码套件列表，例如 'ECDHE-RSA-AES128-GCM-SHA256'。缺省使用 OpenSSL 的默认列表。
      *      - sessionTimeout: 经过多少秒后，服务器创建的 TLS 会话将不再可恢复。默认值: 300。
      * 
      *      @param options 创建安全上下文的选项
@@ -60,6 +61,20 @@ declare module 'tls' {
      */
     const secureContext: Class_SecureContext;
 
+    /**
+     * @description 查询和设置客户端 tls 会话缓存的最大条目数，缺省 1024，设置为 0 禁用缓存
+     * 
+     *      会话缓存由进程内全部工作线程共享，按安全上下文、对方地址和服务器名称区分，用于 HttpClient 和 TLSSocket.connect 建立的连接恢复会话，支持 session ticket 和 TLS 1.3 PSK。
+     *      缓存命中与恢复情况通过 metrics 模块的 fibjs_tls_session_cache_lookups 和 fibjs_tls_client_handshakes 输出。
+     *     
+     */
+    var sessionCacheSize: number;
+
+    /**
+     * @description 查询和设置客户端 tls 会话缓存的过期时间，缺省 300 秒，会话本身的有效期更短时以会话为准 
+     */
+    var sessionCacheTimeout: number;
+
     /**
      * @description 根据 url 创建一个 tls/ssl 连接
      *      @param url 指定连接的 URL
@@ -1,5 +1,6 @@
 /// <reference path="../_import/_fibjs.d.ts" />
 /// <reference path="../interface/LruCache.d.ts" />
+/// <reference path="../interface/SharedCache.d.ts" />
 /// <reference path="../interface/TextDecoder.d.ts" />
 /// <reference path="../interface/TextEncoder.d.ts" />
 /// <reference path="../module/types.d.ts" />
@@ -64,6 +65,11 @@ declare module 'util' {
      */
     const LruCache: typeof Class_LruCache;
 
+    /**
+     * @description 在全部 Worker 之间共享的原生缓存对象，参见 SharedCache 对象。
+     */
+    const SharedCache: typeof Class_SharedCache;
+
     /**
      * @description TextDecoder 解码对象，参见 TextDecoder 对象。
      */
@@ -629,6 +635,38 @@ declare module 'util' {
      */
     function compile(srcname: string, script: string, mode?: number): Class_Buffer;
 
+    /**
+     * @description 将模块和资源打包为单文件应用包
+     *      应用包将文件原样顺序存放，并附带按文件名哈希的索引。运行时整个文件被映射到内存，require 加载其中的模块时直接查找索引，不需要读取和解压。
+     * 
+     *      应用包使用与 zip 相同的虚拟路径，可以通过 require('/path/to/app.fjb$/index.js') 加载其中的模块。应用包追加到 fibjs 可执行文件之后，即成为单文件可执行程序，启动时自动运行包内的 index.js 或 package.json 指定的入口：
+     *      ```JavaScript
+     *      var fs = require('fs');
+     *      var util = require('util');
+     * 
+     *      fs.copyFile(process.execPath, 'app');
+     *      fs.appendFile('app', util.bundle({
+     *          'index.js': fs.readFile('index.js'),
+     *          'lib/a.js': fs.readFile('lib/a.js'),
+     *          'assets/logo.png': fs.readFile('assets/logo.png')
+     *      }));
+     *      ```
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          codeCache: true // 为 .js 模块预先编译并保存 v8 代码缓存，缺省为 true
+     *      }
+     *      ```
+     *      代码缓存与 v8 版本相关，由其他版本 fibjs 生成的代码缓存会被忽略，模块仍然可以从源码正常加载。
+     * 
+     *      @param files 指定要打包的文件，键为包内的文件名，值为 String 或 Buffer
+     *      @param opts 指定打包选项
+     *      @return 返回应用包的二进制数据
+     *      
+     */
+    function bundle(files: FIBJS.GeneralObject, opts?: FIBJS.GeneralObject): Class_Buffer;
+
     /**
      * @description 包裹 callback 或 async 函数为同步调用
      * 
@@ -1,6 +1,7 @@
 /// <reference path="../_import/_fibjs.d.ts" />
 /// <reference path="../interface/SandBox.d.ts" />
 /// <reference path="../interface/Script.d.ts" />
+/// <reference path="../interface/ContextPool.d.ts" />
 /**
  * @description 沙箱模块，用于隔离不同安全等级的运行环境
  * 
@@ -17,6 +18,13 @@
  * 
  *  var mod_in_sbox = sbox.require('./path/to/mod');
  *  ```
+ * 
+ *  纯 JavaScript 的 CommonJS 模块可以预先加载到启动快照中：
+ *  ```sh
+ *  fibjs --build-snapshot --snapshot-blob=app.blob lib/a.js lib/b.js
+ *  fibjs --snapshot-blob=app.blob main.js
+ *  ```
+ *  生成快照时会依次运行给定的模块，它们只能使用 JavaScript 内置对象，以及用相对路径引用在它之前预加载的模块。使用快照启动时，这些模块以完整路径安装到每个沙箱的模块缓存中，require 时不再读取，编译和运行。由其它版本的 fibjs 生成的快照会在启动时被拒绝。
  *  
  */
 declare module 'vm' {
@@ -30,6 +38,11 @@ declare module 'vm' {
      */
     const Script: typeof Class_Script;
 
+    /**
+     * @description 创建一个 ContextPool 对象，参见 ContextPool 
+     */
+    const ContextPool: typeof Class_ContextPool;
+
     /**
      * @description 创建一个上下文对象
      *      @param contextObject 指定将被上下文化的对象
@@ -105,5 +118,13 @@ declare module 'vm' {
      */
     function runInThisContext(code: string, filename: string): any;
 
+    /**
+     * @description 清除模块解析缓存
+     * 
+     *      使用 --resolve-cache 启动时，require 会在进程内缓存文件的真实路径，目录列表，package.json 指定的入口以及模块 id 的解析结果，所有 SandBox 和 Worker 共享这个缓存。缓存不会感知文件的变化，在磁盘上增加或修改模块后，需要调用此方法使其重新查找。解析结果按沙箱可加载的扩展名分别缓存。使用 --resolve-cache-watch 启动时，缓存会监视已查找过的目录，并自动丢弃发生变化的部分。使用 --resolve-cache=file 启动时，解析结果会保存到文件中供下次启动使用，启动后只检查保存的文件是否仍然存在，不会发现之后新增的优先级更高的文件，例如同名的 .js 文件或更近的 node_modules 中的模块，此时需要删除缓存文件。
+     *     
+     */
+    function clearResolveCache(): void;
+
 }
 
@@ -1,5 +1,6 @@
 /// <reference path="../_import/_fibjs.d.ts" />
 /// <reference path="../interface/Worker.d.ts" />
+/// <reference path="../interface/WorkerPool.d.ts" />
 /**
  * @description worker 基础模块
  * 
@@ -15,6 +16,11 @@ declare module 'worker_threads' {
      */
     const Worker: typeof Class_Worker;
 
+    /**
+     * @description 多线程工作池对象，参见 WorkerPool 
+     */
+    const WorkerPool: typeof Class_WorkerPool;
+
     /**
      * @description 查询当前 Worker 是不是主线程 
      */
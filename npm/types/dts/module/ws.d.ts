@@ -1,6 +1,7 @@
 /// <reference path="../_import/_fibjs.d.ts" />
 /// <reference path="../interface/WebSocketMessage.d.ts" />
 /// <reference path="../interface/WebSocket.d.ts" />
+/// <reference path="../interface/WebSocketHub.d.ts" />
 /// <reference path="../interface/Handler.d.ts" />
 /**
  * @description websocket 支持模块
@@ -98,6 +99,25 @@ declare module 'ws' {
      */
     const Socket: typeof Class_WebSocket;
 
+    /**
+     * @description 创建一个 websocket 广播中心，参见 WebSocketHub 
+     */
+    const Hub: typeof Class_WebSocketHub;
+
+    /**
+     * @description 查询全部 WebSocket 连接的 permessage-deflate 压缩状态占用的内存字节数 
+     */
+    const compressMemory: number;
+
+    /**
+     * @description 查询和设置 permessage-deflate 压缩状态的内存上限，缺省为 0，表示不限制
+     * 
+     *      达到上限后，新建立的连接将协商不保留压缩上下文，已建立的连接发送消息时改为从共享池借用压缩流，接收方向不受影响。
+     *      压缩内存的使用情况通过 metrics 模块的 fibjs_ws_compress_memory_bytes 和 fibjs_ws_compress_fallbacks 输出。
+     *     
+     */
+    var compressMemoryLimit: number;
+
     /**
      * @description 创建一个 websocket 协议处理器，从 http 接收 upgrade 请求并握手，生成 WebSocket 对象
      *      ```
@@ -116,6 +136,16 @@ declare module 'ws' {
      *          "maxPayload": 67108864 // specify the maximum allowed message size, default is 64MB
      *      }
      *      ```
+     *      perMessageDeflate 也可以是一个对象，用于协商 permessage-deflate 参数：
+     *      ```JavaScript
+     *      {
+     *          "serverNoContextTakeover": false, // 服务端每条消息独立压缩，不保留压缩上下文
+     *          "clientNoContextTakeover": false, // 客户端每条消息独立压缩，不保留压缩上下文
+     *          "serverMaxWindowBits": 15, // 服务端压缩窗口大小，9 到 15
+     *          "clientMaxWindowBits": 15 // 客户端压缩窗口大小，9 到 15
+     *      }
+     *      ```
+     *      不保留上下文的一方不再为每个连接常驻压缩状态，压缩流从进程共享的池中借用，窗口越小占用的内存越少。
      *      @param opts 连接选项，缺省是 {}
      *      @param accept 连接成功处理函数，回调将传递两个参数，第一个参数为接收到的 WebSocket 对象，第二个参数为握手时的 HttpRequest 对象
      *      @return 返回协议处理器，可与 HttpServer, Chain, Routing 等对接
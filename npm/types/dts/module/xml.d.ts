@@ -1,6 +1,7 @@
 /// <reference path="../_import/_fibjs.d.ts" />
 /// <reference path="../interface/XmlDocument.d.ts" />
 /// <reference path="../interface/Buffer.d.ts" />
+/// <reference path="../interface/Stream.d.ts" />
 /// <reference path="../interface/XmlNode.d.ts" />
 /**
  * @description xml 处理模块，可以使用 xml 模块解析和处理 xml 和 html 文件
@@ -104,6 +105,36 @@ declare module 'xml' {
      */
     function parse(source: Class_Buffer, type?: string): Class_XmlDocument;
 
+    /**
+     * @description 从流中增量解析 xml，以事件方式回调处理函数，不创建完整的 XmlDocument
+     * 
+     *      parseStream 每次从 stream 读取一块数据送入解析器，适用于无法一次读入内存的大型 xml 文件。handlers 支持的回调如下：
+     *      ```JavaScript
+     *      {
+     *          "startElement": (name, attrs) => {}, // 元素开始，attrs 为属性名与属性值组成的对象
+     *          "endElement": name => {}, // 元素结束
+     *          "text": data => {}, // 元素内的文本，相邻的文本与 CDATA 会合并为一次回调
+     *          "comment": data => {}, // 注释
+     *          "processingInstruction": (target, data) => {}, // 处理指令
+     *          "element": (node, path) => {} // 匹配 paths 的元素子树，node 为 XmlElement 对象
+     *      }
+     *      ```
+     * 
+     *      opts 支持的选项如下：
+     *      ```JavaScript
+     *      {
+     *          "paths": ["/rss/channel/item", "entry"], // 需要构建子树的元素路径，以 / 开头为绝对路径，否则匹配任意层级的同名元素
+     *          "bufferSize": 65536 // 每次从流中读取的字节数
+     *      }
+     *      ```
+     *      匹配 paths 的元素将构建为独立的 XmlElement 子树，整体通过 element 回调返回，其内部节点不再触发 startElement/endElement/text 等事件。任意回调抛出异常时，解析立即终止并抛出该异常。
+     *      @param stream 指定需要解析的 xml 数据流
+     *      @param handlers 指定事件回调函数
+     *      @param opts 指定解析选项
+     *     
+     */
+    function parseStream(stream: Class_Stream, handlers: FIBJS.GeneralObject, opts?: FIBJS.GeneralObject): void;
+
     /**
      * @description 序列化 XmlNode 为字符串
      *      @param node 指定需要序列化的 XmlNode
@@ -0,0 +1,18 @@
+var small = Buffer.alloc(64, 1);
+var large = Buffer.alloc(1024 * 1024, 1);
+var parts = [];
+
+for (var i = 0; i < 64; i++)
+    parts.push(Buffer.alloc(1024, i));
+
+exports.cases = {
+    "alloc(64)": () => Buffer.alloc(64),
+    "from(string)": () => Buffer.from("hello fibjs benchmark"),
+    "concat(64 x 1KB)": () => Buffer.concat(parts),
+    "slice": () => large.slice(1024, 2048),
+    "compare": () => small.compare(small),
+    "hex": () => small.hex(),
+    "base64": () => small.base64(),
+    "toString(utf8)": () => small.toString(),
+    "readInt32LE": () => large.readInt32LE(4096)
+};
@@ -0,0 +1,13 @@
+var crypto = require("crypto");
+
+var small = Buffer.alloc(64, 1);
+var large = Buffer.alloc(1024 * 1024, 1);
+var key = crypto.randomBytes(32);
+
+exports.cases = {
+    "md5(64)": () => crypto.createHash("md5").update(small).digest(),
+    "sha256(64)": () => crypto.createHash("sha256").update(small).digest(),
+    "sha256(1MB)": () => crypto.createHash("sha256").update(large).digest(),
+    "hmac_sha256(64)": () => crypto.createHmac("sha256", key).update(small).digest(),
+    "randomBytes(32)": () => crypto.randomBytes(32)
+};
@@ -0,0 +1,30 @@
+var db = require("db");
+var fs = require("fs");
+var path = require("path");
+var coroutine = require("coroutine");
+
+var fname = path.join(__dirname, `bench_${coroutine.vmid}.db`);
+var conn;
+var seq = 0;
+
+exports.setup = () => {
+    conn = db.open(`sqlite:${fname}`);
+    conn.execute("create table bench (id integer primary key, name varchar(64), value double)");
+
+    conn.trans(() => {
+        for (var i = 0; i < 1000; i++)
+            conn.execute("insert into bench (name, value) values (?, ?)", `name_${i}`, i * 0.5);
+    });
+};
+
+exports.teardown = () => {
+    conn.close();
+    fs.unlink(fname);
+};
+
+exports.cases = {
+    "select by id": () => conn.execute("select * from bench where id = ?", (seq++ % 1000) + 1),
+    "select 100 rows": () => conn.execute("select * from bench limit 100"),
+    "insert": () => conn.execute("insert into bench (name, value) values (?, ?)", "bench", seq++),
+    "format": () => conn.format("select * from bench where name = ? and value > ?", "name_1", 10)
+};
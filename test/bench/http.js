@@ -0,0 +1,32 @@
+var http = require("http");
+var coroutine = require("coroutine");
+
+var port = 8890 + coroutine.vmid * 10000;
+var url = `http://127.0.0.1:${port}/bench`;
+var body = Buffer.alloc(1024, "x");
+var svr;
+var client;
+
+exports.setup = () => {
+    svr = new http.Server(port, r => {
+        r.response.setHeader("Content-Type", "text/plain");
+        r.response.write(body);
+    });
+    svr.start();
+
+    client = new http.Client();
+};
+
+exports.teardown = () => {
+    svr.stop();
+};
+
+exports.cases = {
+    "get(1KB)": () => client.get(url).data,
+    "Request.setHeader": () => {
+        var req = new http.Request();
+        req.setHeader("Content-Type", "application/json");
+        req.setHeader("X-Request-Id", "0123456789");
+        return req;
+    }
+};
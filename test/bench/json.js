@@ -0,0 +1,34 @@
+var msgpack = require("msgpack");
+
+var obj = {
+    id: 12345,
+    name: "fibjs",
+    tags: ["a", "b", "c"],
+    nested: {
+        enabled: true,
+        ratio: 0.75,
+        items: [1, 2, 3, 4, 5, 6, 7, 8]
+    }
+};
+
+var list = [];
+for (var i = 0; i < 100; i++)
+    list.push(Object.assign({
+        seq: i
+    }, obj));
+
+var json_str = JSON.stringify(obj);
+var json_list = JSON.stringify(list);
+var pack = msgpack.encode(obj);
+var pack_list = msgpack.encode(list);
+
+exports.cases = {
+    "JSON.stringify": () => JSON.stringify(obj),
+    "JSON.parse": () => JSON.parse(json_str),
+    "JSON.stringify(100)": () => JSON.stringify(list),
+    "JSON.parse(100)": () => JSON.parse(json_list),
+    "msgpack.encode": () => msgpack.encode(obj),
+    "msgpack.decode": () => msgpack.decode(pack),
+    "msgpack.encode(100)": () => msgpack.encode(list),
+    "msgpack.decode(100)": () => msgpack.decode(pack_list)
+};
@@ -0,0 +1,69 @@
+#!/usr/local/bin/fibjs
+
+var test = require("test");
+var fs = require("fs");
+var path = require("path");
+
+const suites = ["buffer", "json", "crypto", "http", "db"];
+
+function arg(name) {
+    var pos = process.argv.indexOf(name);
+    return pos >= 0 ? process.argv[pos + 1] : undefined;
+}
+
+var save = arg("--save");
+var baseline = arg("--baseline");
+var filter = arg("--filter");
+var time = arg("--time");
+var concurrency = arg("--concurrency");
+
+var opts = {};
+
+if (baseline)
+    opts.baseline = JSON.parse(fs.readTextFile(path.resolve(baseline)));
+if (time)
+    opts.time = Number(time);
+
+var results = {};
+var regressions = [];
+
+suites.forEach(name => {
+    var suite = require(`./${name}.js`);
+    var names = Object.keys(suite.cases).filter(n => !filter || `${name}.${n}`.indexOf(filter) >= 0);
+
+    if (names.length == 0)
+        return;
+
+    console.log(`\n  ${name}`);
+
+    if (suite.setup)
+        suite.setup();
+
+    try {
+        names.forEach(n => {
+            var c = suite.cases[n];
+            var _opts = Object.assign({}, opts);
+
+            if (concurrency && c.length == 0)
+                _opts.concurrency = Number(concurrency);
+
+            var r = test.bench(`${name}.${n}`, c, _opts);
+
+            results[r.name] = r;
+            if (r.baseline && r.baseline.regression)
+                regressions.push(r);
+        });
+    } finally {
+        if (suite.teardown)
+            suite.teardown();
+    }
+});
+
+if (save)
+    fs.writeTextFile(path.resolve(save), JSON.stringify(results, null, 2));
+
+if (regressions.length) {
+    console.error(`\n  ${regressions.length} benchmarks regressed:`);
+    regressions.forEach(r => console.error(`    ${r.name}: ${r.baseline.diff.toFixed(2)}%`));
+    process.exitCode = 1;
+}
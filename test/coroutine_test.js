@@ -133,6 +133,28 @@ describe('coroutine', () => {
         it("new fiber stack_usage error", () => {
             coroutine.start(() => { }).stack_usage;
         });
+
+        it('deadline', () => {
+            var fb = coroutine.current();
+            assert.equal(fb.deadline, 0);
+
+            assert.throws(() => {
+                fb.deadline = -1;
+            });
+
+            var d = Date.now() + 1000;
+            fb.deadline = d;
+
+            try {
+                var d1;
+                coroutine.start(() => {
+                    d1 = coroutine.current().deadline;
+                }).join();
+                assert.equal(d1, d);
+            } finally {
+                fb.deadline = 0;
+            }
+        });
     });
 
     it('parallel', () => {
@@ -469,6 +491,109 @@ describe('coroutine', () => {
             });
         });
     });
+
+    describe('WorkerPool', () => {
+        var pool;
+
+        before(() => {
+            pool = new coroutine.WorkerPool(path.join(__dirname, 'worker_files/worker_pool.js'), {
+                size: 4
+            });
+        });
+
+        after(() => {
+            pool.close();
+        });
+
+        it('size', () => {
+            assert.equal(pool.size, 4);
+        });
+
+        it('run', () => {
+            assert.equal(pool.run('add', [1, 2]), 3);
+            assert.deepEqual(pool.run('echo', [{
+                a: [1, 2, 3],
+                b: 'hello'
+            }]), {
+                a: [1, 2, 3],
+                b: 'hello'
+            });
+        });
+
+        it('async function', () => {
+            assert.equal(pool.run('async_add', [100, 200]), 300);
+        });
+
+        it('callback', (done) => {
+            pool.run('add', [10, 20], (err, r) => {
+                done(() => {
+                    assert.isNull(err);
+                    assert.equal(r, 30);
+                });
+            });
+        });
+
+        it('error', () => {
+            assert.throws(() => {
+                pool.run('error');
+            });
+
+            assert.throws(() => {
+                pool.run('not_exists');
+            });
+        });
+
+        it('run in multiple workers', () => {
+            var vms = coroutine.parallel([100, 100, 100, 100, 100, 100, 100, 100], ms => pool.run('sleep', [ms]));
+
+            var ids = {};
+            vms.forEach(id => ids[id] = true);
+
+            assert.greaterThan(Object.keys(ids).length, 1);
+            assert.notProperty(ids, coroutine.vmid);
+        });
+
+        it('stats', () => {
+            var stats = pool.stats;
+
+            assert.equal(stats.workers, 4);
+            assert.equal(stats.pending, 0);
+            assert.equal(stats.queues.length, 4);
+            assert.greaterThan(stats.completed, 0);
+            assert.greaterThan(stats.failed, 0);
+            assert.property(stats.wait, 'avg');
+            assert.property(stats.run, 'max');
+        });
+
+        it('cancel', () => {
+            var p1 = new coroutine.WorkerPool(path.join(__dirname, 'worker_files/worker_pool.js'), {
+                size: 1
+            });
+
+            var errs = 0;
+            var fibers = [];
+            for (var i = 0; i < 5; i++)
+                fibers.push(coroutine.start(() => {
+                    try {
+                        p1.run('sleep', [200]);
+                    } catch (e) {
+                        errs++;
+                    }
+                }));
+
+            coroutine.sleep(50);
+            assert.greaterThan(p1.cancel(), 0);
+
+            fibers.forEach(f => f.join());
+            assert.greaterThan(errs, 0);
+            assert.equal(p1.pending, 0);
+
+            p1.close();
+            assert.throws(() => {
+                p1.run('add', [1, 2]);
+            });
+        });
+    });
 });
 
 require.main === module && test.run(console.DEBUG);
\ No newline at end of file
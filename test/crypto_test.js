@@ -2059,6 +2059,80 @@ describe('crypto', () => {
                 }
             });
 
+            it('verifyBatch', () => {
+                const ed = crypto.generateKeyPairSync('ed25519');
+                const ec = crypto.generateKeyPairSync('ec', { namedCurve: 'secp256k1' });
+                const edPem = ed.publicKey.export({ type: 'spki', format: 'pem' });
+                const items = [];
+                const expect = [];
+
+                for (var i = 0; i < 200; i++) {
+                    const data = Buffer.from('message ' + i);
+                    const sig = crypto.sign(null, data, ed.privateKey);
+                    const ok = i % 7 != 3;
+
+                    items.push({
+                        data,
+                        key: i % 2 ? ed.publicKey : edPem,
+                        signature: ok ? sig : crypto.randomBytes(64)
+                    });
+                    expect.push(ok);
+                }
+
+                assert.deepEqual(crypto.verifyBatch(null, items), expect);
+                assert.deepEqual(crypto.verifyBatch(null, items.slice(0, 5)), expect.slice(0, 5));
+                assert.deepEqual(crypto.verifyBatch(null, []), []);
+
+                const ecItems = [];
+                const ecPriv = ec.privateKey.export({ type: 'pkcs8', format: 'pem' });
+                const ecKey = { key: ec.publicKey.export({ type: 'spki', format: 'pem' }), dsaEncoding: 'ieee-p1363' };
+                for (var i = 0; i < 50; i++) {
+                    const data = Buffer.from('message ' + i);
+                    ecItems.push({
+                        data,
+                        key: ecKey,
+                        signature: crypto.sign('sha256', data, { key: ecPriv, dsaEncoding: 'ieee-p1363' })
+                    });
+                }
+                ecItems.push({
+                    data: Buffer.from('other'),
+                    key: ec.publicKey,
+                    signature: ecItems[0].signature
+                });
+                ecItems.push({
+                    data: Buffer.from('message 0'),
+                    key: 'not a key',
+                    signature: ecItems[0].signature
+                });
+
+                const r = crypto.verifyBatch('sha256', ecItems);
+                assert.equal(r.length, 52);
+                assert.deepEqual(r.slice(0, 50), new Array(50).fill(true));
+                assert.deepEqual(r.slice(50), [false, false]);
+
+                assert.throws(() => crypto.verifyBatch(null, [{ data: Buffer.from('a') }]));
+                assert.throws(() => crypto.verifyBatch(null, [1]));
+            });
+
+            it('verifyBatch callback', done => {
+                const ed = crypto.generateKeyPairSync('ed25519');
+                const data = Buffer.from('hello');
+
+                crypto.verifyBatch(null, [{
+                    data,
+                    key: ed.publicKey,
+                    signature: crypto.sign(null, data, ed.privateKey)
+                }], (err, r) => {
+                    try {
+                        assert.ifError(err);
+                        assert.deepEqual(r, [true]);
+                        done();
+                    } catch (e) {
+                        done(e);
+                    }
+                });
+            });
+
             describe('RSA-PSS', () => {
                 it('This key pair does not restrict the message digest algorithm or salt length', () => {
                     const publicPem = readKey('rsa_pss_public_2048.pem');
@@ -2179,6 +2253,26 @@ describe('crypto', () => {
                 testCipher1(Buffer.from('MySecretKey123'));
             });
 
+            it("large data", () => {
+                const key = 'MySecretKey123';
+                const data = crypto.randomBytes(1024 * 1024 + 5);
+
+                const cipher = crypto.createCipher('aes192', key);
+                const ciph = Buffer.concat([cipher.update(data), cipher.final()]);
+
+                const cipher1 = crypto.createCipher('aes192', key);
+                const parts = [];
+                for (var i = 0; i < data.length; i += 1000)
+                    parts.push(cipher1.update(data.slice(i, i + 1000)));
+                parts.push(cipher1.final());
+                assert.equal(Buffer.concat(parts).hex(), ciph.hex());
+
+                const decipher = crypto.createDecipher('aes192', key);
+                let txt = decipher.update(ciph, 'buffer', 'hex');
+                txt += decipher.final('hex');
+                assert.equal(txt, data.hex());
+            });
+
             it("encoding", () => {
                 function testCipher2(key) {
                     const plaintext =
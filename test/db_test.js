@@ -1369,6 +1369,82 @@ describe("db", () => {
             conn.close();
             conn1.close();
         });
+
+        it("executeColumnar", () => {
+            var conn = db.open(conn_str);
+
+            conn.execute("create table test_columnar (i integer, f real, t text, b blob, d datetime, n)");
+            conn.execute("insert into test_columnar values (1, 1.5, 'a', x'0102', '2020-01-01 00:00:00', 1)");
+            conn.execute("insert into test_columnar values (null, 2, null, null, null, 2.5)");
+            conn.execute("insert into test_columnar values (?, ?, ?, ?, ?, ?)", 3, 3.5, "中文", new Buffer("x"), new Date(0), "s");
+
+            var rs = conn.executeColumnar("select * from test_columnar where i > ? or i is null", 0);
+            assert.equal(rs.length, 3);
+            assert.deepEqual(rs.columns.map(c => c.name), ["i", "f", "t", "b", "d", "n"]);
+            assert.deepEqual(rs.columns.map(c => c.type), ["integer", "float", "text", "blob", "date", "text"]);
+
+            var i = rs.columns[0];
+            assert.ok(i.values instanceof Float64Array);
+            assert.equal(i.values[0], 1);
+            assert.ok(isNaN(i.values[1]));
+            assert.equal(i.values[2], 3);
+            assert.deepEqual(Array.from(i.nulls), [5]);
+
+            var f = rs.columns[1];
+            assert.deepEqual(Array.from(f.values), [1.5, 2, 3.5]);
+            assert.isNull(f.nulls);
+
+            var t = rs.columns[2];
+            assert.deepEqual(Array.from(t.offsets), [0, 1, 1, 7]);
+            assert.equal(t.data.toString("utf8", t.offsets[2], t.offsets[3]), "中文");
+            assert.deepEqual(Array.from(t.nulls), [5]);
+
+            var b = rs.columns[3];
+            assert.equal(b.data.hex(), "010278");
+
+            var d = rs.columns[4];
+            assert.equal(d.values[0], conn.execute("select d from test_columnar where i = 1")[0].d.getTime());
+            assert.ok(isNaN(d.values[1]));
+
+            var n = rs.columns[5];
+            assert.deepEqual(Array.from(n.offsets), [0, 1, 4, 5]);
+            assert.equal(n.data.toString(), "12.5s");
+            assert.isNull(n.nulls);
+
+            rs.columns.forEach(c => {
+                if (c.values)
+                    assert.equal(c.values.buffer.byteLength, c.values.byteLength);
+                if (c.offsets)
+                    assert.equal(c.offsets.buffer.byteLength, c.offsets.byteLength);
+                if (c.data)
+                    assert.equal(c.data.buffer.byteLength, c.data.byteLength);
+                if (c.nulls)
+                    assert.equal(c.nulls.buffer.byteLength, c.nulls.byteLength);
+            });
+
+            rs = conn.executeColumnar("select column1 as m from (values (null), (1), (1.5))");
+            assert.equal(rs.columns[0].type, "float");
+            assert.ok(isNaN(rs.columns[0].values[0]));
+            assert.deepEqual(Array.from(rs.columns[0].values).slice(1), [1, 1.5]);
+
+            rs = conn.executeColumnar("select 9007199254740993 as v");
+            assert.ok(rs.columns[0].values instanceof BigInt64Array);
+            assert.equal(rs.columns[0].values[0], 9007199254740993n);
+
+            rs = conn.executeColumnar("select * from test_columnar where 0");
+            assert.equal(rs.length, 0);
+            assert.equal(rs.columns[2].offsets.length, 1);
+
+            rs = conn.executeColumnar("delete from test_columnar");
+            assert.equal(rs.affected, 3);
+
+            assert.throws(() => {
+                conn.executeColumnar("select 1; select 2");
+            });
+
+            conn.execute("drop table test_columnar");
+            conn.close();
+        });
     });
 
     // if (global.full_test)
@@ -208,6 +208,92 @@ describe('encoding', () => {
         }
     });
 
+    describe('fuzz', () => {
+        const B64 = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/';
+
+        function rand_buffer(n) {
+            var b = Buffer.alloc(n);
+            for (var i = 0; i < n; i++)
+                b[i] = Math.floor(Math.random() * 256);
+            return b;
+        }
+
+        function hex_ref(b) {
+            var s = '';
+            for (var i = 0; i < b.length; i++)
+                s += (b[i] < 16 ? '0' : '') + b[i].toString(16);
+            return s;
+        }
+
+        function base64_ref(b) {
+            var s = '';
+            for (var i = 0; i < b.length; i += 3) {
+                var v = (b[i] << 16) | ((b[i + 1] || 0) << 8) | (b[i + 2] || 0);
+                s += B64[v >> 18] + B64[(v >> 12) & 63];
+                s += i + 1 < b.length ? B64[(v >> 6) & 63] : '=';
+                s += i + 2 < b.length ? B64[v & 63] : '=';
+            }
+            return s;
+        }
+
+        it('hex', () => {
+            for (var n = 0; n < 100; n++) {
+                var b = rand_buffer(n * 3);
+                var s = hex.encode(b);
+                assert.equal(s, hex_ref(b));
+                assert.deepEqual(hex.decode(s), b);
+            }
+        });
+
+        it('base64', () => {
+            for (var n = 0; n < 100; n++) {
+                var b = rand_buffer(n * 3 + n % 3);
+                var s = base64.encode(b);
+                assert.equal(s, base64_ref(b));
+                assert.equal(b.toString('base64'), s);
+                assert.deepEqual(base64.decode(s), b);
+                assert.deepEqual(base64.decode(s.replace(/(.{7})/g, '$1\n')), b);
+
+                var u = base64.encode(b, true);
+                assert.equal(u, s.replace(/\+/g, '-').replace(/\//g, '_').replace(/=+$/, ''));
+                assert.deepEqual(base64.decode(u), b);
+            }
+        });
+
+        it('base32', () => {
+            var base32 = require('base32');
+            for (var n = 0; n < 100; n++) {
+                var b = rand_buffer(n * 2 + 1);
+                assert.deepEqual(base32.decode(base32.encode(b)), b);
+            }
+        });
+
+        it('utf8', () => {
+            for (var n = 0; n < 100; n++) {
+                var codes = [];
+                for (var i = 0; i < n * 5; i++) {
+                    var r = Math.random();
+                    if (r < 0.8)
+                        codes.push(Math.floor(Math.random() * 0x80));
+                    else if (r < 0.9)
+                        codes.push(0x80 + Math.floor(Math.random() * 0x780));
+                    else if (r < 0.97) {
+                        var c = 0x800 + Math.floor(Math.random() * 0xd000);
+                        codes.push(c < 0xd800 ? c : c + 0x800);
+                    }
+                    else
+                        codes.push(0x10000 + Math.floor(Math.random() * 0xfffff));
+                }
+
+                var str = String.fromCodePoint.apply(null, codes);
+                var b = Buffer.from(str);
+                assert.deepEqual(b, Buffer.from(encodeURIComponent(str).replace(/%([0-9A-F]{2})|./g,
+                    (m, h) => String.fromCharCode(h ? parseInt(h, 16) : m.charCodeAt(0))), 'latin1'));
+                assert.equal(b.toString(), str);
+            }
+        });
+    });
+
     describe('multibase', () => {
         const encoded = [
             {
@@ -957,6 +1043,87 @@ describe('encoding', () => {
             var obj2 = { 's1': new String('abcd') };
             assert.deepEqual(msgpack.decode(msgpack.encode(obj1)), msgpack.decode(msgpack.encode(obj2)));
         });
+
+        it('repeated keys', () => {
+            var data = [];
+            for (var i = 0; i < 1000; i++)
+                data.push({ id: i, name: 'n' + i, ["__proto__"]: i });
+
+            var r = msgpack.decode(msgpack.encode(data));
+            assert.equal(r.length, 1000);
+            assert.equal(r[999].name, 'n999');
+            assert.equal(Object.getPrototypeOf(r[0]), Object.prototype);
+            assert.ok(Object.keys(r[1]).indexOf('__proto__') >= 0);
+        });
+
+        describe('compile', () => {
+            var codec = msgpack.compile({
+                id: 0,
+                name: "",
+                owner: { id: 0, name: "" },
+                items: [{ sku: "", qty: 0 }]
+            });
+
+            var rec = {
+                id: 1,
+                name: "a",
+                owner: { id: 2, name: "b" },
+                items: [{ sku: "x", qty: 1 }, { sku: "y", qty: 2 }]
+            };
+
+            it('encode/decode', () => {
+                assert.deepEqual(codec.decode(codec.encode(rec)), rec);
+                assert.deepEqual(msgpack.decode(codec.encode(rec)), rec);
+                assert.deepEqual(codec.decode(msgpack.encode(rec)), rec);
+            });
+
+            it('array of records', () => {
+                var data = [rec, rec, null];
+                assert.deepEqual(codec.decode(codec.encode(data)), data);
+            });
+
+            it('field order', () => {
+                var r = codec.decode(msgpack.encode({
+                    name: "a",
+                    id: 1
+                }));
+                assert.deepEqual(Object.keys(r), ["id", "name"]);
+            });
+
+            it('unknown fields', () => {
+                var r = codec.decode(codec.encode({
+                    id: 1,
+                    extra: 2,
+                    owner: { id: 2, extra: 3 }
+                }));
+                assert.deepEqual(r, { id: 1, owner: { id: 2 } });
+
+                r = codec.decode(msgpack.encode({ id: 1, extra: 2 }));
+                assert.deepEqual(r, { id: 1 });
+            });
+
+            it('free fields', () => {
+                var r = {
+                    id: new Date(0),
+                    name: [1, { a: 2 }],
+                    owner: "not a record",
+                    items: null
+                };
+                assert.deepEqual(codec.decode(codec.encode(r)), r);
+            });
+
+            it('invalid schema', () => {
+                assert.throws(() => {
+                    msgpack.compile([]);
+                });
+
+                var s = {};
+                s.self = s;
+                assert.throws(() => {
+                    msgpack.compile(s);
+                });
+            });
+        });
     });
 });
 
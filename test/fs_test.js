@@ -798,6 +798,70 @@ describe('fs', () => {
                 });
             });
         });
+
+        it('binary read', () => {
+            const fname = path.join(__dirname, 'fs_files', 'read_bin' + vmid);
+            const data = new Buffer([0xff, 0xfe, 0x00, 0x80, 0xc3, 0x28]);
+            fs.writeFile(fname, data);
+
+            const fd1 = fs.open(fname);
+            const buf = Buffer.alloc(6);
+            assert.equal(fs.read(fd1, buf, 0, 6, 0), 6);
+            assert.deepEqual(buf, data);
+            fs.close(fd1);
+
+            assert.deepEqual(fs.readFile(fname), data);
+            fs.unlink(fname);
+        });
+
+        it('FileHandle.read', () => {
+            const buf = Buffer.alloc(7);
+            assert.equal(fd.read(buf, 0, 7, 8), 7);
+            assert.deepEqual(buf, new Buffer('hijklmn'));
+        });
+
+        describe('readv', () => {
+            it('fill buffers in order', () => {
+                const buf1 = Buffer.alloc(3);
+                const buf2 = Buffer.alloc(5);
+                const buf3 = Buffer.alloc(7);
+                const bytes = fs.readv(fd, [buf1, buf2, buf3], 0);
+                assert.equal(bytes, 15);
+                assert.deepEqual(buf1, new Buffer('abc'));
+                assert.deepEqual(buf2, new Buffer('defg\n'));
+                assert.deepEqual(buf3, new Buffer('hijklmn'));
+            });
+
+            it('short read', () => {
+                const buf1 = Buffer.alloc(4);
+                const buf2 = Buffer.alloc(4);
+                const bytes = fd.readv([buf1, buf2], 10);
+                assert.equal(bytes, 5);
+                assert.deepEqual(buf1, new Buffer('jklm'));
+                assert.deepEqual(buf2, new Buffer([0x6e, 0, 0, 0]));
+            });
+
+            it('empty buffers', () => {
+                assert.equal(fs.readv(fd, [], 0), 0);
+                assert.equal(fs.readv(fd, [Buffer.alloc(0), Buffer.alloc(2)], 0), 2);
+            });
+
+            it('type error', () => {
+                assert.throws(() => fs.readv(fd, ['abc'], 0));
+            });
+
+            it('callback', done => {
+                const buf = Buffer.alloc(15);
+                fd.readv([buf], 0, (err, bytes) => {
+                    if (err) done(err)
+                    else {
+                        assert.equal(bytes, 15);
+                        assert.deepEqual(buf, new Buffer('abcdefg\nhijklmn'));
+                        done();
+                    }
+                });
+            });
+        });
     });
 
     describe('write', () => {
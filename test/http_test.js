@@ -610,6 +610,58 @@ describe("http", () => {
             assert.equal('123456', r.body.read());
         });
 
+        it("header fields", () => {
+            var req = get_request("GET / HTTP/1.1\r\nHost:  www.com\r\nX-Test: 1\r\nx-test:\t2\r\nAccept: */*\r\n\r\n");
+
+            assert.equal(req.headers['host'], 'www.com');
+            assert.equal(req.headers['HOST'], 'www.com');
+            assert.deepEqual(req.headers['x-test'], ['1', '2']);
+            assert.deepEqual(req.headers.keys(), ['Host', 'X-Test', 'x-test', 'Accept']);
+            assert.deepEqual(req.allHeader('X-TEST'), ['1', '2']);
+
+            req.removeHeader('x-test');
+            assert.deepEqual(req.headers.keys(), ['Host', 'Accept']);
+
+            req.setHeader('host', 'fibjs.org');
+            assert.equal(req.firstHeader('Host'), 'fibjs.org');
+            assert.equal(req.firstHeader('accept'), '*/*');
+
+            var req = get_request("GET / HTTP/1.1\r\nhead1 : 100\r\nhead2: 2\x0100\r\nhead3: 1\n2\r\n\r\n");
+            assert.equal(req.headers['head1'], '100');
+            assert.equal(req.headers['head2'], '2\x0100');
+            assert.equal(req.headers['head3'], '1\n2');
+
+            var req = new http.Request();
+            req.maxHeaderSize = 32;
+            assert.throws(() => {
+                get_request("GET / HTTP/1.1\r\nhead1: " + "a".repeat(32) + "\r\n\r\n", req);
+            });
+
+            var req = new http.Request();
+            req.maxHeadersCount = 2;
+            assert.throws(() => {
+                get_request("GET / HTTP/1.1\r\nh1: 1\r\nh2: 2\r\nh3: 3\r\n\r\n", req);
+            });
+
+            var req = new http.Request();
+            req.maxHeadersCount = 2;
+            assert.throws(() => {
+                get_request("GET / HTTP/1.1\r\nh1: 1\r\nh2: 2\r\nConnection: close\r\n\r\n", req);
+            });
+
+            var bad_reqs = [
+                "GET / HTTP/1.1\r\n head1: 100\r\n\r\n",
+                "GET / HTTP/1.1\r\nhead 1: 100\r\n\r\n",
+                "GET / HTTP/1.1\r\nhead1 100\r\n\r\n"
+            ];
+
+            bad_reqs.forEach(u => {
+                assert.throws(() => {
+                    get_request(u);
+                });
+            });
+        });
+
         it("keep-alive", () => {
             var keep_reqs = {
                 "GET / HTTP/1.0\r\n\r\n": false,
@@ -1317,6 +1369,383 @@ describe("http", () => {
         });
     });
 
+    describe("access log", () => {
+        var log_file = path.join(__dirname, 'access_log_' + base_port + '.log');
+        var svr, hdr;
+
+        function clean() {
+            try {
+                fs.unlink(log_file);
+            } catch (e) { }
+        }
+
+        before(() => {
+            clean();
+
+            hdr = new http.Handler((r) => {
+                if (r.value == '/not_found')
+                    r.response.statusCode = 404;
+                else
+                    r.response.write("hello");
+            });
+
+            svr = new http.Server(8889 + base_port, hdr);
+            svr.start();
+
+            test_util.push(svr.socket);
+        });
+
+        after(clean);
+
+        function read_log(n) {
+            for (var i = 0; i < 100; i++) {
+                var lines = fs.exists(log_file) ? fs.readTextFile(log_file).split('\n') : [];
+                if (lines.length > n)
+                    return lines.slice(0, n);
+                coroutine.sleep(10);
+            }
+            assert.fail('access log not written');
+        }
+
+        it("format", () => {
+            assert.throws(() => {
+                hdr.enableAccessLog({
+                    format: "$remote_addr $unknown"
+                });
+            });
+
+            assert.throws(() => {
+                hdr.enableAccessLog({
+                    format: "json",
+                    headers: ["bad header"]
+                });
+            });
+        });
+
+        it("combined", () => {
+            clean();
+            hdr.enableAccessLog({
+                path: log_file,
+                headers: ["x-trace-id"]
+            });
+
+            http.get("http://127.0.0.1:" + (8889 + base_port) + "/test?a=1", {
+                headers: {
+                    "User-Agent": "fibjs-test",
+                    "X-Trace-Id": 'a"b'
+                }
+            });
+
+            var line = read_log(1)[0];
+            assert.match(line, /^127\.0\.0\.1 - - \[\d{2}\/\w{3}\/\d{4}:\d{2}:\d{2}:\d{2} [+-]\d{4}\] "GET \/test\?a=1 HTTP\/1\.1" 200 5 "-" "fibjs-test" "a\\"b"$/);
+        });
+
+        it("json", () => {
+            clean();
+            hdr.enableAccessLog({
+                path: log_file,
+                format: "json",
+                headers: ["user-agent"]
+            });
+
+            http.get("http://127.0.0.1:" + (8889 + base_port) + "/not_found", {
+                headers: {
+                    "User-Agent": "fibjs-test"
+                }
+            });
+
+            var o = JSON.parse(read_log(1)[0]);
+            assert.equal(o.remote, "127.0.0.1");
+            assert.equal(o.method, "GET");
+            assert.equal(o.uri, "/not_found");
+            assert.equal(o.protocol, "HTTP/1.1");
+            assert.equal(o.status, 404);
+            assert.equal(o.bytes, 0);
+            assert.isNumber(o.latency);
+            assert.equal(new Date(o.time).toISOString(), o.time);
+            assert.deepEqual(o.headers, {
+                "user-agent": "fibjs-test"
+            });
+        });
+
+        it("template", () => {
+            clean();
+            hdr.enableAccessLog({
+                path: log_file,
+                format: "$method ${path}|$query|$status|$http_x_none"
+            });
+
+            http.get("http://127.0.0.1:" + (8889 + base_port) + "/tpl");
+
+            assert.equal(read_log(1)[0], "GET /tpl|-|200|-");
+        });
+
+        it("disable", () => {
+            clean();
+            hdr.enableAccessLog({
+                path: log_file,
+                format: "$uri"
+            });
+
+            http.get("http://127.0.0.1:" + (8889 + base_port) + "/on");
+            assert.equal(read_log(1)[0], "/on");
+
+            hdr.disableAccessLog();
+            http.get("http://127.0.0.1:" + (8889 + base_port) + "/off");
+            coroutine.sleep(100);
+
+            assert.deepEqual(read_log(1), ["/on"]);
+            assert.equal(fs.readTextFile(log_file).indexOf("/off"), -1);
+        });
+
+        it("https", () => {
+            clean();
+
+            var hsvr = new http.HttpsServer({
+                cert: crt,
+                key: pk1.privateKey,
+                port: 8892 + base_port
+            }, (r) => {
+                r.response.write("hello");
+            });
+            hsvr.start();
+            test_util.push(hsvr.socket);
+
+            hsvr.enableAccessLog({
+                path: log_file,
+                format: "$remote_addr $status"
+            });
+
+            var hc = new http.Client({
+                ca: ca
+            });
+            hc.get("https://localhost:" + (8892 + base_port) + "/");
+
+            assert.match(read_log(1)[0], /^(127\.0\.0\.1|::1|::ffff:127\.0\.0\.1) 200$/);
+
+            hsvr.disableAccessLog();
+            hsvr.stop();
+        });
+    });
+
+    describe("timeouts", () => {
+        var port = 8891 + base_port;
+        var url = "http://127.0.0.1:" + port;
+        var svr;
+
+        before(() => {
+            svr = new http.Server(port, (r) => {
+                if (r.address == '/slow')
+                    coroutine.sleep(500);
+                else if (r.address == '/proxy')
+                    http.get(url + '/slow');
+                else if (r.address == '/deadline')
+                    r.response.write(String(coroutine.current().deadline));
+            });
+            svr.start();
+
+            test_util.push(svr.socket);
+        });
+
+        after(() => {
+            svr.headerTimeout = 0;
+            svr.idleTimeout = 0;
+            svr.handlerTimeout = 0;
+        });
+
+        it("options", () => {
+            assert.equal(svr.headerTimeout, 0);
+            assert.equal(svr.bodyTimeout, 0);
+            assert.equal(svr.idleTimeout, 0);
+            assert.equal(svr.handlerTimeout, 0);
+
+            assert.throws(() => {
+                svr.headerTimeout = -1;
+            });
+        });
+
+        it("header", () => {
+            svr.headerTimeout = 50;
+
+            var c = net.connect("tcp://127.0.0.1:" + port);
+            c.write("GET / HTTP/1.1\r\nHost: 127.0.0.1\r\n");
+
+            var t = Date.now();
+            assert.equal(c.read(), null);
+            assert.lessThan(Date.now() - t, 1000);
+            c.close();
+
+            svr.headerTimeout = 0;
+        });
+
+        it("idle", () => {
+            svr.idleTimeout = 50;
+
+            var c = net.connect("tcp://127.0.0.1:" + port);
+            var bs = new io.BufferedStream(c);
+            bs.EOL = "\r\n";
+
+            c.write("GET / HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n");
+            var rep = new http.Response();
+            rep.readFrom(bs);
+            assert.equal(rep.statusCode, 200);
+
+            assert.equal(bs.read(), null);
+            c.close();
+
+            svr.idleTimeout = 0;
+        });
+
+        it("handler deadline", () => {
+            svr.handlerTimeout = 1000;
+
+            var t = Date.now();
+            var d = Number(http.get(url + '/deadline').data.toString());
+            assert.closeTo(d, t + 1000, 500);
+
+            svr.handlerTimeout = 100;
+            assert.equal(http.get(url + '/proxy').statusCode, 504);
+
+            svr.handlerTimeout = 0;
+        });
+
+        it("expired deadline", () => {
+            var fb = coroutine.current();
+
+            fb.deadline = 1;
+            try {
+                assert.throws(() => {
+                    http.get(url + '/deadline');
+                });
+            } finally {
+                fb.deadline = 0;
+            }
+        });
+    });
+
+    describe("load shedding", () => {
+        var url = "http://127.0.0.1:" + (8890 + base_port) + "/";
+        var svr, ev;
+
+        before(() => {
+            svr = new http.Server(8890 + base_port, (r) => {
+                ev.wait();
+                r.response.write("ok");
+            });
+            svr.start();
+
+            test_util.push(svr.socket);
+        });
+
+        function wait_for(fn) {
+            for (var i = 0; i < 100 && !fn(); i++)
+                coroutine.sleep(10);
+            assert.ok(fn());
+        }
+
+        it("options", () => {
+            assert.isNull(svr.loadStats);
+
+            assert.throws(() => {
+                svr.limitConcurrency({
+                    maxConcurrency: -1
+                });
+            });
+
+            assert.throws(() => {
+                svr.limitConcurrency({
+                    maxConcurrency: 1,
+                    maxQueue: -1
+                });
+            });
+        });
+
+        it("queue and shed", () => {
+            ev = new coroutine.Event();
+            svr.limitConcurrency({
+                maxConcurrency: 1,
+                maxQueue: 1
+            });
+
+            var rs = [];
+            var f1 = coroutine.start(() => rs[0] = http.get(url).statusCode);
+            wait_for(() => svr.loadStats.inflight == 1);
+
+            var f2 = coroutine.start(() => rs[1] = http.get(url).statusCode);
+            wait_for(() => svr.loadStats.waiting == 1);
+
+            var r = http.get(url);
+            assert.equal(r.statusCode, 503);
+            assert.equal(r.firstHeader("Retry-After"), "1");
+
+            ev.set();
+            f1.join();
+            f2.join();
+            assert.deepEqual(rs, [200, 200]);
+
+            assert.deepEqual(svr.loadStats, {
+                limit: 1,
+                inflight: 0,
+                waiting: 0,
+                accepted: 2,
+                queued: 1,
+                shed: 1,
+                timeouts: 0
+            });
+        });
+
+        it("queue timeout", () => {
+            ev = new coroutine.Event();
+            svr.limitConcurrency({
+                maxConcurrency: 1,
+                maxQueue: 1,
+                queueTimeout: 10
+            });
+
+            var rs = [];
+            var f1 = coroutine.start(() => rs[0] = http.get(url).statusCode);
+            wait_for(() => svr.loadStats.inflight == 1);
+
+            var f2 = coroutine.start(() => rs[1] = http.get(url).statusCode);
+            wait_for(() => svr.loadStats.waiting == 1);
+
+            // the waiter is shed while the request ahead of it is stalled
+            f2.join();
+            assert.equal(rs[1], 503);
+            assert.equal(svr.loadStats.timeouts, 1);
+            assert.equal(svr.loadStats.inflight, 1);
+
+            ev.set();
+            f1.join();
+            assert.equal(rs[0], 200);
+        });
+
+        it("adaptive", () => {
+            ev = new coroutine.Event();
+            ev.set();
+            svr.limitConcurrency({
+                maxConcurrency: 1000,
+                minConcurrency: 4,
+                adaptive: true
+            });
+
+            var limit = svr.loadStats.limit;
+            assert.ok(limit >= 4 && limit <= 1000);
+
+            for (var i = 0; i < 10; i++)
+                assert.equal(http.get(url).statusCode, 200);
+
+            limit = svr.loadStats.limit;
+            assert.ok(limit >= 4 && limit <= 1000);
+        });
+
+        it("disable", () => {
+            svr.limitConcurrency();
+            assert.isNull(svr.loadStats);
+            assert.equal(http.get(url).statusCode, 200);
+        });
+    });
+
     describe("file handler", () => {
         var baseFolder = __dirname;
         var hfHandler = new http.fileHandler(baseFolder);
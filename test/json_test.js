@@ -53,6 +53,68 @@ describe('json', () => {
         });
     });
 
+    it("large object", () => {
+        var data = [];
+        for (var i = 0; i < 20000; i++)
+            data.push({
+                "id": i,
+                "name": "name " + i,
+                "tag\n": [i, "t"],
+                ["__proto__"]: i
+            });
+
+        var txt = JSON.stringify(data);
+        assert.greaterThan(txt.length, 1024 * 1024);
+
+        var r = encoding.json.decode(txt);
+        assert.deepEqual(r, JSON.parse(txt));
+        assert.equal(Object.getPrototypeOf(r[0]), Object.prototype);
+    });
+
+    describe("compile", () => {
+        var codec = encoding.json.compile({
+            id: 0,
+            "na\"me": "",
+            owner: { id: 0, name: "" },
+            items: [{ sku: "", qty: 0 }]
+        });
+
+        var rec = {
+            id: 1.5,
+            "na\"me": "a\u0001\n\"",
+            owner: { id: 2, name: "b" },
+            items: [{ sku: "x", qty: 1 }, { sku: "y", qty: null }]
+        };
+
+        it("encode", () => {
+            assert.equal(codec.encode(rec), JSON.stringify(rec));
+            assert.equal(codec.encode([rec, null]), JSON.stringify([rec, null]));
+            assert.equal(codec.encode({
+                id: 1,
+                extra: 2,
+                owner: undefined,
+                items: new Date(0)
+            }), '{"id":1,"items":"1970-01-01T00:00:00.000Z"}');
+            assert.equal(codec.encode({ id: NaN }), '{"id":null}');
+        });
+
+        it("decode", () => {
+            assert.deepEqual(codec.decode(JSON.stringify(rec)), rec);
+            assert.deepEqual(codec.decode(JSON.stringify([rec, rec])), [rec, rec]);
+
+            var r = codec.decode('{"owner":{"name":"b","id":2,"x":1},"extra":[1,{"a":2}],"id":1}');
+            assert.deepEqual(r, { id: 1, owner: { id: 2, name: "b" } });
+            assert.deepEqual(Object.keys(r), ["id", "owner"]);
+            assert.deepEqual(Object.keys(r.owner), ["id", "name"]);
+
+            assert.deepEqual(codec.decode('{"\\u0069d":1}'), { id: 1 });
+
+            assert.throws(() => {
+                codec.decode('{"id":1');
+            });
+        });
+    });
+
 });
 
 require.main === module && test.run(console.DEBUG);
\ No newline at end of file
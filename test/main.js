@@ -72,6 +72,7 @@ if (global.full_test) {
 run("./selfzip_test.js");
 
 run("./profiler_test.js");
+run("./metrics_test.js");
 
 run("./v8_test.js");
 
@@ -0,0 +1,165 @@
+var test = require("test");
+test.setup();
+
+var metrics = require('metrics');
+var http = require('http');
+var mq = require('mq');
+
+describe("metrics", () => {
+    it("counter", () => {
+        var c = metrics.counter("test_requests_total", {
+            help: "test requests"
+        });
+
+        assert.equal(c.name, "test_requests");
+        assert.equal(c.value, 0);
+
+        c.inc();
+        c.inc(2.5);
+        assert.equal(c.value, 3.5);
+
+        assert.throws(() => {
+            c.inc(-1);
+        });
+
+        var text = metrics.collect();
+        assert.notEqual(text.indexOf("# TYPE test_requests counter\n"), -1);
+        assert.notEqual(text.indexOf("# HELP test_requests test requests\n"), -1);
+        assert.notEqual(text.indexOf("test_requests_total 3.5\n"), -1);
+    });
+
+    it("gauge", () => {
+        var g = metrics.gauge("test_queue");
+
+        g.set(10);
+        g.inc();
+        g.dec(3);
+        assert.equal(g.value, 8);
+
+        assert.notEqual(metrics.collect().indexOf("test_queue 8\n"), -1);
+    });
+
+    it("histogram", () => {
+        var h = metrics.histogram("test_latency", {
+            buckets: [10, 100, 1000]
+        });
+
+        for (var i = 1; i <= 1000; i++)
+            h.observe(i);
+
+        assert.equal(h.count, 1000);
+        assert.equal(h.sum, 500500);
+
+        assert.closeTo(h.percentile(50), 500, 500 * 0.032);
+        assert.closeTo(h.percentile(99), 990, 990 * 0.032);
+        assert.equal(h.percentile(100), 1000);
+
+        var text = metrics.collect();
+        assert.notEqual(text.indexOf('test_latency_bucket{le="10"} 10\n'), -1);
+        assert.notEqual(text.indexOf('test_latency_bucket{le="+Inf"} 1000\n'), -1);
+        assert.notEqual(text.indexOf("test_latency_count 1000\n"), -1);
+        assert.notEqual(text.indexOf("test_latency_sum 500500\n"), -1);
+
+        assert.throws(() => {
+            metrics.histogram("test_bad_buckets", {
+                buckets: [10, 5]
+            });
+        });
+    });
+
+    it("shared series", () => {
+        var c1 = metrics.counter("test_shared");
+        var c2 = metrics.counter("test_shared_total");
+
+        c1.inc();
+        c2.inc();
+        assert.equal(c1.value, 2);
+        assert.equal(c2.value, 2);
+    });
+
+    it("labels", () => {
+        var c1 = metrics.counter("test_labeled", {
+            labels: {
+                method: "GET",
+                code: "200"
+            }
+        });
+        var c2 = metrics.counter("test_labeled", {
+            labels: {
+                method: "POST",
+                code: '5"0\\0'
+            }
+        });
+
+        c1.inc();
+        c2.inc(2);
+
+        var text = metrics.collect();
+        assert.equal(text.split("# TYPE test_labeled counter").length, 2);
+        assert.notEqual(text.indexOf('test_labeled_total{code="200",method="GET"} 1\n'), -1);
+        assert.notEqual(text.indexOf('test_labeled_total{code="5\\"0\\\\0",method="POST"} 2\n'), -1);
+
+        assert.throws(() => {
+            metrics.counter("test_labeled", {
+                labels: {
+                    "bad-name": "1"
+                }
+            });
+        });
+    });
+
+    it("invalid name", () => {
+        assert.throws(() => {
+            metrics.counter("0test");
+        });
+
+        assert.throws(() => {
+            metrics.counter("test-name");
+        });
+
+        assert.throws(() => {
+            metrics.gauge("fibjs_test");
+        });
+    });
+
+    it("type conflict", () => {
+        metrics.gauge("test_conflict");
+
+        assert.throws(() => {
+            metrics.counter("test_conflict");
+        });
+
+        assert.throws(() => {
+            metrics.histogram("test_conflict");
+        });
+    });
+
+    it("built-in", () => {
+        var text = metrics.collect();
+
+        assert.notEqual(text.indexOf('fibjs_async_pool_pending{pool="async"}'), -1);
+        assert.notEqual(text.indexOf('fibjs_async_pool_workers{pool="longsync"}'), -1);
+        assert.notEqual(text.indexOf("# TYPE fibjs_event_loop_lag_microseconds histogram\n"), -1);
+        assert.notEqual(text.indexOf("# TYPE fibjs_net_sockets gauge\n"), -1);
+        assert.equal(text.substr(-6), "# EOF\n");
+    });
+
+    it("handler", () => {
+        var req = new http.Request();
+        req.address = "/metrics";
+
+        mq.invoke(metrics.handler(), req);
+
+        var rep = req.response;
+        assert.equal(rep.statusCode, 200);
+        assert.equal(rep.firstHeader("Content-Type"),
+            "application/openmetrics-text; version=1.0.0; charset=utf-8");
+
+        rep.body.rewind();
+        var text = rep.body.readAll().toString();
+        assert.notEqual(text.indexOf("# TYPE test_requests counter\n"), -1);
+        assert.equal(text.substr(-6), "# EOF\n");
+    });
+});
+
+require.main === module && test.run(console.DEBUG);
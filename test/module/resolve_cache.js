@@ -0,0 +1,36 @@
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+const coroutine = require('coroutine');
+
+const fname = path.join(__dirname, 'rc_tmp.js');
+const watch = process.argv[2] == 'watch';
+var r = [];
+
+function probe() {
+    try {
+        require('./rc_tmp');
+        return 'found';
+    } catch (e) {
+        return 'missing';
+    }
+}
+
+try {
+    fs.unlink(fname);
+} catch (e) { }
+
+r.push(probe());
+fs.writeFile(fname, 'module.exports = 1;');
+
+if (watch) {
+    for (var i = 0; i < 40 && probe() == 'missing'; i++)
+        coroutine.sleep(50);
+}
+
+r.push(probe());
+vm.clearResolveCache();
+r.push(probe());
+
+fs.unlink(fname);
+console.log(JSON.stringify(r));
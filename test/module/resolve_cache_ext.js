@@ -0,0 +1,22 @@
+const path = require('path');
+const vm = require('vm');
+
+const base = path.join(__dirname, '..', 'vm_test');
+var r = [];
+
+function probe(sbox) {
+    try {
+        sbox.resolve('./custom_ext', base);
+        return 'found';
+    } catch (e) {
+        return 'missing';
+    }
+}
+
+var sbox = new vm.SandBox({});
+sbox.setModuleCompiler('.abc', function (buf) { });
+
+r.push(probe(sbox));
+r.push(probe(new vm.SandBox({})));
+
+console.log(JSON.stringify(r));
@@ -0,0 +1,5 @@
+var b = require('./lib/b');
+
+exports.sum = b.value + require('./lib/data').value;
+exports.b = b;
+exports.snapshot = typeof require.resolve != 'function';
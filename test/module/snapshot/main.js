@@ -0,0 +1,8 @@
+var path = require('path');
+var a = require(path.join(__dirname, 'a.js'));
+
+console.log(JSON.stringify({
+    sum: a.sum,
+    snapshot: a.snapshot,
+    b: a.b === require('./lib/b')
+}));
@@ -3,6 +3,7 @@ test.setup();
 
 var fs = require('fs');
 var path = require('path');
+var coroutine = require('coroutine');
 var a, b;
 
 const bin_path = path.dirname(process.execPath);
@@ -12,6 +13,18 @@ describe("module", () => {
         try {
             fs.unlink(path.join(__dirname, 'module', 'p6_1'));
         } catch (e) { }
+
+        try {
+            fs.unlink(path.join(__dirname, 'module', 'test.fjb'));
+        } catch (e) { }
+
+        try {
+            fs.unlink(path.join(__dirname, 'module', 'test2.fjb'));
+        } catch (e) { }
+
+        try {
+            fs.unlink(path.join(__dirname, 'module', 'test3.fjb'));
+        } catch (e) { }
     });
 
     it("native module toJSON", () => {
@@ -291,6 +304,80 @@ describe("module", () => {
         assert.equal(require('./module/p4').a, 100);
     });
 
+    it("bundle virtual path", () => {
+        const util = require('util');
+        const fname = path.join(__dirname, 'module', 'test.fjb');
+
+        fs.writeFile(fname, util.bundle({
+            'a.js': 'module.exports = require("./lib/b") + 1;',
+            './lib/b.js': 'module.exports = 99;',
+            'assets/data.txt': new Buffer('hello bundle')
+        }));
+
+        assert.equal(require('./module/test.fjb$/a.js'), 100);
+        assert.equal(require('./module/test.fjb$/a'), 100);
+        assert.equal(fs.readTextFile(fname + '$/assets/data.txt'), 'hello bundle');
+        assert.equal(fs.stat(path.join(fname + '$', 'assets', 'data.txt')).size, 12);
+        assert.throws(() => fs.readFile(fname + '$/assets/none.txt'));
+
+        assert.throws(() => util.bundle({ 'a.js': 100 }));
+        assert.throws(() => util.bundle({ 'a.js': 'a', './a.js': 'b' }));
+        assert.throws(() => util.bundle({ 'a.js': 'a b c' }));
+        util.bundle({ 'a.js': 'a b c' }, { codeCache: false });
+    });
+
+    it("bundle is read only", () => {
+        const util = require('util');
+        const vm = require('vm');
+        const fname = path.join(__dirname, 'module', 'test3.fjb');
+        const id = path.join(fname + '$', 'c.abc');
+
+        fs.writeFile(fname, util.bundle({
+            'c.abc': 'hello'
+        }));
+
+        function load(clobber) {
+            var sbox = new vm.SandBox({});
+            sbox.setModuleCompiler('.abc', buf => {
+                var s = buf.toString();
+                if (clobber)
+                    buf.fill(0x20);
+                return 'module.exports = ' + JSON.stringify(s) + ';';
+            });
+
+            return sbox.require(id, __dirname);
+        }
+
+        assert.equal(load(true), 'hello');
+        assert.equal(load(false), 'hello');
+        assert.equal(fs.readTextFile(id), 'hello');
+    });
+
+    it("bundle changes on disk", () => {
+        const util = require('util');
+        const fname = path.join(__dirname, 'module', 'test2.fjb');
+        const id = path.join(fname + '$', 'data.txt');
+
+        /**
+         * a file, bundle or not, is checked again at most every 3000ms,
+         * so here we sleep 4000ms after each change to see the new one
+         */
+        fs.writeFile(fname, 'not a bundle');
+        assert.throws(() => fs.readFile(id));
+
+        fs.writeFile(fname, util.bundle({
+            'data.txt': 'bundle 1'
+        }));
+        coroutine.sleep(4000);
+        assert.equal(fs.readTextFile(id), 'bundle 1');
+
+        fs.writeFile(fname, util.bundle({
+            'data.txt': 'bundle 22'
+        }));
+        coroutine.sleep(4000);
+        assert.equal(fs.readTextFile(id), 'bundle 22');
+    });
+
     it("strack", () => {
         assert.ok(require("./module/stack").func().match(/module_test/));
     });
@@ -305,6 +392,114 @@ describe("module", () => {
         assert.equal(s, s1);
     });
 
+    describe("resolve cache", () => {
+        const child_process = require('child_process');
+        const script = path.join(__dirname, 'module', 'resolve_cache.js');
+
+        function run_cache(args) {
+            return JSON.parse(child_process.execFile(process.execPath, args).stdout);
+        }
+
+        it("disabled by default", () => {
+            assert.deepEqual(run_cache([script]), ["missing", "found", "found"]);
+        });
+
+        it("keeps what it learned until cleared", () => {
+            assert.deepEqual(run_cache(["--resolve-cache", script]), ["missing", "missing", "found"]);
+        });
+
+        it("drops what changes on disk", () => {
+            assert.deepEqual(run_cache(["--resolve-cache-watch", script, "watch"]), ["missing", "found", "found"]);
+        });
+
+        it("keeps sandboxes with other extensions apart", () => {
+            const script = path.join(__dirname, 'module', 'resolve_cache_ext.js');
+            assert.deepEqual(run_cache(["--resolve-cache", script]), ["found", "missing"]);
+        });
+    });
+
+    describe("lazy builtin modules", () => {
+        const child_process = require('child_process');
+
+        function trace_builtins(args) {
+            var lines = child_process.execFile(process.execPath, ["--trace-builtins"].concat(args)).stderr.split('\n');
+            var p = lines.findIndex(l => l.startsWith("builtin modules:"));
+
+            return lines.slice(p + 2).map(l => l.trim().split(/\s+/)[2]).filter(n => n);
+        }
+
+        it("built on first require", () => {
+            var used = trace_builtins([path.join(__dirname, 'module', 'resolve_cache.js')]);
+            assert.ok(used.indexOf("vm") >= 0);
+            assert.ok(used.indexOf("coroutine") >= 0);
+            assert.equal(used.indexOf("punycode"), -1);
+        });
+
+        it("built on first global access", () => {
+            var used = trace_builtins(["-e", "punycode.toASCII('a')"]);
+            assert.ok(used.indexOf("punycode") >= 0);
+            assert.equal(used.indexOf("querystring"), -1);
+        });
+
+        it("share exports with node: and promises", () => {
+            assert.equal(require('node:fs'), require('fs'));
+            assert.equal(require('fs/promises'), require('fs').promises);
+            assert.equal(require('node:fs/promises'), require('fs').promises);
+        });
+    });
+
+    describe("startup snapshot", () => {
+        const child_process = require('child_process');
+        const folder = path.join(__dirname, 'module', 'snapshot');
+        const blob = path.join(__dirname, 'module', 'snapshot.blob');
+        const bad_blob = path.join(__dirname, 'module', 'snapshot_bad.blob');
+
+        function run_main(args) {
+            return child_process.execFile(process.execPath, args.concat([path.join(folder, 'main.js')]), {
+                cwd: __dirname
+            }).stdout;
+        }
+
+        after(() => {
+            try {
+                fs.unlink(blob);
+            } catch (e) { }
+
+            try {
+                fs.unlink(bad_blob);
+            } catch (e) { }
+        });
+
+        it("preload modules", () => {
+            assert.deepEqual(JSON.parse(run_main([])), {
+                sum: 101,
+                snapshot: false,
+                b: true
+            });
+
+            child_process.execFile(process.execPath, [
+                "--build-snapshot", "--snapshot-blob=" + blob,
+                path.join(folder, 'lib', 'b.js'),
+                path.join(folder, 'lib', 'data.json'),
+                path.join(folder, 'a.js')
+            ], {
+                cwd: __dirname
+            });
+            assert.ok(fs.exists(blob));
+
+            assert.deepEqual(JSON.parse(run_main(["--snapshot-blob=" + blob])), {
+                sum: 101,
+                snapshot: true,
+                b: true
+            });
+        });
+
+        it("reject a foreign blob", () => {
+            fs.writeFile(bad_blob, new Buffer(4096).fill(0x5a));
+            assert.match(run_main(["--snapshot-blob=" + bad_blob]), /^Invalid snapshot blob/);
+        });
+    });
+
     it("addon module", () => {
         var m = require(path.join(bin_path, '1_hello_world'));
         assert.equal(m.hello(), "world");
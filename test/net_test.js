@@ -762,6 +762,41 @@ function test_net(eng, use_uv) {
         it("FIX: net.Smtp results in a segmentation fault", () => {
             new net.Smtp().socket;
         })
+
+        it("TcpServer maxConnections", () => {
+            var _port = getPort();
+            var ev = new coroutine.Event();
+
+            var svr = new net.TcpServer(_port, (c) => {
+                ev.wait();
+                c.close();
+            });
+            test_util.push(svr.socket);
+            svr.start();
+
+            assert.equal(svr.maxConnections, 0);
+            assert.throws(() => {
+                svr.maxConnections = -1;
+            });
+            svr.maxConnections = 1;
+
+            var c1 = net.connect('tcp://' + net_config.host + ':' + _port);
+            for (var i = 0; i < 100 && svr.connections < 1; i++)
+                coroutine.sleep(10);
+            assert.equal(svr.connections, 1);
+
+            var c2 = net.connect('tcp://' + net_config.host + ':' + _port);
+            assert.equal(c2.recv(), null);
+            c2.close();
+
+            ev.set();
+            assert.equal(c1.recv(), null);
+            c1.close();
+
+            for (var i = 0; i < 100 && svr.connections > 0; i++)
+                coroutine.sleep(10);
+            assert.equal(svr.connections, 0);
+        });
     });
 }
 
@@ -244,6 +244,24 @@ describe("redis", () => {
             assert.equal(rdb.del(["test", "test1"]), 0);
         });
 
+        it("deadline", () => {
+            var fb = coroutine.current();
+
+            fb.deadline = Date.now() + 1;
+            coroutine.sleep(10);
+            try {
+                assert.throws(() => {
+                    rdb.get("test");
+                });
+            } finally {
+                fb.deadline = 0;
+            }
+
+            rdb.set("test", "aaa");
+            assert.equal(rdb.get("test"), "aaa");
+            assert.equal(rdb.del("test"), 1);
+        });
+
         it("dump", () => {
             rdb.set("greeting", "hello, dumping world!");
             assert.equal(rdb.dump("greeting").hex(), "001568656c6c6f2c2064756d70696e6720776f726c64210a00d34d32022d27fd4d");
@@ -72,6 +72,35 @@ describe("selfzip", () => {
         });
     });
 
+    describe("bundle", () => {
+        function test_bundle(testPath, files, argv) {
+            fs.copyFile(execPath, testPath);
+            fs.appendFile(testPath, util.bundle(files));
+
+            if (process.platform !== 'win32')
+                fs.chmod(testPath, 511);
+
+            return child_process.run(testPath, argv);
+        }
+
+        it("bundle", () => {
+            assert.equal(test_bundle(get_path(false), { 'index.js': 'process.exit(65);' }, []), 65);
+            assert.equal(test_bundle(get_path(true), { 'index.js': 'process.exit(65);' }, []), 65);
+        });
+
+        it("require in bundle", () => {
+            assert.equal(test_bundle(get_path(false), {
+                'index.js': 'process.exit(require("./lib/a") + require("./data.json").b);',
+                'lib/a.js': 'module.exports = 60;',
+                'data.json': '{"b": 6}'
+            }, []), 66);
+        });
+
+        it("custom argv", () => {
+            assert.equal(test_bundle(get_path(false), { 'index.js': 'process.exit(process.argv[2]);' }, [94]), 94);
+        });
+    });
+
     xdescribe("jsc", () => {
         function test_selfzip(testPath, script, argv) {
             var ms = new io.MemoryStream();
@@ -396,6 +396,104 @@ describe("test", () => {
             });
         });
     });
+
+    describe("bench", () => {
+        const opts = {
+            warmup: 10,
+            time: 50
+        };
+
+        it("result", () => {
+            var n = 0;
+            var r = test.bench("count", () => n++, opts);
+
+            assert.equal(r.name, "count");
+            assert.greaterThan(r.ops, 0);
+            assert.greaterThan(r.mean, 0);
+            assert.greaterThan(r.iterations, 0);
+            assert.ok(r.samples >= 5);
+            assert.equal(r.concurrency, 1);
+            assert.ok(n >= r.iterations * r.samples);
+
+            assert.property(r.gc, "count");
+            assert.property(r.heap, "allocated");
+            assert.notProperty(r, "baseline");
+        });
+
+        it("fixed iterations", () => {
+            var r = test.bench("fixed", () => { }, {
+                warmup: 0,
+                time: 0,
+                minSamples: 3,
+                iterations: 7
+            });
+
+            assert.equal(r.iterations, 7);
+            assert.equal(r.samples, 3);
+        });
+
+        it("allocation", () => {
+            var r = test.bench("alloc", () => new Array(100).fill(0), opts);
+            assert.greaterThan(r.heap.allocatedPerOp, 0);
+        });
+
+        it("async function", () => {
+            var r = test.bench("async", async () => {
+                await sleep(1);
+            }, {
+                warmup: 0,
+                time: 0,
+                minSamples: 2,
+                iterations: 2
+            });
+
+            assert.greaterThan(r.mean, 500000);
+        });
+
+        it("concurrency", () => {
+            var r = test.bench("concurrency", () => coroutine.sleep(1), {
+                warmup: 0,
+                time: 0,
+                minSamples: 2,
+                iterations: 20,
+                concurrency: 10
+            });
+
+            assert.equal(r.concurrency, 10);
+            assert.lessThan(r.mean, 1000000);
+        });
+
+        it("baseline", () => {
+            var r = test.bench("base", () => { }, opts);
+
+            var r1 = test.bench("base", () => { }, Object.assign({
+                baseline: {
+                    base: {
+                        ops: r.ops * 1000,
+                        rme: 0
+                    }
+                }
+            }, opts));
+            assert.isTrue(r1.baseline.regression);
+            assert.lessThan(r1.baseline.diff, 0);
+
+            var r2 = test.bench("base", () => { }, Object.assign({
+                baseline: {
+                    ops: r.ops / 1000
+                }
+            }, opts));
+            assert.isFalse(r2.baseline.regression);
+            assert.greaterThan(r2.baseline.diff, 0);
+        });
+
+        it("exception", () => {
+            assert.throws(() => {
+                test.bench("throw", () => {
+                    throw new Error("bench error");
+                }, opts);
+            }, /bench error/);
+        });
+    });
 });
 
 require.main === module && test.run(console.DEBUG);
\ No newline at end of file
@@ -9,6 +9,7 @@ var fs = require('fs');
 var path = require('path');
 var net = require('net');
 var coroutine = require('coroutine');
+var metrics = require('metrics');
 
 var base_port = coroutine.vmid * 10000;
 
@@ -172,6 +173,9 @@ describe('tls', () => {
                 } else if (buf.toString() === "no_close") {
                     s.close();
                     return;
+                } else if (buf.toString() === "large") {
+                    ss.write("ok");
+                    ss.write(ss.read(40000));
                 } else
                     ss.write(buf);
 
@@ -259,6 +263,74 @@ describe('tls', () => {
             ss.write("no_close");
             assert.equal(null, ss.read());
         });
+
+        it("session resumption", () => {
+            function handshakes(resumed) {
+                var m = metrics.collect().match(new RegExp(`fibjs_tls_client_handshakes_total\\{resumed="${resumed}"\\} (\\d+)`));
+                return m ? Number(m[1]) : 0;
+            }
+
+            function echo() {
+                var ss = connect();
+                ss.write("GET / HTTP/1.0");
+                assert.equal("GET / HTTP/1.0", ss.read());
+            }
+
+            assert.equal(tls.sessionCacheSize, 1024);
+            assert.equal(tls.sessionCacheTimeout, 300);
+
+            var resumed = handshakes(true);
+            echo();
+            echo();
+            echo();
+            assert.greaterThan(handshakes(true), resumed);
+
+            tls.sessionCacheSize = 0;
+            try {
+                resumed = handshakes(true);
+                echo();
+                echo();
+                assert.equal(handshakes(true), resumed);
+            } finally {
+                tls.sessionCacheSize = 1024;
+            }
+
+            assert.throws(() => {
+                tls.sessionCacheSize = -1;
+            });
+        });
+
+        it("ktls", () => {
+            var s1 = new net.Socket();
+            s1.connect("127.0.0.1", 9080 + base_port);
+            test_util.push(s1);
+
+            var ss = new tls.TLSSocket(tls.createSecureContext({
+                ca: ca,
+                maxVersion: "TLSv1.2",
+                ciphers: "ECDHE-RSA-AES128-GCM-SHA256"
+            }));
+            ss.connect(s1);
+            assert.equal(ss.getProtocol(), "TLSv1.2");
+
+            var ulp = "";
+            if (process.platform === "linux")
+                try {
+                    ulp = fs.readTextFile("/proc/sys/net/ipv4/tcp_available_ulp");
+                } catch (e) { }
+            if (ulp.split(/\s+/).indexOf("tls") >= 0)
+                assert.isTrue(ss.ktls);
+            else
+                assert.isBoolean(ss.ktls);
+
+            ss.write("large");
+            assert.equal(ss.read(2).toString(), "ok");
+
+            var data = crypto.randomBytes(40000);
+            ss.write(data);
+            assert.equal(ss.read(40000).hex(), data.hex());
+            assert.equal(null, ss.read());
+        });
     });
 
     describe('verification', () => {
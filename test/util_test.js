@@ -6,6 +6,7 @@ var test_util = require('./test_util');
 var util = require('util');
 var mq = require('mq');
 var coroutine = require('coroutine');
+var path = require('path');
 
 describe('util', () => {
     it("inherits", () => {
@@ -1977,6 +1978,187 @@ describe('util', () => {
         });
     });
 
+    describe('SharedCache', () => {
+        var id = 0;
+
+        function new_cache(opts) {
+            return new util.SharedCache('test_cache_' + (id++), opts);
+        }
+
+        it("set/get", () => {
+            var c = new_cache();
+
+            c.set('s', 'hello');
+            c.set('b', Buffer.from('world'));
+            c.set('o', {
+                a: [1, 2, 3],
+                b: 'str'
+            });
+
+            assert.equal(c.get('s'), 'hello');
+            assert.ok(Buffer.isBuffer(c.get('b')));
+            assert.equal(c.get('b').toString(), 'world');
+            assert.deepEqual(c.get('o'), {
+                a: [1, 2, 3],
+                b: 'str'
+            });
+            assert.isUndefined(c.get('none'));
+
+            assert.equal(c.size, 3);
+            assert.isTrue(c.has('s'));
+
+            c.set('s', undefined);
+            assert.isFalse(c.has('s'));
+
+            c.remove('b');
+            assert.equal(c.size, 1);
+
+            c.clear();
+            assert.equal(c.size, 0);
+            assert.equal(c.bytes, 0);
+        });
+
+        it("shared by name", () => {
+            var c1 = new util.SharedCache('test_cache_shared');
+            var c2 = new util.SharedCache('test_cache_shared');
+
+            c1.set('a', 100);
+            assert.equal(c2.get('a'), 100);
+            assert.equal(c2.name, 'test_cache_shared');
+        });
+
+        it("maxEntries", () => {
+            var c = new_cache({
+                maxEntries: 10,
+                shards: 1
+            });
+
+            for (var i = 0; i < 100; i++)
+                c.set('k' + i, i);
+
+            assert.equal(c.size, 10);
+            assert.greaterThan(c.stats.evictions + c.stats.rejections, 0);
+        });
+
+        it("maxBytes", () => {
+            var c = new_cache({
+                maxBytes: 64 * 1024,
+                shards: 1
+            });
+
+            for (var i = 0; i < 100; i++)
+                c.set('k' + i, Buffer.alloc(4096));
+
+            assert.lessThan(c.bytes, 64 * 1024 + 1);
+            assert.lessThan(c.size, 17);
+
+            c.set('huge', Buffer.alloc(128 * 1024));
+            assert.isFalse(c.has('huge'));
+        });
+
+        it("frequency admission", () => {
+            var c = new_cache({
+                maxEntries: 100,
+                shards: 1
+            });
+
+            for (var n = 0; n < 10; n++)
+                for (var i = 0; i < 50; i++)
+                    if (c.get('hot' + i) === undefined)
+                        c.set('hot' + i, i);
+
+            for (var i = 0; i < 1000; i++)
+                c.set('scan' + i, i);
+
+            var hot = 0;
+            for (var i = 0; i < 50; i++)
+                if (c.has('hot' + i))
+                    hot++;
+
+            assert.greaterThan(hot, 40);
+        });
+
+        it("timeout", () => {
+            var c = new_cache({
+                timeout: 100
+            });
+
+            c.set('a', 1);
+            c.set('b', 2, 0);
+            c.set('c', 3, 300);
+
+            coroutine.sleep(200);
+            assert.isUndefined(c.get('a'));
+            assert.equal(c.get('b'), 2);
+            assert.equal(c.get('c'), 3);
+
+            coroutine.sleep(200);
+            assert.isFalse(c.has('c'));
+            assert.equal(c.stats.expirations, 2);
+        });
+
+        it("updater", () => {
+            var c = new_cache();
+            var call_num = 0;
+
+            function updater(name) {
+                coroutine.sleep(30);
+                call_num++;
+                return name + "_value";
+            }
+
+            assert.equal(c.get("a", updater), "a_value");
+            assert.equal(call_num, 1);
+            assert.equal(c.get("a", updater), "a_value");
+            assert.equal(call_num, 1);
+
+            assert.isUndefined(c.get("a1", function () { }));
+            assert.isFalse(c.has("a1"));
+
+            coroutine.parallel([1, 2, 3], () => c.get("c", updater));
+            assert.equal(call_num, 2);
+
+            assert.throws(() => {
+                c.get("d", () => {
+                    throw "some error";
+                })
+            });
+            assert.isFalse(c.has("d"));
+
+            assert.equal(c.get("c1", (k) => {
+                c.set("c1", 200);
+                return 100;
+            }), 100);
+            assert.equal(c.get("c1"), 200);
+
+            var stats = c.stats;
+            assert.equal(stats.loads, 5);
+            assert.equal(stats.waits, 2);
+        });
+
+        it("across workers", () => {
+            var pool = new coroutine.WorkerPool(path.join(__dirname, 'worker_files/worker_pool.js'), {
+                size: 4
+            });
+
+            try {
+                var c = new_cache();
+
+                c.set('from_main', 'main_value');
+                assert.equal(pool.run('cache_get', [c.name, 'from_main']), 'main_value');
+
+                var rs = coroutine.parallel([1, 2, 3, 4], () => pool.run('cache_load', [c.name, 'k', 100]));
+                assert.equal(rs[0], rs[1]);
+                assert.equal(rs[0], rs[2]);
+                assert.equal(rs[0], rs[3]);
+                assert.equal(c.get('k'), rs[0]);
+                assert.equal(c.stats.loads, 1);
+            } finally {
+                pool.close();
+            }
+        });
+    });
+
     it("FIX: flatten a circular reference object will cause fibjs to crash", () => {
         var arr = [100, 200];
         arr.push(arr);
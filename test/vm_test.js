@@ -865,6 +865,205 @@ describe("vm", () => {
             assert.equal(v1, 500);
             assert.equal(o.a, 500);
         });
+
+        describe("cached data", () => {
+            const code = "function add(a, b) { return a + b; } add(100, 200);";
+
+            it("produceCachedData", () => {
+                const s = new vm.Script(code, {
+                    filename: "cached_data.js",
+                    produceCachedData: true
+                });
+                assert.ok(s.cachedData.length > 0);
+                assert.isFalse(s.cachedDataRejected);
+
+                assert.isNull(new vm.Script(code).cachedData);
+            });
+
+            it("consume cachedData", () => {
+                const data = new vm.Script(code, {
+                    filename: "cached_data1.js"
+                }).createCachedData();
+
+                const s = new vm.Script(code, {
+                    filename: "cached_data2.js",
+                    cachedData: data
+                });
+                assert.isFalse(s.cachedDataRejected);
+                assert.equal(s.runInNewContext(), 300);
+            });
+
+            it("reject cachedData", () => {
+                const data = new vm.Script(code, {
+                    filename: "cached_data3.js"
+                }).createCachedData();
+
+                const s = new vm.Script(code + " add(1, 2);", {
+                    filename: "cached_data4.js",
+                    cachedData: data
+                });
+                assert.isTrue(s.cachedDataRejected);
+                assert.equal(s.runInNewContext(), 3);
+            });
+
+            it("share compilation between contexts", () => {
+                const src = "function inc(n) { return (n || 0) + 1; } var n = inc(n); n";
+                const s1 = new vm.Script(src, {
+                    filename: "shared.js"
+                });
+
+                assert.equal(s1.runInNewContext(), 1);
+
+                const s2 = new vm.Script(src, {
+                    filename: "shared.js"
+                });
+                const s3 = new vm.Script(src, {
+                    filename: "not_shared.js"
+                });
+
+                // inc was compiled lazily by the run of s1, only a script
+                // that shares its compilation carries it in its code cache
+                assert.deepEqual(s2.createCachedData(), s1.createCachedData());
+                assert.notDeepEqual(s3.createCachedData(), s1.createCachedData());
+
+                assert.equal(s2.runInNewContext(), 1);
+
+                const ctx = vm.createContext({});
+                assert.equal(s1.runInContext(ctx), 1);
+                assert.equal(s2.runInContext(ctx), 2);
+            });
+
+            it("--script-cache", () => {
+                const child_process = require('child_process');
+                const dir = path.join(__dirname, 'vm_test', 'script_cache');
+                const script = path.join(__dirname, 'vm_test', 'script_cache.js');
+
+                function run() {
+                    return child_process.execFile(process.execPath, ["--script-cache=" + dir, script]).stdout.trim();
+                }
+
+                function clean() {
+                    try {
+                        fs.readdir(dir).forEach(f => fs.unlink(path.join(dir, f)));
+                        fs.rmdir(dir);
+                    } catch (e) { }
+                }
+
+                clean();
+                fs.mkdir(dir);
+
+                try {
+                    assert.equal(run(), "300");
+                    const files = fs.readdir(dir);
+                    assert.equal(files.length, 1);
+
+                    const fname = path.join(dir, files[0]);
+                    const mtime = fs.stat(fname).mtime.getTime();
+
+                    // an accepted cache is not written again
+                    coroutine.sleep(1100);
+                    assert.equal(run(), "300");
+                    assert.deepEqual(fs.readdir(dir), files);
+                    assert.equal(fs.stat(fname).mtime.getTime(), mtime);
+
+                    // a rejected one is replaced
+                    fs.writeFile(fname, "bad cache");
+                    assert.equal(run(), "300");
+                    assert.notEqual(fs.readTextFile(fname), "bad cache");
+                } finally {
+                    clean();
+                }
+            });
+        });
+    });
+
+    describe("ContextPool", () => {
+        it("acquire and release", () => {
+            const pool = new vm.ContextPool({
+                size: 2
+            });
+            assert.equal(pool.size, 2);
+            assert.equal(pool.available, 2);
+
+            const o = {
+                a: 100
+            };
+            const ctx = pool.acquire(o);
+            assert.equal(ctx, o);
+            assert.isTrue(vm.isContext(o));
+            assert.equal(vm.runInContext("a += 100; b = 1; a", o), 200);
+            assert.equal(o.b, 1);
+
+            pool.release(o);
+            assert.isFalse(vm.isContext(o));
+            assert.isUndefined(o.global);
+            assert.throws(() => {
+                vm.runInContext("a", o);
+            });
+        });
+
+        it("refill in background", () => {
+            const pool = new vm.ContextPool({
+                size: 2
+            });
+
+            pool.release(pool.acquire());
+            pool.release(pool.acquire());
+            assert.equal(pool.available, 0);
+
+            for (var i = 0; i < 100 && pool.available < 2; i++)
+                coroutine.sleep(10);
+            assert.equal(pool.available, 2);
+
+            pool.acquire();
+            pool.acquire();
+            pool.acquire();
+            assert.equal(pool.available, 0);
+        });
+
+        it("isolation", () => {
+            const pool = new vm.ContextPool({
+                size: 1
+            });
+
+            const o1 = pool.acquire({});
+            const leak = vm.runInContext("Array.prototype.leak = 1; x = 1; (function () { return typeof x; })", o1);
+            pool.release(o1);
+
+            assert.equal(leak(), "undefined");
+
+            const o2 = pool.acquire({});
+            assert.equal(vm.runInContext("typeof x + ':' + [].leak", o2), "undefined:undefined");
+            pool.release(o2);
+        });
+
+        it("errors", () => {
+            const pool = new vm.ContextPool();
+            const pool1 = new vm.ContextPool({
+                size: 0
+            });
+            const o = pool.acquire();
+
+            assert.throws(() => {
+                pool.acquire(o);
+            });
+
+            assert.throws(() => {
+                pool1.release(o);
+            });
+
+            assert.throws(() => {
+                pool.release({});
+            });
+
+            assert.throws(() => {
+                new vm.ContextPool({
+                    size: -1
+                });
+            });
+
+            pool.release(o);
+        });
     });
 
     xit("require.cache", () => {
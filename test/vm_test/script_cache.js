@@ -0,0 +1,5 @@
+const vm = require('vm');
+
+console.log(new vm.Script("function add(a, b) { return a + b; } add(100, 200);", {
+    filename: "script_cache.js"
+}).runInThisContext());
@@ -0,0 +1,26 @@
+const coroutine = require('coroutine');
+const util = require('util');
+
+exports.add = (a, b) => a + b;
+
+exports.echo = v => v;
+
+exports.vmid = () => coroutine.vmid;
+
+exports.sleep = ms => {
+    coroutine.sleep(ms);
+    return coroutine.vmid;
+};
+
+exports.async_add = async (a, b) => a + b;
+
+exports.error = () => {
+    throw new Error('worker pool error');
+};
+
+exports.cache_get = (name, key) => new util.SharedCache(name).get(key);
+
+exports.cache_load = (name, key, ms) => new util.SharedCache(name).get(key, k => {
+    coroutine.sleep(ms);
+    return k + '_' + coroutine.vmid;
+});
@@ -756,6 +756,246 @@ describe('ws', () => {
             s.close();
         });
 
+        describe('perMessageDeflate parameters', () => {
+            var conns = [];
+
+            before(() => {
+                var httpd = new http.Server(8821 + base_port, {
+                    "/ws": ws.upgrade({
+                        perMessageDeflate: {
+                            serverNoContextTakeover: true,
+                            clientMaxWindowBits: 10
+                        }
+                    }, (s) => {
+                        conns.push(s);
+                        s.onmessage = function (msg) {
+                            assert.isTrue(msg.compress);
+                            this.send(msg.data);
+                        };
+                    })
+                });
+                test_util.push(httpd.socket);
+                httpd.start();
+            });
+
+            after(() => {
+                ws.compressMemoryLimit = 0;
+            });
+
+            function echo(opts) {
+                var msgs = [];
+                var s = new ws.Socket("ws://127.0.0.1:" + (8821 + base_port) + "/ws", opts);
+                s.onopen = () => {
+                    for (var i = 0; i < 10; i++)
+                        s.send("hello world, hello world, " + i);
+                };
+
+                s.onmessage = (m) => {
+                    assert.isTrue(m.compress);
+                    msgs.push(m.data);
+                };
+
+                for (var i = 0; i < 2000 && msgs.length < 10; i++)
+                    coroutine.sleep(1);
+
+                s.close();
+
+                assert.equal(msgs.length, 10);
+                msgs.forEach((m, i) => assert.equal(m, "hello world, hello world, " + i));
+            }
+
+            it("negotiate", () => {
+                echo({
+                    perMessageDeflate: true
+                });
+
+                echo({
+                    perMessageDeflate: {
+                        clientNoContextTakeover: true,
+                        serverMaxWindowBits: 9
+                    }
+                });
+            });
+
+            it("server window bits not offered", () => {
+                var httpd = new http.Server(8822 + base_port, {
+                    "/ws": ws.upgrade({
+                        perMessageDeflate: {
+                            serverMaxWindowBits: 10
+                        }
+                    }, (s) => {
+                        s.onmessage = function (msg) {
+                            this.send(msg.data);
+                        };
+                    })
+                });
+                test_util.push(httpd.socket);
+                httpd.start();
+
+                var rep = http.get("http://127.0.0.1:" + (8822 + base_port) + "/ws", {
+                    headers: {
+                        "Upgrade": "websocket",
+                        "Connection": "Upgrade",
+                        "Sec-WebSocket-Key": "dGhlIHNhbXBsZSBub25jZQ==",
+                        "Sec-WebSocket-Version": "13",
+                        "Sec-WebSocket-Extensions": "permessage-deflate; client_max_window_bits"
+                    }
+                });
+
+                assert.equal(rep.statusCode, 101);
+                assert.equal(rep.firstHeader("Sec-WebSocket-Extensions"), "permessage-deflate");
+                rep.socket.close();
+
+                var msgs = [];
+                var s = new ws.Socket("ws://127.0.0.1:" + (8822 + base_port) + "/ws", {
+                    perMessageDeflate: true
+                });
+                s.onopen = () => {
+                    for (var i = 0; i < 10; i++)
+                        s.send("hello world, hello world, " + i);
+                };
+
+                s.onmessage = (m) => {
+                    assert.isTrue(m.compress);
+                    msgs.push(m.data);
+                };
+
+                for (var i = 0; i < 2000 && msgs.length < 10; i++)
+                    coroutine.sleep(1);
+
+                s.close();
+
+                assert.equal(msgs.length, 10);
+                msgs.forEach((m, i) => assert.equal(m, "hello world, hello world, " + i));
+            });
+
+            it("memory limit", () => {
+                assert.isNumber(ws.compressMemory);
+
+                ws.compressMemoryLimit = 1;
+                assert.equal(ws.compressMemoryLimit, 1);
+
+                echo({
+                    perMessageDeflate: true
+                });
+
+                ws.compressMemoryLimit = 0;
+
+                assert.throws(() => {
+                    ws.compressMemoryLimit = -1;
+                });
+            });
+
+            it("invalid window bits", () => {
+                assert.throws(() => {
+                    ws.upgrade({
+                        perMessageDeflate: {
+                            serverMaxWindowBits: 8
+                        }
+                    }, (s) => { });
+                });
+
+                assert.throws(() => {
+                    new ws.Socket("ws://127.0.0.1:" + (8821 + base_port) + "/ws", {
+                        perMessageDeflate: {
+                            clientMaxWindowBits: 16
+                        }
+                    });
+                });
+            });
+
+            it("metrics", () => {
+                var text = require('metrics').collect();
+                assert.ok(text.indexOf('fibjs_ws_compress_memory_bytes{kind="deflate"}') >= 0);
+                assert.ok(text.indexOf('fibjs_ws_compress_fallbacks_total') >= 0);
+            });
+        });
+
+        it('Hub', () => {
+            var hub = new ws.Hub();
+            var conns = [];
+
+            var httpd = new http.Server(8820 + base_port, {
+                "/ws": ws.upgrade({
+                    perMessageDeflate: true
+                }, (s) => {
+                    hub.subscribe(s, "news");
+                    conns.push(s);
+                })
+            });
+            test_util.push(httpd.socket);
+            httpd.start();
+
+            var msgs = [[], []];
+            var clients = [
+                new ws.Socket("ws://127.0.0.1:" + (8820 + base_port) + "/ws"),
+                new ws.Socket("ws://127.0.0.1:" + (8820 + base_port) + "/ws", {
+                    perMessageDeflate: true
+                })
+            ];
+
+            clients.forEach((s, i) => {
+                s.onmessage = (m) => {
+                    msgs[i].push(m);
+                };
+            });
+
+            for (var i = 0; i < 2000 && conns.length < 2; i++)
+                coroutine.sleep(1);
+
+            assert.equal(hub.count("news"), 2);
+            assert.equal(hub.count(), 0);
+
+            assert.equal(hub.publish("news", "hello"), 2);
+            assert.equal(hub.publish("news", new Buffer("world")), 2);
+            assert.equal(hub.publish("sports", "nobody"), 0);
+
+            for (var i = 0; i < 2000 && (msgs[0].length < 2 || msgs[1].length < 2); i++)
+                coroutine.sleep(1);
+
+            msgs.forEach((m, i) => {
+                assert.equal(m.length, 2);
+                assert.equal(m[0].data, "hello");
+                assert.isTrue(Buffer.isBuffer(m[1].data));
+                assert.equal(m[1].data.toString(), "world");
+                assert.equal(m[0].compress, i == 1);
+            });
+
+            var stats = hub.stats;
+            assert.equal(stats.topics, 1);
+            assert.equal(stats.subscribers, 2);
+            assert.equal(stats.published, 3);
+            assert.equal(stats.frames, 4);
+            assert.equal(stats.encoded, 4);
+
+            var t = false;
+            clients[1].onmessage = (m) => {
+                assert.equal(m.data, "after hub");
+                t = true;
+            };
+            conns[1].send("after hub");
+            for (var i = 0; i < 2000 && !t; i++)
+                coroutine.sleep(1);
+            assert.isTrue(t);
+
+            assert.throws(() => {
+                hub.subscribe(clients[0], "news");
+            });
+
+            hub.unsubscribe(conns[0], "news");
+            assert.equal(hub.count("news"), 1);
+
+            clients[1].close();
+            for (var i = 0; i < 2000 && conns[1].readyState != ws.CLOSED; i++)
+                coroutine.sleep(1);
+
+            assert.equal(hub.publish("news", "bye"), 0);
+            assert.equal(hub.count("news"), 0);
+            assert.equal(hub.stats.topics, 0);
+
+            clients[0].close();
+        });
+
         it('send/on("message")', () => {
             var httpd = new http.Server(8815 + base_port, {
                 "/ws": ws.upgrade((s) => {
@@ -3,6 +3,7 @@ test.setup();
 
 var xml = require('xml');
 var fs = require('fs');
+var io = require('io');
 
 function newDoc() {
     return new xml.Document();
@@ -987,6 +988,147 @@ describe('xml', () => {
             assert.equal(hdoc.toString(), "<html><head></head><body><div>    <p>abcdef</p></div></body></html>");
         });
     });
+
+    describe("parseStream", () => {
+        function stream(txt) {
+            var ms = new io.MemoryStream();
+            ms.write(txt);
+            ms.rewind();
+            return ms;
+        }
+
+        const feed = '<?xml version="1.0"?><rss version="2.0"><channel><title>t1</title>' +
+            '<item id="1"><title>a</title><![CDATA[<b>]]></item><!--c1-->' +
+            '<item id="2"><title>b</title></item><?pi data?></channel></rss>';
+
+        it("events", () => {
+            var events = [];
+
+            xml.parseStream(stream(feed), {
+                startElement: (name, attrs) => events.push(['start', name, attrs]),
+                endElement: name => events.push(['end', name]),
+                text: data => events.push(['text', data]),
+                comment: data => events.push(['comment', data]),
+                processingInstruction: (target, data) => events.push(['pi', target, data])
+            });
+
+            assert.deepEqual(events, [
+                ['start', 'rss', { version: '2.0' }],
+                ['start', 'channel', {}],
+                ['start', 'title', {}],
+                ['text', 't1'],
+                ['end', 'title'],
+                ['start', 'item', { id: '1' }],
+                ['start', 'title', {}],
+                ['text', 'a'],
+                ['end', 'title'],
+                ['text', '<b>'],
+                ['end', 'item'],
+                ['comment', 'c1'],
+                ['start', 'item', { id: '2' }],
+                ['start', 'title', {}],
+                ['text', 'b'],
+                ['end', 'title'],
+                ['end', 'item'],
+                ['pi', 'pi', 'data'],
+                ['end', 'channel'],
+                ['end', 'rss']
+            ]);
+        });
+
+        it("small buffer", () => {
+            var texts = [];
+
+            xml.parseStream(stream(feed), {
+                text: data => texts.push(data)
+            }, {
+                bufferSize: 3
+            });
+
+            assert.deepEqual(texts, ['t1', 'a', '<b>', 'b']);
+        });
+
+        it("subtree by path", () => {
+            var items = [];
+            var starts = [];
+
+            xml.parseStream(stream(feed), {
+                startElement: name => starts.push(name),
+                element: (node, path) => items.push([path, node.toString()])
+            }, {
+                paths: ['/rss/channel/item']
+            });
+
+            assert.deepEqual(starts, ['rss', 'channel', 'title']);
+            assert.deepEqual(items, [
+                ['/rss/channel/item', '<item id="1"><title>a</title><![CDATA[<b>]]></item>'],
+                ['/rss/channel/item', '<item id="2"><title>b</title></item>']
+            ]);
+        });
+
+        it("subtree by name", () => {
+            var titles = [];
+
+            xml.parseStream(stream(feed), {
+                element: (node, path) => titles.push([path, node.textContent])
+            }, {
+                paths: ['title']
+            });
+
+            assert.deepEqual(titles, [
+                ['/rss/channel/title', 't1'],
+                ['/rss/channel/item/title', 'a'],
+                ['/rss/channel/item/title', 'b']
+            ]);
+        });
+
+        it("handler exception", () => {
+            var n = 0;
+
+            assert.throws(() => {
+                xml.parseStream(stream(feed), {
+                    startElement: name => {
+                        n++;
+                        if (name == 'channel')
+                            throw new Error('stop');
+                    }
+                });
+            }, /stop/);
+
+            assert.equal(n, 2);
+        });
+
+        it("syntax error", () => {
+            assert.throws(() => {
+                xml.parseStream(stream('<a><b></a>'), {});
+            }, /XmlParser: error on line 1/);
+        });
+
+        it("file stream", () => {
+            var fname = __dirname + '/xml_files/stream_' + require('coroutine').vmid + '.xml';
+            var s = '<list>';
+            for (var i = 0; i < 1000; i++)
+                s += `<item>${i}</item>`;
+            s += '</list>';
+            fs.writeFile(fname, s);
+
+            var sum = 0;
+            var f = fs.openFile(fname);
+            try {
+                xml.parseStream(f, {
+                    element: node => sum += Number(node.textContent)
+                }, {
+                    paths: ['item'],
+                    bufferSize: 1024
+                });
+            } finally {
+                f.close();
+                fs.unlink(fname);
+            }
+
+            assert.equal(sum, 499500);
+        });
+    });
 });
 
 require.main === module && test.run(console.DEBUG);
\ No newline at end of file